@@ -0,0 +1,397 @@
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <LoadBalancer.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibamr/StaggeredStokesSolverManager.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/BenchmarkRecorder.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LSiloDataWriter.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Function prototypes
+void generate_structure(Pointer<Database> input_db);
+void benchmark_force_gen(BenchmarkRecorder& bench,
+                         Pointer<IBStandardForceGen> ib_force_fcn,
+                         Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                         LDataManager* l_data_manager);
+void benchmark_redistribution(BenchmarkRecorder& bench, LDataManager* l_data_manager);
+void benchmark_silo_output(BenchmarkRecorder& bench, Pointer<LSiloDataWriter> silo_data_writer);
+void benchmark_stokes_fac_v_cycle(BenchmarkRecorder& bench,
+                                  Pointer<Database> input_db,
+                                  Pointer<PatchHierarchy<NDIM> > patch_hierarchy);
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Benchmark results are appended (one JSON object per line) to the file       *
+ * specified by the results_filename entry of the Benchmarks input database.   *
+ *                                                                             *
+ *******************************************************************************/
+int main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "benchmarks.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> bench_db = app_initializer->getComponentDatabase("Benchmarks");
+
+        // Generate the synthetic immersed structure.
+        generate_structure(app_initializer->getComponentDatabase("StructureGenerator"));
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator = new IBExplicitHierarchyIntegrator(
+            "IBHierarchyIntegrator", app_initializer->getComponentDatabase("IBHierarchyIntegrator"), ib_method_ops,
+            navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize", time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm", app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector, box_generator, load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Set up visualization plot file writers.
+        Pointer<LSiloDataWriter> silo_data_writer = app_initializer->getLSiloDataWriter();
+        if (silo_data_writer)
+        {
+            ib_initializer->registerLSiloDataWriter(silo_data_writer);
+            ib_method_ops->registerLSiloDataWriter(silo_data_writer);
+        }
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Run the benchmarks.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        BenchmarkRecorder bench("Benchmarks", bench_db);
+        bench.setParameter("ndim", NDIM);
+        bench.setParameter("num_levels", patch_hierarchy->getFinestLevelNumber() + 1);
+        bench.setParameter("num_nodes", l_data_manager->getNumberOfNodes(patch_hierarchy->getFinestLevelNumber()));
+
+        if (bench_db->getBoolWithDefault("enable_force_gen", true))
+        {
+            benchmark_force_gen(bench, ib_force_fcn, patch_hierarchy, l_data_manager);
+        }
+        if (bench_db->getBoolWithDefault("enable_redistribution", true))
+        {
+            benchmark_redistribution(bench, l_data_manager);
+        }
+        if (bench_db->getBoolWithDefault("enable_silo_output", true))
+        {
+            if (silo_data_writer)
+            {
+                benchmark_silo_output(bench, silo_data_writer);
+            }
+            else
+            {
+                pout << "WARNING: LSiloDataWriter benchmark requires viz_writer to include \"Silo\"\n";
+            }
+        }
+        if (bench_db->getBoolWithDefault("enable_stokes_fac", true))
+        {
+            benchmark_stokes_fac_v_cycle(bench, input_db->getDatabase("StokesFAC"), patch_hierarchy);
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
+
+void generate_structure(Pointer<Database> input_db)
+{
+    // Generate a closed curve (in 2D) or a stack of closed curves (in 3D)
+    // connected by springs, with beams along each curve.
+    const string structure_name = input_db->getString("structure_name");
+    const int num_curve_nodes = input_db->getInteger("num_curve_nodes");
+    const int num_curves = NDIM == 2 ? 1 : input_db->getInteger("num_curves");
+    const double radius = input_db->getDouble("radius");
+    double center[NDIM];
+    input_db->getDoubleArray("center", center, NDIM);
+    const double spring_stiffness = input_db->getDouble("spring_stiffness");
+    const double beam_bend_rigidity = input_db->getDouble("beam_bend_rigidity");
+    const double curve_spacing = NDIM == 2 ? 0.0 : input_db->getDouble("curve_spacing");
+    const double ds = 2.0 * M_PI * radius / static_cast<double>(num_curve_nodes);
+
+    if (SAMRAI_MPI::getRank() == 0)
+    {
+        ofstream vertex_stream((structure_name + ".vertex").c_str());
+        vertex_stream << num_curves * num_curve_nodes << "\n" << setprecision(16);
+        for (int c = 0; c < num_curves; ++c)
+        {
+            for (int k = 0; k < num_curve_nodes; ++k)
+            {
+                const double theta = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(num_curve_nodes);
+                vertex_stream << center[0] + radius * cos(theta) << " " << center[1] + radius * sin(theta);
+                if (NDIM == 3)
+                {
+                    const double offset = curve_spacing * (static_cast<double>(c) - 0.5 * (num_curves - 1));
+                    vertex_stream << " " << center[NDIM - 1] + offset;
+                }
+                vertex_stream << "\n";
+            }
+        }
+
+        ofstream spring_stream((structure_name + ".spring").c_str());
+        spring_stream << num_curves * num_curve_nodes + (num_curves - 1) * num_curve_nodes << "\n" << setprecision(16);
+        for (int c = 0; c < num_curves; ++c)
+        {
+            for (int k = 0; k < num_curve_nodes; ++k)
+            {
+                const int idx = c * num_curve_nodes + k;
+                const int next_idx = c * num_curve_nodes + (k + 1) % num_curve_nodes;
+                spring_stream << idx << " " << next_idx << " " << spring_stiffness << " " << ds << "\n";
+            }
+        }
+        for (int c = 0; c + 1 < num_curves; ++c)
+        {
+            for (int k = 0; k < num_curve_nodes; ++k)
+            {
+                const int idx = c * num_curve_nodes + k;
+                spring_stream << idx << " " << idx + num_curve_nodes << " " << spring_stiffness << " "
+                              << curve_spacing << "\n";
+            }
+        }
+
+        ofstream beam_stream((structure_name + ".beam").c_str());
+        beam_stream << num_curves * num_curve_nodes << "\n" << setprecision(16);
+        for (int c = 0; c < num_curves; ++c)
+        {
+            for (int k = 0; k < num_curve_nodes; ++k)
+            {
+                const int prev_idx = c * num_curve_nodes + (k + num_curve_nodes - 1) % num_curve_nodes;
+                const int curr_idx = c * num_curve_nodes + k;
+                const int next_idx = c * num_curve_nodes + (k + 1) % num_curve_nodes;
+                beam_stream << prev_idx << " " << curr_idx << " " << next_idx << " " << beam_bend_rigidity << "\n";
+            }
+        }
+    }
+    SAMRAI_MPI::barrier();
+    return;
+} // generate_structure
+
+void benchmark_force_gen(BenchmarkRecorder& bench,
+                         Pointer<IBStandardForceGen> ib_force_fcn,
+                         Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                         LDataManager* l_data_manager)
+{
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    vector<Pointer<LData> > F_data(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+        ib_force_fcn->initializeLevelData(patch_hierarchy, ln, 0.0, true, l_data_manager);
+        F_data[ln] = l_data_manager->createLData("F_benchmark", ln, NDIM);
+    }
+    while (bench.continueIterations())
+    {
+        bench.startIteration();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+            Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+            Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
+            ib_force_fcn->computeLagrangianForce(F_data[ln], X_data, U_data, patch_hierarchy, ln, 0.0, l_data_manager);
+        }
+        bench.stopIteration();
+    }
+    bench.recordBenchmark("IBStandardForceGen::computeLagrangianForce");
+    return;
+} // benchmark_force_gen
+
+void benchmark_redistribution(BenchmarkRecorder& bench, LDataManager* l_data_manager)
+{
+    while (bench.continueIterations())
+    {
+        bench.startIteration();
+        l_data_manager->beginDataRedistribution();
+        l_data_manager->endDataRedistribution();
+        bench.stopIteration();
+    }
+    bench.recordBenchmark("LDataManager::redistribution");
+    return;
+} // benchmark_redistribution
+
+void benchmark_silo_output(BenchmarkRecorder& bench, Pointer<LSiloDataWriter> silo_data_writer)
+{
+    int iteration_num = 0;
+    while (bench.continueIterations())
+    {
+        bench.startIteration();
+        silo_data_writer->writePlotData(iteration_num, static_cast<double>(iteration_num));
+        bench.stopIteration();
+        ++iteration_num;
+    }
+    bench.recordBenchmark("LSiloDataWriter::writePlotData");
+    return;
+} // benchmark_silo_output
+
+void benchmark_stokes_fac_v_cycle(BenchmarkRecorder& bench,
+                                  Pointer<Database> input_db,
+                                  Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<VariableContext> ctx = var_db->getContext("stokes_fac");
+    Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u_stokes_fac");
+    Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p_stokes_fac");
+    Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f_stokes_fac");
+    Pointer<CellVariable<NDIM, double> > g_var = new CellVariable<NDIM, double>("g_stokes_fac");
+    const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+    const int p_idx = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+    const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+    const int g_idx = var_db->registerVariableAndContext(g_var, ctx, IntVector<NDIM>(1));
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(u_idx, 0.0);
+        level->allocatePatchData(p_idx, 0.0);
+        level->allocatePatchData(f_idx, 0.0);
+        level->allocatePatchData(g_idx, 0.0);
+    }
+
+    HierarchyMathOps hier_math_ops("hier_math_ops_stokes_fac", patch_hierarchy);
+    const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+    const int wgt_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+    SAMRAIVectorReal<NDIM, double> sol_vec("sol", patch_hierarchy, 0, finest_ln);
+    SAMRAIVectorReal<NDIM, double> rhs_vec("rhs", patch_hierarchy, 0, finest_ln);
+    sol_vec.addComponent(u_var, u_idx, wgt_sc_idx);
+    sol_vec.addComponent(p_var, p_idx, wgt_cc_idx);
+    rhs_vec.addComponent(f_var, f_idx, wgt_sc_idx);
+    rhs_vec.addComponent(g_var, g_idx, wgt_cc_idx);
+    sol_vec.setToScalar(0.0);
+    rhs_vec.setRandomValues(1.0, 0.0);
+
+    // Setup the FAC preconditioner for the time-dependent Stokes problem.
+    const double rho = input_db->getDouble("rho");
+    const double mu = input_db->getDouble("mu");
+    const double dt = input_db->getDouble("dt");
+    PoissonSpecifications U_problem_coefs("U_problem_coefs");
+    U_problem_coefs.setCConstant(rho / dt);
+    U_problem_coefs.setDConstant(-0.5 * mu);
+    vector<RobinBcCoefStrategy<NDIM>*> U_bc_coefs(NDIM, static_cast<RobinBcCoefStrategy<NDIM>*>(NULL));
+    Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+    bc_helper->cacheBcCoefData(U_bc_coefs, dt, patch_hierarchy);
+    const string solver_type = input_db->getString("solver_type");
+    Pointer<StaggeredStokesSolver> fac_solver = StaggeredStokesSolverManager::getManager()->allocateSolver(
+        solver_type, "stokes_fac", input_db->getDatabase("solver_db"), "stokes_fac_");
+    fac_solver->setVelocityPoissonSpecifications(U_problem_coefs);
+    fac_solver->setPhysicalBcCoefs(U_bc_coefs, NULL);
+    fac_solver->setPhysicalBoundaryHelper(bc_helper);
+    fac_solver->setSolutionTime(dt);
+    fac_solver->setTimeInterval(0.0, dt);
+    fac_solver->initializeSolverState(sol_vec, rhs_vec);
+
+    bench.setParameter("solver_type", solver_type);
+    while (bench.continueIterations())
+    {
+        sol_vec.setToScalar(0.0);
+        bench.startIteration();
+        fac_solver->solveSystem(sol_vec, rhs_vec);
+        bench.stopIteration();
+    }
+    bench.recordBenchmark("StaggeredStokesFAC::V-cycle");
+    fac_solver->deallocateSolverState();
+
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(u_idx);
+        level->deallocatePatchData(p_idx);
+        level->deallocatePatchData(f_idx);
+        level->deallocatePatchData(g_idx);
+    }
+    return;
+} // benchmark_stokes_fac_v_cycle
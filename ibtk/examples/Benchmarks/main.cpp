@@ -0,0 +1,547 @@
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellVariable.h>
+#include <EdgeVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <NodeVariable.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/BenchmarkRecorder.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/PatchMathOps.h>
+#include <ibtk/SCPoissonSolverManager.h>
+#include <ibtk/app_namespaces.h>
+
+// Function prototypes
+void benchmark_le_interactor(BenchmarkRecorder& bench,
+                             Pointer<Database> input_db,
+                             Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                             const int ghost_width);
+void benchmark_patch_math_ops(BenchmarkRecorder& bench, Pointer<PatchHierarchy<NDIM> > patch_hierarchy);
+void benchmark_fac_v_cycle(BenchmarkRecorder& bench,
+                           Pointer<Database> input_db,
+                           Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                           const string& centering);
+void set_hierarchy_parameters(BenchmarkRecorder& bench, Pointer<PatchHierarchy<NDIM> > patch_hierarchy);
+void fill_random(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int data_idx, unsigned int& seed);
+double uniform_random(unsigned int& seed);
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ * Benchmark results are appended (one JSON object per line) to the file       *
+ * specified by the results_filename entry of the Benchmarks input database.   *
+ *                                                                             *
+ *******************************************************************************/
+int main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "benchmarks.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> bench_db = app_initializer->getComponentDatabase("Benchmarks");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm", app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector, box_generator, load_balancer);
+
+        // Determine the ghost cell width required by the Lagrangian-Eulerian
+        // interaction kernels.
+        Pointer<Database> le_db = app_initializer->getComponentDatabase("LEInteractor");
+        const int num_kernels = le_db->getArraySize("kernels");
+        vector<string> kernels(num_kernels);
+        le_db->getStringArray("kernels", &kernels[0], num_kernels);
+        int ghost_width = 1;
+        for (int k = 0; k < num_kernels; ++k)
+        {
+            ghost_width = max(ghost_width, LEInteractor::getMinimumGhostWidth(kernels[k]));
+        }
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Run the benchmarks.
+        BenchmarkRecorder bench("Benchmarks", bench_db);
+        if (bench_db->getBoolWithDefault("enable_le_interactor", true))
+        {
+            set_hierarchy_parameters(bench, patch_hierarchy);
+            benchmark_le_interactor(bench, le_db, patch_hierarchy, ghost_width);
+        }
+        if (bench_db->getBoolWithDefault("enable_patch_math_ops", true))
+        {
+            set_hierarchy_parameters(bench, patch_hierarchy);
+            benchmark_patch_math_ops(bench, patch_hierarchy);
+        }
+        if (bench_db->getBoolWithDefault("enable_cc_poisson_fac", true))
+        {
+            set_hierarchy_parameters(bench, patch_hierarchy);
+            benchmark_fac_v_cycle(
+                bench, app_initializer->getComponentDatabase("CCPoissonFAC"), patch_hierarchy, "CELL");
+        }
+        if (bench_db->getBoolWithDefault("enable_sc_poisson_fac", true))
+        {
+            set_hierarchy_parameters(bench, patch_hierarchy);
+            benchmark_fac_v_cycle(
+                bench, app_initializer->getComponentDatabase("SCPoissonFAC"), patch_hierarchy, "SIDE");
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
+
+void benchmark_le_interactor(BenchmarkRecorder& bench,
+                             Pointer<Database> input_db,
+                             Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                             const int ghost_width)
+{
+    const int num_kernels = input_db->getArraySize("kernels");
+    vector<string> kernels(num_kernels);
+    input_db->getStringArray("kernels", &kernels[0], num_kernels);
+    const int num_centerings = input_db->getArraySize("centerings");
+    vector<string> centerings(num_centerings);
+    input_db->getStringArray("centerings", &centerings[0], num_centerings);
+    const int num_marker_counts = input_db->getArraySize("num_markers");
+    vector<int> num_markers(num_marker_counts);
+    input_db->getIntegerArray("num_markers", &num_markers[0], num_marker_counts);
+    unsigned int seed = input_db->getIntegerWithDefault("seed", 0) + SAMRAI_MPI::getRank();
+
+    // Lagrangian-Eulerian interaction is benchmarked on the finest level of
+    // the patch hierarchy.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<VariableContext> ctx = var_db->getContext("le_interactor");
+    const IntVector<NDIM> gcw(ghost_width);
+    const int q_cc_idx = var_db->registerVariableAndContext(new CellVariable<NDIM, double>("q_cc", NDIM), ctx, gcw);
+    const int q_nc_idx = var_db->registerVariableAndContext(new NodeVariable<NDIM, double>("q_nc", NDIM), ctx, gcw);
+    const int q_sc_idx = var_db->registerVariableAndContext(new SideVariable<NDIM, double>("q_sc"), ctx, gcw);
+    const int q_ec_idx = var_db->registerVariableAndContext(new EdgeVariable<NDIM, double>("q_ec"), ctx, gcw);
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(finest_ln);
+    level->allocatePatchData(q_cc_idx, 0.0);
+    level->allocatePatchData(q_nc_idx, 0.0);
+    level->allocatePatchData(q_sc_idx, 0.0);
+    level->allocatePatchData(q_ec_idx, 0.0);
+    const BoxArray<NDIM>& level_boxes = level->getBoxes();
+    double level_num_cells = 0.0;
+    for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k) level_num_cells += level_boxes[k].size();
+
+    for (int m = 0; m < num_marker_counts; ++m)
+    {
+        // Generate uniformly distributed markers in each local patch.  The
+        // number of markers in each patch is proportional to its volume.
+        vector<vector<double> > X_data, Q_data;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const x_upper = pgeom->getXUpper();
+            const int num_patch_markers =
+                static_cast<int>(num_markers[m] * patch->getBox().size() / level_num_cells + 0.5);
+            X_data.push_back(vector<double>(NDIM * num_patch_markers));
+            Q_data.push_back(vector<double>(NDIM * num_patch_markers));
+            for (int k = 0; k < num_patch_markers; ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double r = uniform_random(seed);
+                    X_data.back()[NDIM * k + d] = x_lower[d] + (0.001 + 0.998 * r) * (x_upper[d] - x_lower[d]);
+                    Q_data.back()[NDIM * k + d] = uniform_random(seed);
+                }
+            }
+        }
+        bench.setParameter("num_markers", num_markers[m]);
+
+        for (int c = 0; c < num_centerings; ++c)
+        {
+            const string& centering = centerings[c];
+            int q_idx = -1;
+            if (centering == "CELL")
+                q_idx = q_cc_idx;
+            else if (centering == "NODE")
+                q_idx = q_nc_idx;
+            else if (centering == "SIDE")
+                q_idx = q_sc_idx;
+            else if (centering == "EDGE")
+                q_idx = q_ec_idx;
+            else
+                TBOX_ERROR("unsupported data centering: " << centering << "\n"
+                                                          << "Valid options are: CELL, NODE, SIDE, EDGE");
+            bench.setParameter("centering", centering);
+
+            for (int k = 0; k < num_kernels; ++k)
+            {
+                const string& kernel = kernels[k];
+                bench.setParameter("kernel", kernel);
+
+                while (bench.continueIterations())
+                {
+                    bench.startIteration();
+                    int patch_num = 0;
+                    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_num)
+                    {
+                        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                        const Box<NDIM>& patch_box = patch->getBox();
+                        const vector<double>& X = X_data[patch_num];
+                        const vector<double>& Q = Q_data[patch_num];
+                        if (centering == "CELL")
+                        {
+                            Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+                            LEInteractor::spread(q_data, Q, NDIM, X, NDIM, patch, patch_box, kernel);
+                        }
+                        else if (centering == "NODE")
+                        {
+                            Pointer<NodeData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+                            LEInteractor::spread(q_data, Q, NDIM, X, NDIM, patch, patch_box, kernel);
+                        }
+                        else if (centering == "SIDE")
+                        {
+                            Pointer<SideData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+                            LEInteractor::spread(q_data, Q, NDIM, X, NDIM, patch, patch_box, kernel);
+                        }
+                        else if (centering == "EDGE")
+                        {
+                            Pointer<EdgeData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+                            LEInteractor::spread(q_data, Q, NDIM, X, NDIM, patch, patch_box, kernel);
+                        }
+                    }
+                    bench.stopIteration();
+                }
+                bench.recordBenchmark("LEInteractor::spread");
+
+                while (bench.continueIterations())
+                {
+                    bench.startIteration();
+                    int patch_num = 0;
+                    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_num)
+                    {
+                        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                        const Box<NDIM>& patch_box = patch->getBox();
+                        const vector<double>& X = X_data[patch_num];
+                        vector<double>& Q = Q_data[patch_num];
+                        if (centering == "CELL")
+                        {
+                            Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+                            LEInteractor::interpolate(Q, NDIM, X, NDIM, q_data, patch, patch_box, kernel);
+                        }
+                        else if (centering == "NODE")
+                        {
+                            Pointer<NodeData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+                            LEInteractor::interpolate(Q, NDIM, X, NDIM, q_data, patch, patch_box, kernel);
+                        }
+                        else if (centering == "SIDE")
+                        {
+                            Pointer<SideData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+                            LEInteractor::interpolate(Q, NDIM, X, NDIM, q_data, patch, patch_box, kernel);
+                        }
+                        else if (centering == "EDGE")
+                        {
+                            Pointer<EdgeData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+                            LEInteractor::interpolate(Q, NDIM, X, NDIM, q_data, patch, patch_box, kernel);
+                        }
+                    }
+                    bench.stopIteration();
+                }
+                bench.recordBenchmark("LEInteractor::interpolate");
+            }
+        }
+    }
+    level->deallocatePatchData(q_cc_idx);
+    level->deallocatePatchData(q_nc_idx);
+    level->deallocatePatchData(q_sc_idx);
+    level->deallocatePatchData(q_ec_idx);
+    return;
+} // benchmark_le_interactor
+
+void benchmark_patch_math_ops(BenchmarkRecorder& bench, Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<VariableContext> ctx = var_db->getContext("patch_math_ops");
+    const int src_cc_idx =
+        var_db->registerVariableAndContext(new CellVariable<NDIM, double>("src_cc"), ctx, IntVector<NDIM>(1));
+    const int dst_cc_idx =
+        var_db->registerVariableAndContext(new CellVariable<NDIM, double>("dst_cc"), ctx, IntVector<NDIM>(0));
+    const int src_sc_idx =
+        var_db->registerVariableAndContext(new SideVariable<NDIM, double>("src_sc"), ctx, IntVector<NDIM>(1));
+    const int dst_sc_idx =
+        var_db->registerVariableAndContext(new SideVariable<NDIM, double>("dst_sc"), ctx, IntVector<NDIM>(0));
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(src_cc_idx, 0.0);
+        level->allocatePatchData(dst_cc_idx, 0.0);
+        level->allocatePatchData(src_sc_idx, 0.0);
+        level->allocatePatchData(dst_sc_idx, 0.0);
+    }
+    unsigned int seed = SAMRAI_MPI::getRank();
+    fill_random(patch_hierarchy, src_cc_idx, seed);
+    fill_random(patch_hierarchy, src_sc_idx, seed);
+
+    PatchMathOps patch_math_ops;
+    static const int NUM_OPS = 4;
+    static const char* const OP_NAMES[NUM_OPS] = { "PatchMathOps::laplace(CELL)",
+                                                   "PatchMathOps::laplace(SIDE)",
+                                                   "PatchMathOps::div(SIDE->CELL)",
+                                                   "PatchMathOps::grad(CELL->SIDE)" };
+    for (int op = 0; op < NUM_OPS; ++op)
+    {
+        while (bench.continueIterations())
+        {
+            bench.startIteration();
+            for (int ln = 0; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<CellData<NDIM, double> > src_cc_data = patch->getPatchData(src_cc_idx);
+                    Pointer<CellData<NDIM, double> > dst_cc_data = patch->getPatchData(dst_cc_idx);
+                    Pointer<SideData<NDIM, double> > src_sc_data = patch->getPatchData(src_sc_idx);
+                    Pointer<SideData<NDIM, double> > dst_sc_data = patch->getPatchData(dst_sc_idx);
+                    switch (op)
+                    {
+                    case 0:
+                        patch_math_ops.laplace(dst_cc_data, 1.0, 0.0, src_cc_data, 0.0, dst_cc_data, patch);
+                        break;
+                    case 1:
+                        patch_math_ops.laplace(dst_sc_data, 1.0, 0.0, src_sc_data, 0.0, dst_sc_data, patch);
+                        break;
+                    case 2:
+                        patch_math_ops.div(dst_cc_data, 1.0, src_sc_data, 0.0, dst_cc_data, patch);
+                        break;
+                    case 3:
+                        patch_math_ops.grad(dst_sc_data, 1.0, src_cc_data, 0.0, dst_sc_data, patch);
+                        break;
+                    }
+                }
+            }
+            bench.stopIteration();
+        }
+        bench.recordBenchmark(OP_NAMES[op]);
+    }
+
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(src_cc_idx);
+        level->deallocatePatchData(dst_cc_idx);
+        level->deallocatePatchData(src_sc_idx);
+        level->deallocatePatchData(dst_sc_idx);
+    }
+    return;
+} // benchmark_patch_math_ops
+
+void benchmark_fac_v_cycle(BenchmarkRecorder& bench,
+                           Pointer<Database> input_db,
+                           Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                           const string& centering)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<VariableContext> ctx = var_db->getContext("fac_" + centering);
+    Pointer<Variable<NDIM> > u_var, f_var;
+    if (centering == "CELL")
+    {
+        u_var = new CellVariable<NDIM, double>("u_fac_cc");
+        f_var = new CellVariable<NDIM, double>("f_fac_cc");
+    }
+    else
+    {
+        u_var = new SideVariable<NDIM, double>("u_fac_sc");
+        f_var = new SideVariable<NDIM, double>("f_fac_sc");
+    }
+    const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+    const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(u_idx, 0.0);
+        level->allocatePatchData(f_idx, 0.0);
+    }
+
+    HierarchyMathOps hier_math_ops("hier_math_ops_" + centering, patch_hierarchy);
+    const int h_idx = centering == "CELL" ? hier_math_ops.getCellWeightPatchDescriptorIndex() :
+                                            hier_math_ops.getSideWeightPatchDescriptorIndex();
+    SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, finest_ln);
+    SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+    u_vec.addComponent(u_var, u_idx, h_idx);
+    f_vec.addComponent(f_var, f_idx, h_idx);
+    u_vec.setToScalar(0.0);
+    unsigned int seed = SAMRAI_MPI::getRank();
+    fill_random(patch_hierarchy, f_idx, seed);
+
+    // Setup the FAC preconditioner for the Helmholtz problem (I - L) u = f,
+    // which is nonsingular on periodic domains.
+    PoissonSpecifications poisson_spec("poisson_spec");
+    poisson_spec.setCConstant(1.0);
+    poisson_spec.setDConstant(-1.0);
+    const string solver_type = input_db->getString("solver_type");
+    Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+    Pointer<PoissonSolver> fac_solver;
+    if (centering == "CELL")
+    {
+        fac_solver = CCPoissonSolverManager::getManager()->allocateSolver(solver_type, "cc_fac", solver_db, "cc_fac_");
+        fac_solver->setPhysicalBcCoef(NULL);
+    }
+    else
+    {
+        fac_solver = SCPoissonSolverManager::getManager()->allocateSolver(solver_type, "sc_fac", solver_db, "sc_fac_");
+        fac_solver->setPhysicalBcCoefs(vector<RobinBcCoefStrategy<NDIM>*>(NDIM, NULL));
+    }
+    fac_solver->setPoissonSpecifications(poisson_spec);
+    fac_solver->initializeSolverState(u_vec, f_vec);
+
+    bench.setParameter("solver_type", solver_type);
+    while (bench.continueIterations())
+    {
+        u_vec.setToScalar(0.0);
+        bench.startIteration();
+        fac_solver->solveSystem(u_vec, f_vec);
+        bench.stopIteration();
+    }
+    bench.recordBenchmark(centering == "CELL" ? "CCPoissonFAC::V-cycle" : "SCPoissonFAC::V-cycle");
+    fac_solver->deallocateSolverState();
+
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(u_idx);
+        level->deallocatePatchData(f_idx);
+    }
+    return;
+} // benchmark_fac_v_cycle
+
+void set_hierarchy_parameters(BenchmarkRecorder& bench, Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    bench.clearParameters();
+    bench.setParameter("ndim", NDIM);
+    bench.setParameter("num_levels", patch_hierarchy->getFinestLevelNumber() + 1);
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        const BoxArray<NDIM>& level_boxes = patch_hierarchy->getPatchLevel(ln)->getBoxes();
+        int num_cells = 0;
+        for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k) num_cells += level_boxes[k].size();
+        ostringstream key;
+        key << "num_cells_level_" << ln;
+        bench.setParameter(key.str(), num_cells);
+    }
+    return;
+} // set_hierarchy_parameters
+
+void fill_random(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int data_idx, unsigned int& seed)
+{
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > cc_data = patch->getPatchData(data_idx);
+            Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(data_idx);
+            if (cc_data)
+            {
+                ArrayData<NDIM, double>& array_data = cc_data->getArrayData();
+                double* const data = array_data.getPointer();
+                const int size = array_data.getDepth() * array_data.getBox().size();
+                for (int k = 0; k < size; ++k) data[k] = uniform_random(seed);
+            }
+            if (sc_data)
+            {
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    ArrayData<NDIM, double>& array_data = sc_data->getArrayData(axis);
+                    double* const data = array_data.getPointer();
+                    const int size = array_data.getDepth() * array_data.getBox().size();
+                    for (int k = 0; k < size; ++k) data[k] = uniform_random(seed);
+                }
+            }
+        }
+    }
+    return;
+} // fill_random
+
+double uniform_random(unsigned int& seed)
+{
+    // A simple linear congruential generator yields reproducible sequences on
+    // all platforms.
+    seed = 1664525u * seed + 1013904223u;
+    return static_cast<double>(seed >> 8) / static_cast<double>(1u << 24);
+} // uniform_random
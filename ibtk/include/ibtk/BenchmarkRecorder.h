@@ -0,0 +1,214 @@
+// Filename: BenchmarkRecorder.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_BenchmarkRecorder
+#define included_BenchmarkRecorder
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class BenchmarkRecorder times repeated executions of a benchmark
+ * kernel and writes the resulting statistics in a machine-readable format that
+ * can be compared across builds and revisions.
+ *
+ * Each iteration is bracketed by calls to startIteration() and stopIteration().
+ * The time of an iteration is the maximum wall clock time over all MPI
+ * processes, and the first few iterations are discarded as warmup iterations.
+ * recordBenchmark() prints a one-line summary and appends one JSON object per
+ * benchmark (i.e., one line of a "JSON lines" file) to the results file on MPI
+ * process 0.  Each record includes the benchmark name, the user-provided tag
+ * (e.g., a revision identifier), the number of MPI processes, the benchmark
+ * parameters, and the minimum, median, mean, and maximum iteration times.
+ *
+ * Sample input:
+ * \verbatim
+ num_warmup_iterations = 1                          // default is 1
+ num_iterations = 10                                // default is 10
+ results_filename = "benchmark_results.jsonl"       // default is "benchmark_results.jsonl"
+ append_results = FALSE                             // default is FALSE
+ tag = "baseline"                                   // default is ""
+ \endverbatim
+ *
+ * Typical usage:
+ * \code
+ bench.setParameter("kernel", "IB_4");
+ while (bench.continueIterations())
+ {
+     bench.startIteration();
+     // ... execute the kernel ...
+     bench.stopIteration();
+ }
+ bench.recordBenchmark("LEInteractor::spread");
+ \endcode
+ */
+class BenchmarkRecorder
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    BenchmarkRecorder(const std::string& object_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~BenchmarkRecorder();
+
+    /*!
+     * \name Benchmark parameters.
+     *
+     * Parameters are included in each subsequently recorded benchmark.
+     * Setting a parameter that has already been set replaces its value.
+     */
+    //\{
+
+    /*!
+     * \brief Set a string-valued benchmark parameter.
+     */
+    void setParameter(const std::string& key, const std::string& value);
+
+    /*!
+     * \brief Set a string-valued benchmark parameter.
+     */
+    void setParameter(const std::string& key, const char* value);
+
+    /*!
+     * \brief Set an integer-valued benchmark parameter.
+     */
+    void setParameter(const std::string& key, int value);
+
+    /*!
+     * \brief Set a real-valued benchmark parameter.
+     */
+    void setParameter(const std::string& key, double value);
+
+    /*!
+     * \brief Remove all benchmark parameters.
+     */
+    void clearParameters();
+
+    //\}
+
+    /*!
+     * \return Whether additional (warmup or timed) iterations are required.
+     */
+    bool continueIterations() const;
+
+    /*!
+     * \brief Start timing an iteration.
+     *
+     * \note This method is collective on all MPI processes!
+     */
+    void startIteration();
+
+    /*!
+     * \brief Stop timing an iteration.
+     *
+     * \note This method is collective on all MPI processes!
+     */
+    void stopIteration();
+
+    /*!
+     * \brief Summarize the timed iterations, write the benchmark record, and
+     * reset the iteration counters.
+     */
+    void recordBenchmark(const std::string& benchmark_name);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    BenchmarkRecorder();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    BenchmarkRecorder(const BenchmarkRecorder& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    BenchmarkRecorder& operator=(const BenchmarkRecorder& that);
+
+    /*!
+     * \brief Set a benchmark parameter whose value is already formatted as a
+     * JSON value.
+     */
+    void setFormattedParameter(const std::string& key, const std::string& value);
+
+    std::string d_object_name;
+
+    /*!
+     * \brief Run-time options.
+     */
+    int d_num_warmup_iterations, d_num_iterations;
+    std::string d_results_filename, d_tag;
+
+    /*!
+     * \brief The benchmark parameters, with values formatted as JSON values.
+     */
+    std::vector<std::pair<std::string, std::string> > d_parameters;
+
+    /*!
+     * \brief Data for the current benchmark.
+     */
+    int d_num_completed_warmup_iterations;
+    std::vector<double> d_iteration_times;
+    double d_iteration_start_time;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_BenchmarkRecorder
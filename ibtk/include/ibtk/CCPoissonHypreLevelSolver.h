@@ -245,6 +245,14 @@ public:
      * \note It is safe to call deallocateSolverState() when the solver state is
      * already deallocated.
      *
+     * \note The hypre grid, stencil, matrix, and vector objects are retained
+     * after the solver state is deallocated.  If the next call to
+     * initializeSolverState() uses the same patch level configuration and data
+     * depth, these objects are reused, and only the matrix coefficients and the
+     * hypre solver setup are recomputed.  This makes it inexpensive to
+     * reinitialize the solver when only the problem coefficients change (e.g.,
+     * when the time step size changes).
+     *
      * \see initializeSolverState
      */
     void deallocateSolverState();
@@ -283,6 +291,10 @@ private:
      * \brief Functions to allocate, initialize, access, and deallocate hypre
      * data structures.
      */
+    bool canReuseHypreData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_num,
+                           unsigned int depth,
+                           bool grid_aligned_anisotropy) const;
     void allocateHypreData();
     void setMatrixCoefficients_aligned();
     void setMatrixCoefficients_nonaligned();
@@ -339,6 +351,7 @@ private:
     std::vector<HYPRE_StructVector> d_rhs_vecs, d_sol_vecs;
     std::vector<HYPRE_StructSolver> d_solvers, d_preconds;
     std::vector<SAMRAI::hier::Index<NDIM> > d_stencil_offsets;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_grid_patch_boxes;
 
     std::string d_solver_type, d_precond_type;
     int d_rel_change;
@@ -39,6 +39,7 @@
 #include <string>
 #include <vector>
 
+#include "ArrayData.h"
 #include "IntVector.h"
 #include "PoissonSpecifications.h"
 #include "ibtk/PoissonFACPreconditioner.h"
@@ -111,6 +112,7 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ use_single_precision_smoother = FALSE        // see setUseSinglePrecisionSmoother()
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -118,6 +120,18 @@ namespace IBTK
     num_post_relax_steps = 2
  }
  \endverbatim
+ *
+ * When use_single_precision_smoother is enabled, Gauss-Seidel sweeps are
+ * performed on single-precision copies of the error and residual.  This option
+ * is ignored when PETSc patch smoothers are required (i.e., for variable
+ * coefficient problems).
+ *
+ * \note Because prolongation and residual computations modify the
+ * double-precision error, the error is converted to single precision at the
+ * start of each call to smoothError() and copied back at its end.  Only the
+ * single-precision residual is retained between the pre- and post-smoothing
+ * sweeps on each level.  Memory traffic is therefore reduced only when
+ * several sweeps are performed per call.
 */
 class CCPoissonPointRelaxationFACOperator : public PoissonFACPreconditionerStrategy
 {
@@ -314,6 +328,22 @@ private:
      */
     std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap;
     std::vector<std::vector<std::map<int, SAMRAI::hier::Box<NDIM> > > > d_patch_neighbor_overlap;
+
+    /*
+     * Single-precision copies of the error and residual used by the patch
+     * smoothers, along with the patch boundary layers that are exchanged with
+     * the double-precision level data between sweeps.
+     */
+    bool d_using_single_precision_smoother;
+    std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, float> > > > d_patch_sp_error_data;
+    std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, float> > > > d_patch_sp_residual_data;
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_sp_exchange_boxes;
+
+    /*
+     * The patch data index of the residual whose single-precision copy was
+     * retained by the most recent pre-smoothing sweeps on each level, or -1.
+     */
+    std::vector<int> d_patch_sp_residual_idx;
 };
 } // namespace IBTK
 
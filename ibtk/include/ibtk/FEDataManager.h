@@ -52,9 +52,12 @@
 #include "StandardTagAndInitStrategy.h"
 #include "VariableContext.h"
 #include "boost/multi_array.hpp"
+#include "ibtk/SpreadAccumulator.h"
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "petscis.h"
+#include "petscksp.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
 
@@ -332,11 +335,15 @@ public:
                 libMesh::NumericVector<double>& X,
                 const std::string& system_name,
                 RobinPhysBdryPatchStrategy* f_phys_bdry_op,
-                double fill_data_time);
+                double fill_data_time,
+                bool f_data_is_zero = false);
 
     /*!
      * \brief Spread a density from the FE mesh to the Cartesian grid using a
      * specified spreading spec.
+     *
+     * If \a f_data_is_zero is true, the caller guarantees that the Eulerian data
+     * are zero on entry, and no scratch data are used to preserve them.
      */
     void spread(int f_data_idx,
                 libMesh::NumericVector<double>& F,
@@ -344,7 +351,8 @@ public:
                 const std::string& system_name,
                 const SpreadSpec& spread_spec,
                 RobinPhysBdryPatchStrategy* f_phys_bdry_op,
-                double fill_data_time);
+                double fill_data_time,
+                bool f_data_is_zero = false);
 
     /*!
      * \brief Prolong a value or a density from the FE mesh to the Cartesian
@@ -405,6 +413,27 @@ public:
      */
     libMesh::NumericVector<double>* buildDiagonalL2MassMatrix(const std::string& system_name);
 
+    /*!
+     * \brief Set whether to compute consistent mass matrix L2 projections one
+     * variable at a time.
+     *
+     * In this mode, the mass matrix block associated with each variable of the
+     * system is extracted, and variables with identical blocks share a single
+     * solver.  The block preconditioners (by default, block Jacobi with exact
+     * local LU factorizations) are built only once and are reused until the
+     * DOF map of the system changes.  Solver options may be set at runtime
+     * using the prefix "fe_l2_proj_".
+     *
+     * \note By default, the full system mass matrix is used.
+     */
+    void setUseBlockL2ProjectionSolver(bool use_block_L2_proj_solver);
+
+    /*!
+     * \return Whether consistent mass matrix L2 projections are computed one
+     * variable at a time.
+     */
+    bool getUseBlockL2ProjectionSolver() const;
+
     /*!
      * \brief Set U to be the L2 projection of F.
      */
@@ -464,6 +493,24 @@ public:
                                            const boost::multi_array<double, 2>& X_node,
                                            double dx_min);
 
+    /*!
+     * \brief Set the relative hysteresis tolerance used when updating cached
+     * adaptive quadrature rules.
+     *
+     * The cached number of quadrature points per direction for an element is
+     * increased as soon as the deformed element requires more points, but it
+     * is only reduced once the required number of points falls below the
+     * threshold for the smaller rule by more than the specified relative
+     * tolerance.  The default tolerance is 0.1.
+     */
+    void setAdaptiveQuadratureHysteresis(double hysteresis);
+
+    /*!
+     * \brief Print statistics on the reuse of the cached quadrature rules used
+     * by spread() and interp().
+     */
+    void printQuadratureRuleCacheStatistics(std::ostream& os) const;
+
     /*!
      * \brief Update the cell workload estimate.
      */
@@ -630,6 +677,86 @@ private:
                                 const std::vector<libMesh::Elem*>& active_elems,
                                 const std::string& system_name);
 
+    /*!
+     * \brief Struct QuadratureRuleCache stores the quadrature rules used for
+     * each active element by spread() or interp().
+     *
+     * Quadrature rules are built and initialized once for each combination of
+     * quadrature order, element type, and p-refinement level, and are shared
+     * by all elements that use them.  For each element, the cache stores the
+     * rule last used for that element, along with the number of quadrature
+     * points per direction and the grid spacing that determined the rule.
+     */
+    struct QuadratureRuleCache
+    {
+        QuadratureRuleCache()
+            : quad_type(libMesh::INVALID_Q_RULE), quad_order(libMesh::INVALID_ORDER), use_adaptive_quadrature(false),
+              point_density(0.0), elem_qrule(), elem_npts(), elem_dx_min(), qrules(), num_lookups(0),
+              num_updates(0), num_rule_builds(0), num_resets(0)
+        {
+        }
+
+        libMesh::QuadratureType quad_type;
+        libMesh::Order quad_order;
+        bool use_adaptive_quadrature;
+        double point_density;
+        std::vector<libMesh::QBase*> elem_qrule;
+        std::vector<int> elem_npts;
+        std::vector<double> elem_dx_min;
+        std::map<std::pair<int, std::pair<int, int> >, libMesh::QBase*> qrules;
+        unsigned long num_lookups, num_updates, num_rule_builds, num_resets;
+    };
+
+    /*!
+     * Update the quadrature rule for the current element using the cached
+     * rules.  The returned rule is owned by the cache and is already
+     * initialized for the element type and p-refinement level of the element.
+     *
+     * \return true if the quadrature rule differs from the provided rule;
+     * false otherwise.
+     */
+    bool updateCachedQuadratureRule(libMesh::QBase*& qrule,
+                                    QuadratureRuleCache& cache,
+                                    libMesh::QuadratureType quad_type,
+                                    libMesh::Order quad_order,
+                                    bool use_adaptive_quadrature,
+                                    double point_density,
+                                    libMesh::Elem* elem,
+                                    const boost::multi_array<double, 2>& X_node,
+                                    double dx_min);
+
+    /*!
+     * Deallocate the cached quadrature rules and reset the per-element data.
+     */
+    static void clearQuadratureRuleCache(QuadratureRuleCache& cache);
+
+    /*!
+     * Build the per-variable solvers used to compute consistent mass matrix L2
+     * projections one variable at a time.
+     */
+    void buildL2ProjectionBlockSolvers(const std::string& system_name);
+
+    /*!
+     * Deallocate the per-variable L2 projection solvers for the specified
+     * system.
+     */
+    void clearL2ProjectionBlockSolvers(const std::string& system_name);
+
+    /*!
+     * Deallocate all cached L2 projection data for the specified system.
+     */
+    void clearL2ProjectionData(const std::string& system_name);
+
+    /*!
+     * Deallocate all cached L2 projection data for the specified system if the
+     * DOF map of the system has changed since the data were built.
+     *
+     * \note The global reduction used to detect changes is skipped when no
+     * L2 projection data are cached for the system and the block solvers are
+     * not in use.
+     */
+    void checkL2ProjectionData(const std::string& system_name);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -672,6 +799,11 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     int d_coarsest_ln, d_finest_ln;
 
+    /*
+     * Data used to accumulate values spread to the Cartesian grid.
+     */
+    SpreadAccumulator d_spread_accumulator;
+
     /*
      * SAMRAI::hier::VariableContext object used for data management.
      */
@@ -733,6 +865,24 @@ private:
     std::map<std::string, libMesh::NumericVector<double>*> d_L2_proj_matrix_diag;
     std::map<std::string, libMesh::QuadratureType> d_L2_proj_quad_type;
     std::map<std::string, libMesh::Order> d_L2_proj_quad_order;
+    std::map<std::string, std::vector<unsigned int> > d_L2_proj_dof_map_signature;
+
+    /*
+     * Per-variable solvers and related data for computing consistent mass
+     * matrix L2 projections one variable at a time.  Each variable is
+     * associated with an index set that selects its DOFs and with the index of
+     * the solver used for that variable.
+     */
+    bool d_use_block_L2_proj_solver;
+    std::map<std::string, std::vector<IS> > d_L2_proj_block_is;
+    std::map<std::string, std::vector<int> > d_L2_proj_block_ksp_idx;
+    std::map<std::string, std::vector<KSP> > d_L2_proj_block_ksp;
+
+    /*
+     * Cached quadrature rules used by spread() and interp().
+     */
+    QuadratureRuleCache d_spread_qrule_cache, d_interp_qrule_cache;
+    double d_adaptive_quad_hysteresis;
 };
 } // namespace IBTK
 
@@ -59,6 +59,7 @@
 #include "VisItDataWriter.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/SolverTelemetryManager.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Array.h"
 #include "tbox/Pointer.h"
@@ -261,6 +262,18 @@ public:
      */
     bool stepsRemaining() const;
 
+    /*!
+     * Return the solver telemetry summaries for the most recently completed
+     * time step for all solvers owned by this integrator and its child
+     * integrators.
+     *
+     * Solvers are associated with an integrator by their object names, which
+     * are required to have the form "<integrator object name>::<solver name>".
+     *
+     * \see SolverTelemetryManager
+     */
+    void getSolverTelemetry(std::vector<SolverTelemetryManager::TimeStepSummary>& summaries) const;
+
     /*!
      * Return a pointer to the patch hierarchy managed by the integrator.
      */
@@ -900,6 +913,24 @@ protected:
      */
     RegridMode d_regrid_mode;
 
+    /*
+     * Measured costs associated with regridding.  The wall clock time required
+     * by the most recent regrid operation is recorded, along with the
+     * accumulated cost of advancing the solution on a "stale" grid since that
+     * regrid.  The stale grid cost is estimated as the sum over all time steps
+     * since the last regrid of the difference between the wall clock time
+     * required by each time step and the smallest per-step wall clock time
+     * observed since the last regrid.
+     *
+     * NOTE: All times are the maximum over all MPI processes, so that the
+     * effects of load imbalance are included in the estimates.  Because this
+     * requires a global reduction in every time step, the costs are measured
+     * only when d_measure_regrid_costs is set by a subclass.
+     */
+    bool d_measure_regrid_costs;
+    double d_regrid_wall_time, d_min_step_wall_time_since_regrid, d_stale_grid_cost_since_regrid;
+    int d_num_steps_since_regrid;
+
     /*
      * Indicates whether the integrator should output logging messages.
      */
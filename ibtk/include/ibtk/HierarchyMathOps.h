@@ -812,6 +812,50 @@ public:
                  int src2_idx = -1,
                  SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src2_var = NULL);
 
+    /*!
+     * \brief Compute the action of the MAC discretization of the Stokes
+     * operator.
+     *
+     * Sets dst_u = C src_u + div D grad src_u + gamma grad src_p and dst_p =
+     * delta div src_u, where C and D are specified by the
+     * SAMRAI::solv::PoissonSpecifications object poisson_spec.
+     *
+     * This operation yields the same result as separate calls to grad(),
+     * laplace(), and div(), except that all of the quantities are computed in
+     * a single sweep over each patch.  The coarse-fine interface values of
+     * src_u are synchronized before ghost cell values are filled, and the
+     * coarse-fine interface values of dst_u are synchronized level-by-level as
+     * part of the sweep.  Because the synchronized values of src_u are used by
+     * the Laplacian as well as by the divergence, the coarse-level Laplacian
+     * next to the coarse-fine interface uses the averaged fine-level velocity
+     * there.
+     *
+     * \note The coarse-fine interface values of src_u are overwritten by the
+     * synchronized values.  Callers that must not modify src_u should provide
+     * a scratch copy along with a ghost cell filling operator that fills the
+     * scratch data in place.
+     *
+     * \note The present implementation of this operator \em requires that
+     * damping factor C and diffusivity D be spatially constant and
+     * scalar-valued.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void stokes(int dst_u_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > dst_u_var,
+                int dst_p_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > dst_p_var,
+                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                int src_u_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src_u_var,
+                int src_p_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > src_p_var,
+                SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+                double src_ghost_fill_time,
+                double gamma = 1.0,
+                double delta = -1.0);
+
     /*!
      * \brief Compute dst = alpha div coef ((grad src1) + (grad src1)^T) + beta
      * src1 + gamma src2, the variable coefficient generalized Laplacian of
@@ -36,6 +36,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <vector>
 
 #include "IntVector.h"
 #include "SAMRAIVectorReal.h"
@@ -56,6 +57,9 @@ namespace IBTK
  * \brief Class KrylovLinearSolver provides an abstract interface for the
  * implementation of Krylov subspace solvers for linear problems of the form
  * \f$Ax=b\f$.
+ *
+ * Implementations may optionally retain a small recycled subspace across
+ * successive solves with the same operator; see setRecycledSubspaceSize().
  */
 class KrylovLinearSolver : public LinearSolver
 {
@@ -128,12 +132,73 @@ public:
 
     //\}
 
+    /*!
+     * \name Krylov subspace recycling.
+     */
+    //\{
+
+    /*!
+     * \brief Set the maximum number of vectors retained in the recycled
+     * subspace.
+     *
+     * When the size is positive, the correction computed by each solve is
+     * retained along with its image under the operator, and each subsequent
+     * solve begins by minimizing the initial residual over the span of the
+     * retained vectors, as in the initial projection step of GCRO-DR-type
+     * recycling methods.  The recycled subspace is discarded whenever the
+     * solver state is deallocated, e.g., when the solver is reinitialized
+     * following regridding.  A size of zero disables recycling.
+     */
+    void setRecycledSubspaceSize(int recycled_subspace_size);
+
+    /*!
+     * \brief Get the maximum number of vectors retained in the recycled
+     * subspace.
+     */
+    int getRecycledSubspaceSize() const;
+
+    /*!
+     * \brief Discard all vectors in the recycled subspace.
+     */
+    void resetRecycledSubspace();
+
+    //\}
+
 protected:
+    /*!
+     * \brief Improve the initial guess \a x by minimizing the residual of
+     * \f$Ax=b\f$ over the recycled subspace.
+     *
+     * The operator must be configured to use homogeneous boundary conditions,
+     * and \a b must already account for any inhomogeneous boundary conditions.
+     * The resulting initial guess is retained for use by
+     * updateRecycledSubspace().
+     *
+     * \return Whether the initial guess was modified.
+     */
+    bool projectOntoRecycledSubspace(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                     SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Add the correction computed by the most recent solve to the
+     * recycled subspace.
+     *
+     * This function must be called after projectOntoRecycledSubspace() and
+     * before the boundary condition configuration of the operator is reset.
+     */
+    void updateRecycledSubspace(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x);
+
     // Solver components.
     SAMRAI::tbox::Pointer<LinearOperator> d_A;
     SAMRAI::tbox::Pointer<LinearSolver> d_pc_solver;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_x, d_b;
 
+    // Recycled subspace.  The images of the retained corrections under the
+    // operator are orthonormal.
+    int d_recycled_subspace_size;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_recycled_U, d_recycled_C;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_recycled_x0, d_recycled_r;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -99,8 +99,11 @@ public:
 
     /*!
      * \brief Constructor.
+     *
+     * \note If the data values were written to an external snapshot buffer by
+     * putToDatabase(), the same buffer must be provided here.
      */
-    LData(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
+    LData(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db, const std::vector<double>* vals_snapshot = NULL);
 
     /*!
      * \brief Virtual destructor.
@@ -297,6 +300,16 @@ public:
      */
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * \brief Write out object metadata to the given database, and append the
+     * (ghosted) data values to the provided snapshot buffer.
+     *
+     * The offset of the data values within the snapshot buffer is recorded in
+     * the database so that the values may be recovered by the restart
+     * constructor.
+     */
+    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db, std::vector<double>& vals_snapshot);
+
 private:
     /*!
      * \brief Default constructor.
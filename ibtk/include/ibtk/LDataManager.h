@@ -61,6 +61,8 @@
 #include "ibtk/LNodeSetVariable.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/SpreadAccumulator.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscao.h"
 #include "petscvec.h"
@@ -269,6 +271,9 @@ public:
      *
      * This is the standard regularized delta function spreading operation,
      * which spreads densities, \em NOT values.
+     *
+     * If \a f_data_is_zero is true, the caller guarantees that the Eulerian data
+     * are zero on entry, and no scratch data are used to preserve them.
      */
     void spread(int f_data_idx,
                 std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
@@ -282,7 +287,8 @@ public:
                 bool X_data_ghost_node_update = true,
                 bool ds_data_ghost_node_update = true,
                 int coarsest_ln = -1,
-                int finest_ln = -1);
+                int finest_ln = -1,
+                bool f_data_is_zero = false);
 
     /*!
      * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
@@ -296,6 +302,9 @@ public:
      *
      * This is the standard regularized delta function spreading operation,
      * which spreads densities, \em NOT values.
+     *
+     * If \a f_data_is_zero is true, the caller guarantees that the Eulerian data
+     * are zero on entry, and no scratch data are used to preserve them.
      */
     void spread(int f_data_idx,
                 std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
@@ -310,7 +319,8 @@ public:
                 bool X_data_ghost_node_update = true,
                 bool ds_data_ghost_node_update = true,
                 int coarsest_ln = -1,
-                int finest_ln = -1);
+                int finest_ln = -1,
+                bool f_data_is_zero = false);
 
     /*!
      * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
@@ -373,6 +383,9 @@ public:
      *
      * Unlike the standard regularized delta function spreading operation, the
      * implemented operation spreads values, \em NOT densities.
+     *
+     * If \a f_data_is_zero is true, the caller guarantees that the Eulerian data
+     * are zero on entry, and no scratch data are used to preserve them.
      */
     void spread(int f_data_idx,
                 std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
@@ -384,7 +397,8 @@ public:
                 bool F_data_ghost_node_update = true,
                 bool X_data_ghost_node_update = true,
                 int coarsest_ln = -1,
-                int finest_ln = -1);
+                int finest_ln = -1,
+                bool f_data_is_zero = false);
 
     /*!
      * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
@@ -398,6 +412,9 @@ public:
      *
      * Unlike the standard regularized delta function spreading operation, the
      * implemented operation spreads values, \em NOT densities.
+     *
+     * If \a f_data_is_zero is true, the caller guarantees that the Eulerian data
+     * are zero on entry, and no scratch data are used to preserve them.
      */
     void spread(int f_data_idx,
                 std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
@@ -410,7 +427,8 @@ public:
                 bool F_data_ghost_node_update = true,
                 bool X_data_ghost_node_update = true,
                 int coarsest_ln = -1,
-                int finest_ln = -1);
+                int finest_ln = -1,
+                bool f_data_is_zero = false);
 
     /*!
      * \brief Interpolate a quantity from the Eulerian grid to the Lagrangian
@@ -888,6 +906,50 @@ public:
                                bool initial_time,
                                bool uses_richardson_extrapolation_too);
 
+    /*!
+     * \brief Set the ordering used for the local Lagrangian nodes.
+     *
+     * By default (PATCH_ORDERING), local nodes are numbered patch-by-patch in
+     * the order in which they are stored in each patch.  MORTON_ORDERING and
+     * HILBERT_ORDERING sort the local nodes along a space-filling curve through
+     * the Cartesian grid cells that contain them, and LAGRANGIAN_INDEX_ORDERING
+     * sorts them by Lagrangian index, which typically keeps connected nodes
+     * close together in memory.
+     *
+     * \note The ordering is applied whenever the Lagrangian data are
+     * redistributed.
+     */
+    void setNodeOrdering(LNodeOrderingType node_ordering);
+
+    /*!
+     * \brief Get the ordering used for the local Lagrangian nodes.
+     */
+    LNodeOrderingType getNodeOrdering() const;
+
+    /*!
+     * \brief Enable or disable asynchronous checkpointing of the Lagrangian
+     * data.
+     *
+     * When asynchronous checkpointing is enabled, putToDatabase() only writes
+     * small metadata to the restart database.  The values of the managed LData
+     * are instead copied into an in-memory snapshot buffer, which is streamed
+     * to a per-processor file in the specified directory by a background
+     * thread while the computation continues.  Lagrangian structure metadata
+     * (names, IDs, index ranges, and activation state) are written to a
+     * separate file only when they have changed since the previous checkpoint.
+     *
+     * \note The checkpoint directory must remain accessible (and its contents
+     * must not be removed) for as long as the corresponding restart files are
+     * to be used.
+     */
+    void setAsynchronousCheckpointing(bool use_async_checkpointing, const std::string& checkpoint_dirname = "");
+
+    /*!
+     * \brief Block until any outstanding asynchronous checkpoint has been
+     * completely written to disk.
+     */
+    void waitForAsynchronousCheckpoint();
+
     /*!
      * Write out object state to the given database.
      *
@@ -1000,6 +1062,23 @@ private:
      */
     static void computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, unsigned int num_local_nodes);
 
+    /*!
+     * Write the Lagrangian structure metadata for all levels to the provided
+     * buffer.
+     */
+    void packStructureMetadata(std::vector<char>& buffer) const;
+
+    /*!
+     * Read the Lagrangian structure metadata for all levels from the specified
+     * file.
+     */
+    void readStructureMetadata(const std::string& filename);
+
+    /*!
+     * Entry point for the thread that writes out asynchronous checkpoint data.
+     */
+    static void* writeAsynchronousCheckpoint(void* job);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1038,6 +1117,11 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geom;
     int d_coarsest_ln, d_finest_ln;
 
+    /*
+     * Persistent data used to accumulate values spread to the Cartesian grid.
+     */
+    SpreadAccumulator d_spread_accumulator;
+
     /*
      * We cache a pointer to the visualization data writers to register plot
      * variables.
@@ -1157,6 +1241,25 @@ private:
     std::vector<AO> d_ao;
     static std::vector<int> s_ao_dummy;
 
+    /*!
+     * The ordering used for the local Lagrangian nodes.
+     */
+    LNodeOrderingType d_node_ordering;
+
+    /*!
+     * Data related to asynchronous checkpointing.  The structure metadata
+     * version number is incremented whenever the Lagrangian structure metadata
+     * are modified, so that unmodified metadata are not rewritten at each
+     * checkpoint.
+     */
+    struct AsyncCheckpointJob;
+    bool d_use_async_checkpointing;
+    std::string d_async_checkpoint_dirname;
+    int d_async_checkpoint_counter;
+    AsyncCheckpointJob* d_async_checkpoint_job;
+    int d_strct_metadata_version, d_strct_metadata_checkpoint_version;
+    std::string d_strct_metadata_checkpoint_filename;
+
     /*!
      * The total number of nodes for all processors.
      */
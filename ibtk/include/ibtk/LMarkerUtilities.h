@@ -54,6 +54,8 @@ namespace hier
 template <int DIM>
 class BasePatchLevel;
 template <int DIM>
+class Patch;
+template <int DIM>
 class PatchHierarchy;
 } // namespace hier
 } // namespace SAMRAI
@@ -123,6 +125,46 @@ public:
                                 int coarsest_ln = -1,
                                 int finest_ln = -1);
 
+    /*!
+     * Advect all markers by the specified advection velocity using the
+     * three-stage, third-order strong-stability-preserving Runge-Kutta method
+     * of Shu and Osher.  The stage velocities are interpolated from the
+     * velocity fields at the beginning, middle, and end of the time step.
+     *
+     * \note Unlike midpointStep() and trapezoidalStep(), this function does
+     * not require an initial call to eulerStep().
+     */
+    static void ssprk3Step(int mark_current_idx,
+                           int mark_new_idx,
+                           int u_current_idx,
+                           int u_half_idx,
+                           int u_new_idx,
+                           double dt,
+                           const std::string& weighting_fcn,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int coarsest_ln = -1,
+                           int finest_ln = -1);
+
+    /*!
+     * Advect all markers by the specified advection velocity using the classical
+     * four-stage, fourth-order Runge-Kutta method.  The stage velocities are
+     * interpolated from the velocity fields at the beginning, middle, and end
+     * of the time step.
+     *
+     * \note Unlike midpointStep() and trapezoidalStep(), this function does
+     * not require an initial call to eulerStep().
+     */
+    static void rk4Step(int mark_current_idx,
+                        int mark_new_idx,
+                        int u_current_idx,
+                        int u_half_idx,
+                        int u_new_idx,
+                        double dt,
+                        const std::string& weighting_fcn,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                        int coarsest_ln = -1,
+                        int finest_ln = -1);
+
     /*!
      * Collect all marker data onto the coarsest level of the patch hierarchy
      * (to prepare for regridding the patch hierarchy).
@@ -130,6 +172,41 @@ public:
     static void collectMarkersOnPatchHierarchy(int mark_idx,
                                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
 
+    /*!
+     * Remove all marker data from the patch hierarchy (to prepare for
+     * regridding the patch hierarchy).  The indices, positions, and velocities
+     * of the markers that are owned by the local patches are stored in the
+     * provided vectors, which are later passed to endMarkerRedistribution().
+     *
+     * Unlike collectMarkersOnPatchHierarchy(), this function does not move any
+     * marker data between processors.
+     */
+    static void beginMarkerRedistribution(std::vector<int>& mark_idxs,
+                                          std::vector<double>& X_mark,
+                                          std::vector<double>& U_mark,
+                                          int mark_idx,
+                                          SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * Send each of the markers collected by beginMarkerRedistribution() to the
+     * processor that owns the patch that contains the marker on the finest
+     * level of the (regridded) patch hierarchy that covers the marker, and
+     * insert the markers into the marker data on that level.
+     *
+     * Markers are moved by a single sparse exchange in which each processor
+     * communicates only with the processors that it sends markers to or
+     * receives markers from.  Markers are never collected on the coarsest
+     * level of the patch hierarchy, and so it is not necessary to call
+     * pruneInvalidMarkers() after calling this function.
+     *
+     * \note The vectors are cleared by this function.
+     */
+    static void endMarkerRedistribution(std::vector<int>& mark_idxs,
+                                        std::vector<double>& X_mark,
+                                        std::vector<double>& U_mark,
+                                        int mark_idx,
+                                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
     /*!
      * Initialize marker data on the specified level of the patch hierarchy by
      * refining markers from coarser levels in the patch hierarchy or by copying
@@ -199,29 +276,42 @@ private:
      */
     static unsigned int countMarkersOnPatch(SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
 
+    /*!
+     * Collect pointers to the markers in the interior of a patch into a single
+     * vector, so that the marker data need only be traversed once per time
+     * step.
+     */
+    static void collectMarkersOnPatch(std::vector<LMarker*>& marks, SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+
     /*!
      * Collect marker positions into a single vector.
      */
-    static void collectMarkerPositionsOnPatch(std::vector<double>& X_mark,
-                                              SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+    static void collectMarkerPositions(std::vector<double>& X_mark, const std::vector<LMarker*>& marks);
 
     /*!
      * Reset marker positions from a single vector.
      */
-    static void resetMarkerPositionsOnPatch(const std::vector<double>& X_mark,
-                                            SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+    static void resetMarkerPositions(const std::vector<double>& X_mark, const std::vector<LMarker*>& marks);
 
     /*!
      * Collect marker velocities into a single vector.
      */
-    static void collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark,
-                                               SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+    static void collectMarkerVelocities(std::vector<double>& U_mark, const std::vector<LMarker*>& marks);
 
     /*!
      * Reset marker velocities from a single vector.
      */
-    static void resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark,
-                                             SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+    static void resetMarkerVelocities(const std::vector<double>& U_mark, const std::vector<LMarker*>& marks);
+
+    /*!
+     * Interpolate the specified velocity field to the specified marker
+     * positions.
+     */
+    static void interpolateMarkerVelocities(std::vector<double>& U_mark,
+                                            const std::vector<double>& X_mark,
+                                            int u_idx,
+                                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                            const std::string& weighting_fcn);
 
     /*!
      * Prevent markers from leaving the computational domain through physical
@@ -111,6 +111,7 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ recycled_subspace_size = 0    // see setRecycledSubspaceSize()
  \endverbatim
  *
  * PETSc is developed in the Mathematics and Computer Science (MCS) Division at
@@ -418,6 +419,8 @@ private:
     bool d_user_provided_mat;
     bool d_user_provided_pc;
 
+    std::vector<PetscReal> d_residual_history;
+
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_nullspace_constant_vec;
     Vec d_petsc_nullspace_constant_vec;
     std::vector<Vec> d_petsc_nullspace_basis_vecs;
@@ -79,8 +79,35 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ use_schwarz_preconditioner = FALSE
+ schwarz_type = "RESTRICTED"   // "ADDITIVE", "RESTRICTED", or "INTERPOLATE"
+ schwarz_overlap = 1
+ schwarz_subdomain_pc_type = "lu"
+ use_agglomeration = FALSE
+ agglomeration_num_procs = 1
+ agglomeration_pc_type = "lu"
  \endverbatim
  *
+ * When use_schwarz_preconditioner is set, the level solver is preconditioned
+ * by an overlapping Schwarz method whose subdomains are the local patches of
+ * the level, grown by schwarz_overlap layers of the matrix graph.  Each
+ * subdomain matrix is factored once when the solver state is initialized, and
+ * the factorizations are reused until the solver state is deallocated (e.g.,
+ * following a regrid).  Subdomain solver settings may be further adjusted at
+ * runtime via the PETSc options database using the "sub_" options prefix.
+ *
+ * When use_agglomeration is set, the level system is gathered onto
+ * subcommunicators of agglomeration_num_procs processes, solved there using
+ * agglomeration_pc_type, and the solution is scattered back to the processes
+ * that own the level data.  This is intended for small (e.g., coarsest level)
+ * systems distributed over many processes, for which the cost of a distributed
+ * solve is dominated by communication latency.  With the default "lu" setting,
+ * the gathered matrix is factored once when the solver state is initialized,
+ * and the factorization is reused until the solver state is deallocated.  In
+ * this case, ksp_type = "preonly" is usually appropriate.  The gathered solver
+ * may be further adjusted at runtime via the PETSc options database using the
+ * "redundant_" options prefix.
+ *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
  * Computer Science Division.  For more information about \em PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -272,6 +299,18 @@ protected:
      */
     virtual void setupNullspace();
 
+    /*!
+     * \brief Generate the degrees of freedom associated with each Schwarz
+     * subdomain.
+     *
+     * Each entry of \a subdomain_dofs is to be set to the locally owned DOF
+     * indices associated with a single local patch.  Subdomain overlap is
+     * added by PETSc.
+     *
+     * \note The default implementation emits an unrecoverable runtime error.
+     */
+    virtual void generateSchwarzSubdomains(std::vector<std::vector<int> >& subdomain_dofs);
+
     /*!
      * \brief Associated hierarchy.
      */
@@ -294,6 +333,25 @@ protected:
     Vec d_petsc_x, d_petsc_b;
     //\}
 
+    /*!
+     * \name Patch-based Schwarz preconditioner settings.
+     */
+    //\{
+    bool d_use_schwarz_pc;
+    std::string d_schwarz_type;
+    int d_schwarz_overlap;
+    std::string d_schwarz_subdomain_pc_type;
+    //\}
+
+    /*!
+     * \name Agglomeration settings.
+     */
+    //\{
+    bool d_use_agglomeration;
+    int d_agglomeration_num_procs;
+    std::string d_agglomeration_pc_type;
+    //\}
+
 private:
     /*!
      * \brief Copy constructor.
@@ -314,6 +372,29 @@ private:
      * \return A reference to this object.
      */
     PETScLevelSolver& operator=(const PETScLevelSolver& that);
+
+    /*!
+     * \brief Configure the PETSc preconditioner as an overlapping Schwarz
+     * method on the patches of the level.
+     */
+    void setupSchwarzPreconditioner();
+
+    /*!
+     * \brief Configure and factor the subdomain solvers of the Schwarz
+     * preconditioner.
+     */
+    void setupSchwarzSubdomainSolvers();
+
+    /*!
+     * \brief Configure the PETSc preconditioner to gather the level system onto
+     * subcommunicators and to solve it there.
+     */
+    void setupAgglomeratedPreconditioner();
+
+    /*!
+     * \brief Gather and factor the agglomerated level system.
+     */
+    void setupAgglomeratedSolver();
 };
 } // namespace IBTK
 
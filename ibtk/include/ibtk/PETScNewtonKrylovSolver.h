@@ -37,6 +37,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 #include "ibtk/NewtonKrylovSolver.h"
 #include "mpi.h"
@@ -387,6 +388,9 @@ private:
     bool d_managing_petsc_snes;
     bool d_user_provided_function;
     bool d_user_provided_jacobian;
+
+    std::vector<PetscReal> d_residual_history;
+    std::vector<PetscInt> d_residual_history_its;
 };
 } // namespace IBTK
 
@@ -122,6 +122,21 @@ public:
                                               int dof_index_idx,
                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 
+    /*!
+     * \brief Append the locally owned DOF indices of each local patch of a
+     * SAMRAI::hier::PatchLevel to the corresponding entry of \a
+     * subdomain_dofs.
+     *
+     * The entries of \a subdomain_dofs are ordered in the same way as the
+     * local patches of the level, so that DOF indices from multiple variables
+     * may be accumulated by repeated calls.
+     */
+    static void
+    constructPatchLevelSchwarzSubdomains(std::vector<std::vector<int> >& subdomain_dofs,
+                                         const std::vector<int>& num_dofs_per_proc,
+                                         int dof_index_idx,
+                                         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     //\}
 
 protected:
@@ -200,6 +215,26 @@ private:
     static void constructPatchLevelDOFIndices_side(std::vector<int>& num_dofs_proc,
                                                    int dof_index_idx,
                                                    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
+    /*!
+     * \brief Implementation of constructPatchLevelSchwarzSubdomains() for
+     * cell-centered data.
+     */
+    static void
+    constructPatchLevelSchwarzSubdomains_cell(std::vector<std::vector<int> >& subdomain_dofs,
+                                              const std::vector<int>& num_dofs_per_proc,
+                                              int dof_index_idx,
+                                              SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
+    /*!
+     * \brief Implementation of constructPatchLevelSchwarzSubdomains() for
+     * side-centered data.
+     */
+    static void
+    constructPatchLevelSchwarzSubdomains_side(std::vector<std::vector<int> >& subdomain_dofs,
+                                              const std::vector<int>& num_dofs_per_proc,
+                                              int dof_index_idx,
+                                              SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 };
 } // namespace IBTK
 
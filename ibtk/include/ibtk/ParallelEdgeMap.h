@@ -37,6 +37,7 @@
 
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "tbox/DescribedClass.h"
 
@@ -47,14 +48,24 @@ namespace IBTK
 /*!
  * \brief Class ParallelEdgeMap is a utility class for managing edge maps (i.e.,
  * maps from vertices to links between vertices) in parallel.
+ *
+ * By default, the edge map is replicated on every MPI process, and the pending
+ * additions and removals of each process are communicated to all processes.
+ * When distributed storage is requested, each link is stored only on the
+ * process that owns its master index (see getOwnerRank()), the pending
+ * additions and removals are sent only to the owning processes, and links owned
+ * by other processes may be queried via findEdges().
  */
 class ParallelEdgeMap : public SAMRAI::tbox::DescribedClass
 {
 public:
     /*!
      * \brief Default constructor.
+     *
+     * \param use_distributed_storage Whether to store each link only on the MPI
+     * process that owns its master index instead of on every MPI process.
      */
-    ParallelEdgeMap();
+    explicit ParallelEdgeMap(bool use_distributed_storage = false);
 
     /*!
      * \brief Destructor.
@@ -97,9 +108,33 @@ public:
 
     /*!
      * \brief Return a const reference to the edge map.
+     *
+     * \note When distributed storage is used, the edge map contains only those
+     * links whose master indices are owned by the present MPI process.
      */
     const std::multimap<int, std::pair<int, int> >& getEdgeMap() const;
 
+    /*!
+     * \brief Return whether the edge map is distributed across MPI processes
+     * rather than replicated on every MPI process.
+     */
+    bool usesDistributedStorage() const;
+
+    /*!
+     * \brief Return the rank of the MPI process that owns the specified master
+     * index when distributed storage is used.
+     */
+    int getOwnerRank(int mastr_idx) const;
+
+    /*!
+     * \brief Retrieve the links associated with the specified master indices.
+     *
+     * \note When distributed storage is used, this method is collective (i.e.,
+     * it must be called by all MPI tasks), and the links are retrieved from the
+     * processes that own the master indices.
+     */
+    void findEdges(std::multimap<int, std::pair<int, int> >& edges, const std::vector<int>& mastr_idxs) const;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -121,7 +156,14 @@ private:
      */
     ParallelEdgeMap& operator=(const ParallelEdgeMap& that);
 
+    /*!
+     * \brief Send the pending additions and removals to the owning processes
+     * and update the locally owned links.
+     */
+    void communicateDistributedData();
+
     // Member data.
+    bool d_use_distributed_storage;
     std::multimap<int, std::pair<int, int> > d_edge_map;
     std::multimap<int, std::pair<int, int> > d_pending_additions, d_pending_removals;
 };
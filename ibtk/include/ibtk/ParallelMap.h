@@ -53,14 +53,24 @@ namespace IBTK
 /*!
  * \brief Class ParallelMap is a utility class for associating integer keys with
  * arbitrary data items in parallel.
+ *
+ * By default, the map is replicated on every MPI process, and the pending
+ * additions and removals of each process are broadcast to all processes.  When
+ * distributed storage is requested, each item is stored only on the process
+ * that owns its key (see getOwnerRank()), the pending additions and removals are
+ * sent only to the owning processes, and items owned by other processes may be
+ * queried via findItems().
  */
 class ParallelMap : public SAMRAI::tbox::DescribedClass
 {
 public:
     /*!
      * \brief Default constructor.
+     *
+     * \param use_distributed_storage Whether to store each item only on the MPI
+     * process that owns its key instead of on every MPI process.
      */
-    ParallelMap();
+    explicit ParallelMap(bool use_distributed_storage = false);
 
     /*!
      * \brief Copy constructor.
@@ -116,11 +126,43 @@ public:
 
     /*!
      * \brief Return a const reference to the map.
+     *
+     * \note When distributed storage is used, the map contains only those items
+     * whose keys are owned by the present MPI process.
      */
     const std::map<int, SAMRAI::tbox::Pointer<Streamable> >& getMap() const;
 
+    /*!
+     * \brief Return whether the map is distributed across MPI processes rather
+     * than replicated on every MPI process.
+     */
+    bool usesDistributedStorage() const;
+
+    /*!
+     * \brief Return the rank of the MPI process that owns the specified key when
+     * distributed storage is used.
+     */
+    int getOwnerRank(int key) const;
+
+    /*!
+     * \brief Retrieve the items associated with the specified keys.  Keys that
+     * are not in the map are ignored.
+     *
+     * \note When distributed storage is used, this method is collective (i.e.,
+     * it must be called by all MPI tasks), and each item is retrieved from the
+     * process that owns its key.
+     */
+    void findItems(std::map<int, SAMRAI::tbox::Pointer<Streamable> >& items, const std::vector<int>& keys) const;
+
 private:
+    /*!
+     * \brief Send the pending additions and removals to the owning processes
+     * and update the locally owned items.
+     */
+    void communicateDistributedData();
+
     // Member data.
+    bool d_use_distributed_storage;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_map;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_pending_additions;
     std::vector<int> d_pending_removals;
@@ -47,14 +47,24 @@ namespace IBTK
 /*!
  * \brief Class ParallelSet is a utility class for storing collections of
  * integer keys in parallel.
+ *
+ * By default, the set is replicated on every MPI process, and the pending
+ * additions and removals of each process are broadcast to all processes.  When
+ * distributed storage is requested, each key is stored only on the process that
+ * owns it (see getOwnerRank()), the pending additions and removals are sent
+ * only to the owning processes, and keys owned by other processes may be
+ * queried via findItems().
  */
 class ParallelSet : public SAMRAI::tbox::DescribedClass
 {
 public:
     /*!
      * \brief Default constructor.
+     *
+     * \param use_distributed_storage Whether to store each key only on the MPI
+     * process that owns it instead of on every MPI process.
      */
-    ParallelSet();
+    explicit ParallelSet(bool use_distributed_storage = false);
 
     /*!
      * \brief Copy constructor.
@@ -110,11 +120,42 @@ public:
 
     /*!
      * \brief Return a const reference to the set.
+     *
+     * \note When distributed storage is used, the set contains only those keys
+     * that are owned by the present MPI process.
      */
     const std::set<int>& getSet() const;
 
+    /*!
+     * \brief Return whether the set is distributed across MPI processes rather
+     * than replicated on every MPI process.
+     */
+    bool usesDistributedStorage() const;
+
+    /*!
+     * \brief Return the rank of the MPI process that owns the specified key when
+     * distributed storage is used.
+     */
+    int getOwnerRank(int key) const;
+
+    /*!
+     * \brief Determine which of the specified keys are in the set.
+     *
+     * \note When distributed storage is used, this method is collective (i.e.,
+     * it must be called by all MPI tasks), and each key is looked up on the
+     * process that owns it.
+     */
+    void findItems(std::set<int>& found_keys, const std::vector<int>& keys) const;
+
 private:
+    /*!
+     * \brief Send the pending additions and removals to the owning processes
+     * and update the locally owned keys.
+     */
+    void communicateDistributedData();
+
     // Member data.
+    bool d_use_distributed_storage;
     std::set<int> d_set;
     std::vector<int> d_pending_additions, d_pending_removals;
 };
@@ -409,6 +409,26 @@ public:
                     int m = 0,
                     int n = 0) const;
 
+    /*!
+     * \brief Computes the action of the MAC discretization of the Stokes
+     * operator, i.e., dst_u = alpha L src_u + beta src_u + gamma grad src_p
+     * and dst_p = delta div src_u.
+     *
+     * All four quantities are computed in a single sweep over the patch, so
+     * that src_u and src_p are read from memory only once.
+     *
+     * \note src_u and src_p must provide at least one layer of ghost cells.
+     */
+    void stokes(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dst_u,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dst_p,
+                double alpha,
+                double beta,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src_u,
+                double gamma,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src_p,
+                double delta,
+                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
     /*!
      * \brief Compute dst_i = alpha src1_j + beta src2_k, pointwise.
      */
@@ -0,0 +1,216 @@
+// Filename: PatchTaskList.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_PatchTaskList
+#define included_PatchTaskList
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "Patch.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// MACROS ///////////////////////////////////////
+
+/*!
+ * \brief Annotate a loop over the entries of a PatchTaskList so that the
+ * patches are processed concurrently when IBTK is compiled with OpenMP
+ * support.
+ *
+ * Typical usage:\code
+ const PatchTaskList patches(level);
+ IBTK_PATCH_TASK_LOOP(patches)
+ for (int k = 0; k < patches.size(); ++k)
+ {
+     const Pointer<Patch<NDIM> >& patch = patches[k];
+     ...
+ }
+ \endcode
+ *
+ * \note The body of the loop must only modify data associated with the
+ * current patch.
+ */
+#if defined(_OPENMP)
+#define IBTK_PRAGMA(x) _Pragma(#x)
+#define IBTK_PATCH_TASK_LOOP(patches)                                                                                  \
+    IBTK_PRAGMA(omp parallel for schedule(dynamic, IBTK::PatchTaskList::getGrainSize())                                \
+                    num_threads(IBTK::PatchTaskList::getNumberOfThreads()) if ((patches).useThreads()))
+#else
+#define IBTK_PATCH_TASK_LOOP(patches)
+#endif
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchTaskList provides the local patches of a
+ * SAMRAI::hier::PatchLevel as a list of independent tasks that may be
+ * processed concurrently by a pool of threads.
+ *
+ * Patches are ordered by decreasing size, and idle threads dynamically take
+ * the next available group of getGrainSize() patches.  This balances the load
+ * among threads when patch sizes are uneven.  Levels with fewer than
+ * getMinimumNumberOfCells() local cells are processed serially.
+ *
+ * \note Threading is only enabled when IBTK is compiled with OpenMP support,
+ * i.e., when IBTK is configured with --enable-openmp.  Otherwise, all patches
+ * are processed serially by the calling thread.  The
+ * OpenMP runtime keeps its thread pool alive between parallel regions.
+ */
+class PatchTaskList
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    PatchTaskList(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchTaskList();
+
+    /*!
+     * \brief Return the number of local patches.
+     */
+    int size() const;
+
+    /*!
+     * \brief Return the kth local patch.
+     */
+    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >& operator[](int k) const;
+
+    /*!
+     * \brief Return whether the patches should be processed by multiple
+     * threads.
+     */
+    bool useThreads() const;
+
+    /*!
+     * \brief Apply a task to each local patch.
+     *
+     * The task object must provide a thread-safe method with the signature
+     * \code
+     void operator()(const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >& patch) const
+     \endcode
+     */
+    template <class PatchTask>
+    static void forEachLocalPatch(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                                  const PatchTask& task);
+
+    /*!
+     * \brief Set the number of threads used to process patches.  A
+     * nonpositive value indicates that the OpenMP default should be used.
+     */
+    static void setNumberOfThreads(int num_threads);
+
+    /*!
+     * \brief Return the number of threads used to process patches.
+     */
+    static int getNumberOfThreads();
+
+    /*!
+     * \brief Set the number of patches assigned to a thread at a time.
+     */
+    static void setGrainSize(int grain_size);
+
+    /*!
+     * \brief Return the number of patches assigned to a thread at a time.
+     */
+    static int getGrainSize();
+
+    /*!
+     * \brief Set the minimum number of local cells required to process the
+     * patches of a level by multiple threads.
+     */
+    static void setMinimumNumberOfCells(int min_num_cells);
+
+    /*!
+     * \brief Return the minimum number of local cells required to process
+     * the patches of a level by multiple threads.
+     */
+    static int getMinimumNumberOfCells();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PatchTaskList();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchTaskList(const PatchTaskList& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchTaskList& operator=(const PatchTaskList& that);
+
+    /*!
+     * \brief The local patches, ordered by decreasing size.
+     */
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > > d_patches;
+
+    /*!
+     * \brief The total number of local cells.
+     */
+    int d_num_cells;
+
+    /*!
+     * \brief Threading parameters.
+     */
+    static int s_num_threads, s_grain_size, s_min_num_cells;
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/PatchTaskList-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_PatchTaskList
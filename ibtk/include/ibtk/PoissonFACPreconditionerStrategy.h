@@ -64,6 +64,8 @@ namespace SAMRAI
 namespace hier
 {
 template <int DIM>
+class BoxList;
+template <int DIM>
 class Variable;
 } // namespace hier
 namespace math
@@ -71,6 +73,11 @@ namespace math
 template <int DIM, class TYPE>
 class HierarchyDataOpsReal;
 } // namespace math
+namespace pdat
+{
+template <int DIM, class TYPE>
+class ArrayData;
+} // namespace pdat
 namespace solv
 {
 template <int DIM>
@@ -108,7 +115,15 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 10            // see setCoarseSolverMaxIterations()
+ coarse_solver_agglomeration_num_procs = 0    // gather the coarsest level onto this many processes
+ coarse_solver_agglomeration_pc_type = "lu"   // solver used on the gathered coarsest level
+ use_single_precision_smoother = FALSE        // see setUseSinglePrecisionSmoother()
  \endverbatim
+ *
+ * When coarse_solver_agglomeration_num_procs is positive and the coarse level
+ * solver is a PETSc level solver, the coarsest level system is gathered onto
+ * subcommunicators of the specified number of processes and solved there.
+ * \see PETScLevelSolver
 */
 class PoissonFACPreconditionerStrategy : public FACPreconditionerStrategy
 {
@@ -236,6 +251,18 @@ public:
      */
     void setRestrictionMethod(const std::string& restriction_method);
 
+    /*!
+     * \brief Specify whether the level smoother should sweep over
+     * single-precision copies of the error and residual.
+     *
+     * The solution and right-hand side vectors, the residual computations, and
+     * the coarse level solver remain in double precision; data are converted
+     * at the smoother boundary, i.e., on entry to and exit from each call to
+     * smoothError().  Implementations that do not provide a single-precision
+     * smoother are free to ignore this value.
+     */
+    void setUseSinglePrecisionSmoother(bool use_single_precision_smoother);
+
     //\}
 
     /*!
@@ -331,6 +358,50 @@ protected:
      */
     virtual void deallocateOperatorStateSpecialized(int coarsest_reset_ln, int finest_reset_ln) = 0;
 
+    /*!
+     * \brief Add the coarsest level agglomeration settings to the database
+     * used to initialize the coarse level solver.
+     */
+    void setCoarseSolverAgglomerationOptions(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> coarse_solver_db) const;
+
+    /*!
+     * \name Methods for converting data between the double-precision level
+     * data and the single-precision smoother data.
+     */
+    //\{
+
+    /*!
+     * \brief Copy double-precision values into single-precision storage over
+     * the entire (common) array box.
+     */
+    static void copyToSinglePrecision(SAMRAI::pdat::ArrayData<NDIM, float>& dst,
+                                      const SAMRAI::pdat::ArrayData<NDIM, double>& src);
+
+    /*!
+     * \brief Copy double-precision values into single-precision storage over
+     * the specified boxes.
+     */
+    static void copyToSinglePrecision(SAMRAI::pdat::ArrayData<NDIM, float>& dst,
+                                      const SAMRAI::pdat::ArrayData<NDIM, double>& src,
+                                      const SAMRAI::hier::BoxList<NDIM>& boxes);
+
+    /*!
+     * \brief Copy single-precision values back into double-precision storage
+     * over the entire (common) array box.
+     */
+    static void copyToDoublePrecision(SAMRAI::pdat::ArrayData<NDIM, double>& dst,
+                                      const SAMRAI::pdat::ArrayData<NDIM, float>& src);
+
+    /*!
+     * \brief Copy single-precision values back into double-precision storage
+     * over the specified boxes.
+     */
+    static void copyToDoublePrecision(SAMRAI::pdat::ArrayData<NDIM, double>& dst,
+                                      const SAMRAI::pdat::ArrayData<NDIM, float>& src,
+                                      const SAMRAI::hier::BoxList<NDIM>& boxes);
+
+    //\}
+
     /*!
      * \name Methods for executing, caching, and resetting communication
      * schedules.
@@ -423,6 +494,11 @@ protected:
      */
     std::string d_smoother_type;
 
+    /*
+     * Whether to perform smoothing sweeps in single precision.
+     */
+    bool d_use_single_precision_smoother;
+
     /*
      * The names of the refinement operators used to prolong the coarse grid
      * correction.
@@ -442,6 +518,8 @@ protected:
     double d_coarse_solver_rel_residual_tol;
     double d_coarse_solver_abs_residual_tol;
     int d_coarse_solver_max_iterations;
+    int d_coarse_solver_agglomeration_num_procs;
+    std::string d_coarse_solver_agglomeration_pc_type;
 
     //\}
 
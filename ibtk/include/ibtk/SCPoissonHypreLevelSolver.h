@@ -242,6 +242,12 @@ public:
      * \note It is safe to call deallocateSolverState() when the solver state is
      * already deallocated.
      *
+     * \note The hypre grid, stencil, graph, matrix, and vector objects are
+     * retained after the solver state is deallocated.  If the next call to
+     * initializeSolverState() uses the same patch level configuration, these
+     * objects are reused, and only the matrix coefficients and the hypre solver
+     * setup are recomputed.
+     *
      * \see initializeSolverState
      */
     void deallocateSolverState();
@@ -280,6 +286,8 @@ private:
      * \brief Functions to allocate, initialize, access, and deallocate hypre
      * data structures.
      */
+    bool canReuseHypreData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_num) const;
     void allocateHypreData();
     void setMatrixCoefficients();
     void setupHypreSolver();
@@ -323,6 +331,7 @@ private:
     HYPRE_SStructVector d_rhs_vec, d_sol_vec;
     HYPRE_SStructSolver d_solver, d_precond;
     std::vector<SAMRAI::hier::Index<NDIM> > d_stencil_offsets;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_grid_patch_boxes;
 
     std::string d_solver_type, d_precond_type, d_split_solver_type;
     int d_rel_change;
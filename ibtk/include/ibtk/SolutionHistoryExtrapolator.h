@@ -0,0 +1,154 @@
+// Filename: SolutionHistoryExtrapolator.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_SolutionHistoryExtrapolator
+#define included_SolutionHistoryExtrapolator
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "IntVector.h"
+#include "SAMRAIVectorReal.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SolutionHistoryExtrapolator stores the solutions of a sequence
+ * of time-dependent linear or nonlinear systems and uses them to generate
+ * initial guesses for subsequent solves.
+ *
+ * The initial guess is obtained by evaluating the interpolating polynomial of
+ * degree \em k through the \em k+1 most recently stored solutions at the
+ * requested time.  Extrapolation of degree zero simply reuses the most recently
+ * stored solution.
+ *
+ * \note The stored solutions are only valid for the patch hierarchy
+ * configuration used to generate them.  Users must call clearHistory()
+ * whenever the patch hierarchy is regridded.
+ */
+class SolutionHistoryExtrapolator
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    SolutionHistoryExtrapolator(const std::string& object_name, int extrapolation_order);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SolutionHistoryExtrapolator();
+
+    /*!
+     * \brief Set the degree of the extrapolating polynomial.
+     */
+    void setExtrapolationOrder(int extrapolation_order);
+
+    /*!
+     * \brief Get the degree of the extrapolating polynomial.
+     */
+    int getExtrapolationOrder() const;
+
+    /*!
+     * \brief Get the number of solutions that are currently stored.
+     */
+    int getNumberOfStoredSolutions() const;
+
+    /*!
+     * \brief Store a copy of the solution at the specified time.
+     *
+     * If a solution has already been stored at the specified time, it is
+     * replaced.  Otherwise, the oldest stored solution is discarded if
+     * necessary.
+     */
+    void storeSolution(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, double time);
+
+    /*!
+     * \brief Set \a x to the extrapolated solution at the specified time.
+     *
+     * \return Whether any stored solutions were available.  If no solutions are
+     * stored, \a x is not modified.
+     */
+    bool computeInitialGuess(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, double time) const;
+
+    /*!
+     * \brief Discard all stored solutions.
+     */
+    void clearHistory();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    SolutionHistoryExtrapolator();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    SolutionHistoryExtrapolator(const SolutionHistoryExtrapolator& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    SolutionHistoryExtrapolator& operator=(const SolutionHistoryExtrapolator& that);
+
+    std::string d_object_name;
+    int d_extrapolation_order;
+
+    /*!
+     * \brief The stored solutions and their times, ordered from oldest to
+     * newest.
+     */
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_solutions;
+    std::vector<double> d_solution_times;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_SolutionHistoryExtrapolator
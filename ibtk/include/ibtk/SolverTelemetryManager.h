@@ -0,0 +1,367 @@
+// Filename: SolverTelemetryManager.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_SolverTelemetryManager
+#define included_SolverTelemetryManager
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ibtk/ibtk_enums.h"
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+template <class TYPE>
+class Pointer;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SolverTelemetryManager is a singleton manager class that
+ * collects structured performance data from the IBTK linear, nonlinear, and
+ * multigrid solvers.
+ *
+ * For each call to solveSystem(), class PETScKrylovLinearSolver,
+ * PETScNewtonKrylovSolver, and FACPreconditioner (and all classes derived from
+ * them, including the solvers allocated by the Poisson and Stokes solver
+ * managers) record the number of iterations, the final residual norm, the
+ * residual history, whether the solver converged, and the wall clock time of
+ * the solve.  Within each FAC cycle, the time spent smoothing, computing
+ * residuals, restricting, prolonging, solving on the coarsest level, and
+ * filling ghost cells is also recorded.  The time required to initialize the
+ * solver state (e.g., to set up preconditioners and to construct coarse-level
+ * operators) is recorded separately as the setup time of the solver.
+ *
+ * Phases are attributed to the innermost solver that is active when the phase
+ * is executed, so that the multigrid phase times of a Krylov method
+ * preconditioned by FAC are reported by the FAC preconditioner.  Ghost filling
+ * is generally performed within the other phases, so that the ghost filling
+ * time is also included in the time of the enclosing phase.
+ *
+ * Data are aggregated per solver (identified by its object name) and per time
+ * step.  HierarchyIntegrator::advanceHierarchy() calls beginTimeStep() and
+ * endTimeStep(), and the aggregated data for the most recently completed time
+ * step can be obtained via getTimeStepSummaries() or
+ * HierarchyIntegrator::getSolverTelemetry().  Times in the per-time step
+ * summaries are the maximum over all MPI processes.  The summaries (and,
+ * optionally, the individual solve records) can also be streamed in CSV or
+ * JSON lines format.
+ *
+ * Sample input:
+ * \verbatim
+ SolverTelemetryManager {
+    enabled = TRUE                   // default is FALSE
+    record_residual_history = TRUE   // default is TRUE
+    log_summaries = FALSE            // default is FALSE
+    stream_filename = "telemetry"    // default is "" (no streaming)
+    stream_format = "CSV"            // CSV or JSON; default is CSV
+    stream_solve_records = FALSE     // default is FALSE
+ }
+ \endverbatim
+ *
+ * When telemetry is disabled (the default), the only overhead incurred by the
+ * solvers is a check of a static flag.
+ */
+class SolverTelemetryManager
+{
+public:
+    /*!
+     * \brief Data describing a single call to solveSystem().
+     */
+    struct SolveRecord
+    {
+        std::string solver_name;
+        int time_step_number;
+        int num_iterations;
+        double residual_norm;
+        bool converged;
+        double solve_time;
+        double phase_times[NUM_SOLVER_PHASE_TYPES];
+        std::vector<double> residual_history;
+    };
+
+    /*!
+     * \brief Data describing all calls to one solver during a time step.
+     */
+    struct TimeStepSummary
+    {
+        std::string solver_name;
+        int time_step_number;
+        int num_solves;
+        int num_failed_solves;
+        int total_iterations;
+        int max_iterations;
+        double residual_norm;
+        int num_setups;
+        double setup_time;
+        double solve_time;
+        double phase_times[NUM_SOLVER_PHASE_TYPES];
+    };
+
+    /*!
+     * Return a pointer to the instance of the solver telemetry manager.  All
+     * access to the singleton SolverTelemetryManager object is through the
+     * getManager() function.
+     *
+     * Note that when the manager is accessed for the first time, the
+     * freeManager static method is registered with the ShutdownRegistry class.
+     * Consequently, an allocated manager is freed at program completion.  Thus,
+     * users of this class do not explicitly allocate or deallocate the manager
+     * instances.
+     *
+     * \return A pointer to the data manager instance.
+     */
+    static SolverTelemetryManager* getManager();
+
+    /*!
+     * Deallocate the SolverTelemetryManager instance.
+     *
+     * It is not necessary to call this function at program termination, since
+     * it is automatically called by the ShutdownRegistry class.
+     */
+    static void freeManager();
+
+    /*!
+     * \brief Set the options for the manager from an input database.
+     */
+    static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \return Whether telemetry is enabled at runtime.
+     */
+    static bool isEnabled();
+
+    /*!
+     * \brief Enable or disable telemetry at runtime.
+     */
+    static void setEnabled(bool enabled);
+
+    /*!
+     * \return Whether solvers should record their residual histories.
+     */
+    bool getRecordResidualHistory() const;
+
+    /*!
+     * \name Methods used by solvers to record telemetry data.
+     */
+    //\{
+
+    /*!
+     * \brief Indicate that the specified solver is starting a solve.
+     */
+    void beginSolve(const std::string& solver_name);
+
+    /*!
+     * \brief Indicate that the innermost active solve has completed.
+     */
+    void endSolve(int num_iterations,
+                  double residual_norm,
+                  bool converged,
+                  const std::vector<double>& residual_history = std::vector<double>());
+
+    /*!
+     * \brief Record the time required to initialize the state of the specified
+     * solver.
+     */
+    void recordSetup(const std::string& solver_name, double setup_time);
+
+    /*!
+     * \brief Indicate that the innermost active solve is starting the specified
+     * phase.
+     */
+    static void startPhase(SolverPhaseType phase);
+
+    /*!
+     * \brief Indicate that the innermost active solve has completed the
+     * specified phase.
+     */
+    static void stopPhase(SolverPhaseType phase);
+
+    //\}
+
+    /*!
+     * \name Methods used to aggregate and query telemetry data.
+     */
+    //\{
+
+    /*!
+     * \brief Indicate the start of the specified time step.
+     */
+    void beginTimeStep(int time_step_number, double time);
+
+    /*!
+     * \brief Indicate the end of the current time step.  The data recorded
+     * since the previous call to endTimeStep() are aggregated and, if
+     * requested, written to the log file and to the output stream.
+     *
+     * \note This method is collective on all MPI processes!
+     */
+    void endTimeStep();
+
+    /*!
+     * \return The per-solver summaries for the most recently completed time
+     * step.
+     */
+    const std::vector<TimeStepSummary>& getTimeStepSummaries() const;
+
+    /*!
+     * \return The individual solve records for the most recently completed
+     * time step.
+     *
+     * \note The solve times in these records are local to each MPI process.
+     */
+    const std::vector<SolveRecord>& getSolveRecords() const;
+
+    //\}
+
+protected:
+    /*!
+     * \brief Constructor.
+     */
+    SolverTelemetryManager();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SolverTelemetryManager();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    SolverTelemetryManager(const SolverTelemetryManager& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    SolverTelemetryManager& operator=(const SolverTelemetryManager& that);
+
+    /*!
+     * \brief Data describing an active solve.
+     */
+    struct ActiveSolve
+    {
+        SolveRecord record;
+        double start_time;
+        int phase_depth[NUM_SOLVER_PHASE_TYPES];
+        double phase_start_time[NUM_SOLVER_PHASE_TYPES];
+    };
+
+    /*!
+     * \brief Return the summary for the specified solver for the current time
+     * step.
+     */
+    TimeStepSummary& getCurrentSummary(const std::string& solver_name);
+
+    /*!
+     * \brief Write a row of data to the output stream.
+     */
+    void writeStreamRow(const std::string& record_type,
+                        const TimeStepSummary& summary,
+                        const std::vector<double>& residual_history);
+
+    /*!
+     * \brief Configuration options.
+     */
+    bool d_record_residual_history;
+    bool d_log_summaries;
+    std::string d_stream_filename;
+    bool d_stream_json;
+    bool d_stream_solve_records;
+
+    /*!
+     * \brief The output stream (only used on MPI process 0).
+     */
+    std::ofstream d_stream;
+    bool d_stream_header_written;
+
+    /*!
+     * \brief The current time step number and simulation time.
+     */
+    int d_time_step_number;
+    double d_time;
+
+    /*!
+     * \brief The stack of active solves.
+     */
+    std::vector<ActiveSolve> d_active_solves;
+
+    /*!
+     * \brief Data recorded during the current time step.
+     */
+    std::map<std::string, TimeStepSummary> d_current_summaries;
+    std::vector<SolveRecord> d_current_solve_records;
+
+    /*!
+     * \brief Data recorded during the most recently completed time step.
+     */
+    std::vector<TimeStepSummary> d_time_step_summaries;
+    std::vector<SolveRecord> d_solve_records;
+
+    /*!
+     * Static data members used to control access to and destruction of the
+     * singleton manager.
+     */
+    static SolverTelemetryManager* s_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+    static bool s_enabled;
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/SolverTelemetryManager-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_SolverTelemetryManager
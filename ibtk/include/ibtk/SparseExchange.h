@@ -0,0 +1,112 @@
+// Filename: SparseExchange.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_SparseExchange
+#define included_SparseExchange
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SparseExchange is a utility class that provides a sparse
+ * all-to-all exchange of data buffers among MPI processes.
+ *
+ * Only processes that actually exchange data communicate with each other.  The
+ * number of messages that each process will receive is determined by a single
+ * reduction, after which the messages are received in the order in which they
+ * arrive.
+ */
+class SparseExchange
+{
+public:
+    /*!
+     * \brief Send the data in \a send_bufs[p] to process p and store the data
+     * received from each process q (including the present process) in \a
+     * recv_bufs[q].
+     *
+     * Empty buffers are not sent, and \a recv_bufs contains entries only for
+     * those processes from which data were received.
+     *
+     * \param send_bufs The data to send to each process, indexed by rank.
+     * \param recv_bufs The data received from each process, keyed by rank.
+     * \param tag The MPI tag used for the messages.
+     *
+     * \note This is a collective operation.  The data are communicated as raw
+     * bytes, and so \a T must be a plain old data type.
+     */
+    template <class T>
+    static void exchange(const std::vector<std::vector<T> >& send_bufs,
+                         std::map<int, std::vector<T> >& recv_bufs,
+                         int tag);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    SparseExchange();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    SparseExchange(const SparseExchange& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    SparseExchange& operator=(const SparseExchange& that);
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/SparseExchange-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_SparseExchange
@@ -0,0 +1,161 @@
+// Filename: SpreadAccumulator.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_SpreadAccumulator
+#define included_SpreadAccumulator
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+
+#include "HierarchyDataOpsReal.h"
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SpreadAccumulator manages the Eulerian data used to accumulate
+ * values spread from a Lagrangian mesh to a Cartesian grid.
+ *
+ * Spreading operators compute contributions in the ghost cell regions of the
+ * Eulerian patch data, and these values must be zero before spreading so that
+ * contributions from the ghost cells along physical boundaries can be
+ * accumulated into the patch interiors.  Values spread into the patch
+ * interiors are added to the existing values.
+ *
+ * When the existing values must not be modified during spreading (e.g.,
+ * because coarse-grid values are prolonged to finer levels before spreading
+ * on those levels, or because a physical boundary operator overwrites values
+ * on the physical boundary when accumulating ghost cell values), they are
+ * moved into scratch storage that is allocated once per patch level and
+ * reused by subsequent spreading operations.  Otherwise, no scratch data are
+ * required, and only the ghost cell values are reset.
+ *
+ * Typical usage:\code
+ d_spread_accumulator.beginAccumulation(f_data_idx, hierarchy, coarsest_ln, finest_ln, false);
+ ... spread values into f_data_idx ...
+ d_spread_accumulator.endAccumulation();
+ \endcode
+ */
+class SpreadAccumulator
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    SpreadAccumulator();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SpreadAccumulator();
+
+    /*!
+     * \brief Prepare the Eulerian data associated with patch data index \a
+     * f_data_idx to accumulate spread values on the specified range of levels
+     * of the patch hierarchy.
+     *
+     * If \a preserve_data is false, only the ghost cell values of the patch
+     * data are reset to zero.  Otherwise, the existing values are moved into
+     * persistent scratch storage and all values of the patch data are reset
+     * to zero.
+     *
+     * \note \a preserve_data must be true whenever any operation performed
+     * between beginAccumulation() and endAccumulation() overwrites, rather
+     * than adds to, the patch interior values, e.g., when
+     * RobinPhysBdryPatchStrategy::accumulateFromPhysicalBoundaryData() is
+     * used, unless the existing values are known to be zero.
+     */
+    void beginAccumulation(int f_data_idx,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int coarsest_ln,
+                           int finest_ln,
+                           bool preserve_data);
+
+    /*!
+     * \brief Complete the accumulation of spread values, adding back any data
+     * stored by beginAccumulation().
+     */
+    void endAccumulation();
+
+    /*!
+     * \brief Deallocate all scratch data.
+     *
+     * \note Scratch data are automatically reallocated as needed.
+     */
+    void deallocateScratchData();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    SpreadAccumulator(const SpreadAccumulator& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    SpreadAccumulator& operator=(const SpreadAccumulator& that);
+
+    /*!
+     * \brief The patch hierarchy on which scratch data are allocated.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+
+    /*!
+     * \brief Map from Eulerian patch data indices to the corresponding
+     * scratch patch data indices.
+     */
+    std::map<int, int> d_scratch_idxs;
+
+    /*!
+     * \brief The state of the current accumulation.
+     */
+    int d_f_data_idx, d_scratch_idx;
+    SAMRAI::tbox::Pointer<SAMRAI::math::HierarchyDataOpsReal<NDIM, double> > d_f_data_ops;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_SpreadAccumulator
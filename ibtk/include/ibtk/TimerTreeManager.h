@@ -0,0 +1,346 @@
+// Filename: TimerTreeManager.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_TimerTreeManager
+#define included_TimerTreeManager
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+class Timer;
+template <class TYPE>
+class Pointer;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class TimerTreeManager is a singleton manager class that records the
+ * call hierarchy of the SAMRAI::tbox::Timer objects that are started and
+ * stopped via the IBTK_TIMER_START() and IBTK_TIMER_STOP() macros (and the
+ * corresponding IBAMR macros).
+ *
+ * Each timer scope is recorded as a node in a tree whose parent is the scope
+ * that was active when the timer was started.  Scopes may optionally be
+ * attributed to a particular level of the patch hierarchy via the
+ * IBTK_TIMER_START_LEVEL() macro, and each recorded event is attributed to the
+ * current time step number.  At the end of a run, the manager reduces the
+ * per-node timings across all MPI processes and reports the minimum, mean, and
+ * maximum times, the load imbalance (max/mean), and the rank of the slowest
+ * process.  The summary can also be written in JSON format, and the individual
+ * events can be written as Chrome trace files (one per MPI process) that can be
+ * viewed with chrome://tracing or compatible tools.
+ *
+ * Only scopes opened by the main thread are recorded in the tree.  Timers that
+ * are started by other threads are passed through to the underlying SAMRAI
+ * timers.
+ *
+ * Sample input:
+ * \verbatim
+ TimerTreeManager {
+    enabled = TRUE               // default is TRUE
+    print_summary = FALSE        // default is FALSE
+    summary_json_filename = ""   // default is "" (no JSON output)
+    enable_trace = FALSE         // default is FALSE
+    trace_filename = "trace"     // default is "trace"
+    max_num_trace_events = 1000000
+ }
+ \endverbatim
+ */
+class TimerTreeManager
+{
+public:
+    /*!
+     * Return a pointer to the instance of the timer tree manager.  All access
+     * to the singleton TimerTreeManager object is through the getManager()
+     * function.
+     *
+     * Note that when the manager is accessed for the first time, the
+     * freeManager static method is registered with the ShutdownRegistry class.
+     * Consequently, an allocated manager is freed at program completion.  Thus,
+     * users of this class do not explicitly allocate or deallocate the manager
+     * instances.
+     *
+     * \return A pointer to the data manager instance.
+     */
+    static TimerTreeManager* getManager();
+
+    /*!
+     * Deallocate the TimerTreeManager instance.
+     *
+     * Any requested summaries or trace files are written prior to deallocating
+     * the manager.
+     *
+     * It is not necessary to call this function at program termination, since
+     * it is automatically called by the ShutdownRegistry class.
+     *
+     * \note This method is collective on all MPI processes!
+     */
+    static void freeManager();
+
+    /*!
+     * \brief Set the options for the manager from an input database.
+     */
+    static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \return Whether timers are enabled at runtime.
+     */
+    static bool isEnabled();
+
+    /*!
+     * \brief Enable or disable timers at runtime.
+     *
+     * \note Timers that are running when timers are disabled are still stopped
+     * (and recorded) normally.
+     */
+    static void setEnabled(bool enabled);
+
+    /*!
+     * \brief Start the timer and open a new scope in the timer tree.
+     *
+     * If \a level_number is nonnegative, the scope is attributed to the
+     * specified level of the patch hierarchy.
+     */
+    static void startTimer(SAMRAI::tbox::Timer* timer, int level_number = -1);
+
+    /*!
+     * \brief Stop the timer and close the corresponding scope in the timer
+     * tree.
+     */
+    static void stopTimer(SAMRAI::tbox::Timer* timer);
+
+    /*!
+     * \brief Set the time step number to which subsequently recorded events are
+     * attributed.
+     */
+    static void setTimeStepNumber(int time_step_number);
+
+    /*!
+     * \brief Print a summary of the timer tree, reduced across all MPI
+     * processes, to the specified output stream on MPI process 0.
+     *
+     * \note This method is collective on all MPI processes!
+     */
+    void printSummary(std::ostream& os);
+
+    /*!
+     * \brief Write a summary of the timer tree, reduced across all MPI
+     * processes, in JSON format on MPI process 0.
+     *
+     * \note This method is collective on all MPI processes!
+     */
+    void writeSummaryJSON(const std::string& filename);
+
+    /*!
+     * \brief Write the recorded events in Chrome trace event format.  Each MPI
+     * process writes its own file named "<filename>.<rank>.json".
+     */
+    void writeChromeTrace(const std::string& filename) const;
+
+    /*!
+     * \brief Clear all recorded timings and events.
+     *
+     * \note Scopes that are currently open are retained.
+     */
+    void resetTimings();
+
+protected:
+    /*!
+     * \brief Constructor.
+     */
+    TimerTreeManager();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~TimerTreeManager();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    TimerTreeManager(const TimerTreeManager& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    TimerTreeManager& operator=(const TimerTreeManager& that);
+
+    /*!
+     * \brief Data describing one node of the timer tree.
+     */
+    struct TimerNode
+    {
+        std::string name;
+        int level_number;
+        int parent;
+        std::map<std::pair<const SAMRAI::tbox::Timer*, int>, int> children;
+        double total_time;
+        unsigned long num_calls;
+    };
+
+    /*!
+     * \brief Data describing an open scope.
+     */
+    struct ActiveScope
+    {
+        SAMRAI::tbox::Timer* timer;
+        int node;
+        double start_time;
+    };
+
+    /*!
+     * \brief Data describing one recorded trace event.
+     */
+    struct TraceEvent
+    {
+        int node;
+        double start_time;
+        double duration;
+        int time_step_number;
+    };
+
+    /*!
+     * \brief Summary data for one node of the timer tree, reduced across all
+     * MPI processes.
+     */
+    struct NodeSummary
+    {
+        std::string path;
+        std::string name;
+        int level_number;
+        int depth;
+        unsigned long num_calls;
+        double min_time, mean_time, max_time;
+        int max_rank;
+    };
+
+    /*!
+     * \brief Open a new scope.
+     */
+    void pushScope(SAMRAI::tbox::Timer* timer, int level_number);
+
+    /*!
+     * \brief Close the scope associated with the specified timer.
+     *
+     * \return Whether the timer was associated with an open scope.
+     */
+    bool popScope(SAMRAI::tbox::Timer* timer);
+
+    /*!
+     * \brief Return the unique path identifying the specified node.
+     */
+    std::string getNodePath(int node) const;
+
+    /*!
+     * \brief Reduce the timer tree across all MPI processes.  The reduced data
+     * are only valid on MPI process 0.
+     */
+    void computeSummary(std::vector<NodeSummary>& summary);
+
+    /*!
+     * \brief Write the scheduled outputs.
+     */
+    void writeOutputs();
+
+    /*!
+     * \brief The nodes of the timer tree.  Node 0 is the root of the tree.
+     */
+    std::vector<TimerNode> d_nodes;
+
+    /*!
+     * \brief The currently open scopes.
+     */
+    std::vector<ActiveScope> d_active_scopes;
+
+    /*!
+     * \brief The recorded trace events.
+     */
+    std::vector<TraceEvent> d_trace_events;
+    bool d_enable_trace;
+    unsigned int d_max_num_trace_events;
+    bool d_trace_overflow;
+
+    /*!
+     * \brief The wall clock time at which the manager was created and the
+     * current time step number.
+     */
+    double d_start_time;
+    int d_time_step_number;
+
+    /*!
+     * \brief Outputs to write when the manager is freed.
+     */
+    bool d_print_summary;
+    std::string d_summary_json_filename, d_trace_filename;
+
+    /*!
+     * Static data members used to control access to and destruction of the
+     * singleton manager.
+     */
+    static TimerTreeManager* s_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+    static bool s_enabled;
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/TimerTreeManager-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_TimerTreeManager
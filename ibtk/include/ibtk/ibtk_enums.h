@@ -99,6 +99,42 @@ inline std::string enum_to_string<MGCycleType>(MGCycleType val)
     return "UNKNOWN_MG_CYCLE_TYPE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for different orderings of the local Lagrangian nodes.
+ */
+enum LNodeOrderingType
+{
+    PATCH_ORDERING,
+    MORTON_ORDERING,
+    HILBERT_ORDERING,
+    LAGRANGIAN_INDEX_ORDERING,
+    UNKNOWN_LNODE_ORDERING_TYPE = -1
+};
+
+template <>
+inline LNodeOrderingType string_to_enum<LNodeOrderingType>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "PATCH") == 0) return PATCH_ORDERING;
+    if (strcasecmp(val.c_str(), "PATCH_ORDERING") == 0) return PATCH_ORDERING;
+    if (strcasecmp(val.c_str(), "MORTON") == 0) return MORTON_ORDERING;
+    if (strcasecmp(val.c_str(), "MORTON_ORDERING") == 0) return MORTON_ORDERING;
+    if (strcasecmp(val.c_str(), "HILBERT") == 0) return HILBERT_ORDERING;
+    if (strcasecmp(val.c_str(), "HILBERT_ORDERING") == 0) return HILBERT_ORDERING;
+    if (strcasecmp(val.c_str(), "LAGRANGIAN_INDEX") == 0) return LAGRANGIAN_INDEX_ORDERING;
+    if (strcasecmp(val.c_str(), "LAGRANGIAN_INDEX_ORDERING") == 0) return LAGRANGIAN_INDEX_ORDERING;
+    return UNKNOWN_LNODE_ORDERING_TYPE;
+} // string_to_enum
+
+template <>
+inline std::string enum_to_string<LNodeOrderingType>(LNodeOrderingType val)
+{
+    if (val == PATCH_ORDERING) return "PATCH_ORDERING";
+    if (val == MORTON_ORDERING) return "MORTON_ORDERING";
+    if (val == HILBERT_ORDERING) return "HILBERT_ORDERING";
+    if (val == LAGRANGIAN_INDEX_ORDERING) return "LAGRANGIAN_INDEX_ORDERING";
+    return "UNKNOWN_LNODE_ORDERING_TYPE";
+} // enum_to_string
+
 /*!
  * \brief Enumerated type for different regridding modes.
  */
@@ -154,6 +190,46 @@ inline std::string enum_to_string<VariableContextType>(VariableContextType val)
     return "UNKNOWN_VARIABLE_CONTEXT_TYPE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for the phases of a multigrid cycle that are recorded
+ * by class SolverTelemetryManager.
+ */
+enum SolverPhaseType
+{
+    SMOOTH_PHASE,
+    RESIDUAL_PHASE,
+    RESTRICTION_PHASE,
+    PROLONGATION_PHASE,
+    COARSE_SOLVE_PHASE,
+    GHOST_FILL_PHASE,
+    NUM_SOLVER_PHASE_TYPES,
+    UNKNOWN_SOLVER_PHASE_TYPE = -1
+};
+
+template <>
+inline SolverPhaseType string_to_enum<SolverPhaseType>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "SMOOTH") == 0) return SMOOTH_PHASE;
+    if (strcasecmp(val.c_str(), "RESIDUAL") == 0) return RESIDUAL_PHASE;
+    if (strcasecmp(val.c_str(), "RESTRICTION") == 0) return RESTRICTION_PHASE;
+    if (strcasecmp(val.c_str(), "PROLONGATION") == 0) return PROLONGATION_PHASE;
+    if (strcasecmp(val.c_str(), "COARSE_SOLVE") == 0) return COARSE_SOLVE_PHASE;
+    if (strcasecmp(val.c_str(), "GHOST_FILL") == 0) return GHOST_FILL_PHASE;
+    return UNKNOWN_SOLVER_PHASE_TYPE;
+} // string_to_enum
+
+template <>
+inline std::string enum_to_string<SolverPhaseType>(SolverPhaseType val)
+{
+    if (val == SMOOTH_PHASE) return "SMOOTH";
+    if (val == RESIDUAL_PHASE) return "RESIDUAL";
+    if (val == RESTRICTION_PHASE) return "RESTRICTION";
+    if (val == PROLONGATION_PHASE) return "PROLONGATION";
+    if (val == COARSE_SOLVE_PHASE) return "COARSE_SOLVE";
+    if (val == GHOST_FILL_PHASE) return "GHOST_FILL";
+    return "UNKNOWN_SOLVER_PHASE_TYPE";
+} // enum_to_string
+
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
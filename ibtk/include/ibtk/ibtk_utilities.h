@@ -36,9 +36,11 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <algorithm>
+#include <string>
 
 #include "Eigen/Core" // IWYU pragma: export
 #include "boost/array.hpp"
+#include "ibtk/TimerTreeManager.h" // IWYU pragma: export
 #include "tbox/PIO.h"
 #include "tbox/Utilities.h"
 
@@ -114,13 +116,20 @@ static const bool ENABLE_TIMERS = true;
 #define IBTK_TIMER_START(timer)                                                                                        \
     do                                                                                                                 \
     {                                                                                                                  \
-        if (IBTK::ENABLE_TIMERS) timer->start();                                                                       \
+        if (IBTK::ENABLE_TIMERS && IBTK::TimerTreeManager::isEnabled()) IBTK::TimerTreeManager::startTimer(timer);     \
+    } while (0);
+
+#define IBTK_TIMER_START_LEVEL(timer, level_number)                                                                    \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (IBTK::ENABLE_TIMERS && IBTK::TimerTreeManager::isEnabled())                                                \
+            IBTK::TimerTreeManager::startTimer(timer, level_number);                                                   \
     } while (0);
 
 #define IBTK_TIMER_STOP(timer)                                                                                         \
     do                                                                                                                 \
     {                                                                                                                  \
-        if (IBTK::ENABLE_TIMERS) timer->stop();                                                                        \
+        if (IBTK::ENABLE_TIMERS) IBTK::TimerTreeManager::stopTimer(timer);                                             \
     } while (0);
 
 /////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
@@ -158,6 +167,17 @@ inline bool level_can_be_refined(int level_number, int max_levels)
     return level_number < finest_level_number;
 }
 
+inline std::string escape_json(const std::string& str)
+{
+    std::string escaped_str;
+    for (std::string::const_iterator it = str.begin(); it != str.end(); ++it)
+    {
+        if (*it == '"' || *it == '\\') escaped_str += '\\';
+        escaped_str += *it;
+    }
+    return escaped_str;
+} // escape_json
+
 typedef Eigen::Matrix<double, 2, 2> Matrix2d;
 typedef Eigen::Matrix<double, 2, 1> Vector2d;
 typedef Eigen::Matrix<double, 2, 1> ColumnVector2d;
@@ -0,0 +1,93 @@
+// Filename: PatchTaskList-inl.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_PatchTaskList_inl_h
+#define included_PatchTaskList_inl_h
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/PatchTaskList.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+inline int PatchTaskList::size() const
+{
+    return static_cast<int>(d_patches.size());
+} // size
+
+inline const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >& PatchTaskList::operator[](const int k) const
+{
+    return d_patches[k];
+} // operator[]
+
+inline bool PatchTaskList::useThreads() const
+{
+    return d_patches.size() > 1 && d_num_cells >= s_min_num_cells;
+} // useThreads
+
+template <class PatchTask>
+inline void PatchTaskList::forEachLocalPatch(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                                             const PatchTask& task)
+{
+    const PatchTaskList patches(level);
+    IBTK_PATCH_TASK_LOOP(patches)
+    for (int k = 0; k < patches.size(); ++k)
+    {
+        task(patches[k]);
+    }
+    return;
+} // forEachLocalPatch
+
+inline int PatchTaskList::getGrainSize()
+{
+    return s_grain_size;
+} // getGrainSize
+
+inline int PatchTaskList::getMinimumNumberOfCells()
+{
+    return s_min_num_cells;
+} // getMinimumNumberOfCells
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_PatchTaskList_inl_h
@@ -0,0 +1,115 @@
+// Filename: SparseExchange-inl.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_SparseExchange_inl_h
+#define included_SparseExchange_inl_h
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <vector>
+
+#include "ibtk/SparseExchange.h"
+#include "tbox/SAMRAI_MPI.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+template <class T>
+inline void SparseExchange::exchange(const std::vector<std::vector<T> >& send_bufs,
+                                     std::map<int, std::vector<T> >& recv_bufs,
+                                     const int tag)
+{
+    MPI_Comm communicator = SAMRAI::tbox::SAMRAI_MPI::getCommunicator();
+    const int mpi_rank = SAMRAI::tbox::SAMRAI_MPI::getRank();
+    const int mpi_size = SAMRAI::tbox::SAMRAI_MPI::getNodes();
+
+    // Determine the number of messages to be received by this processor.
+    std::vector<int> has_msg(mpi_size, 0), recv_counts(mpi_size, 1);
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        has_msg[rank] = (rank != mpi_rank && !send_bufs[rank].empty()) ? 1 : 0;
+    }
+    int num_recvs = 0;
+    MPI_Reduce_scatter(&has_msg[0], &num_recvs, &recv_counts[0], MPI_INT, MPI_SUM, communicator);
+
+    // Post the sends.
+    std::vector<MPI_Request> send_reqs;
+    for (int rank = 0; rank < mpi_size; ++rank)
+    {
+        if (!has_msg[rank]) continue;
+        MPI_Request req;
+        MPI_Isend(const_cast<T*>(&send_bufs[rank][0]),
+                  static_cast<int>(sizeof(T) * send_bufs[rank].size()),
+                  MPI_BYTE,
+                  rank,
+                  tag,
+                  communicator,
+                  &req);
+        send_reqs.push_back(req);
+    }
+
+    // Receive the incoming messages in the order in which they arrive.
+    recv_bufs.clear();
+    if (!send_bufs[mpi_rank].empty()) recv_bufs[mpi_rank] = send_bufs[mpi_rank];
+    for (int k = 0; k < num_recvs; ++k)
+    {
+        MPI_Status status;
+        MPI_Probe(MPI_ANY_SOURCE, tag, communicator, &status);
+        int count = 0;
+        MPI_Get_count(&status, MPI_BYTE, &count);
+        std::vector<T>& recv_buf = recv_bufs[status.MPI_SOURCE];
+        recv_buf.resize(count / sizeof(T));
+        MPI_Recv(count > 0 ? &recv_buf[0] : NULL,
+                 count,
+                 MPI_BYTE,
+                 status.MPI_SOURCE,
+                 tag,
+                 communicator,
+                 MPI_STATUS_IGNORE);
+    }
+    if (!send_reqs.empty())
+    {
+        MPI_Waitall(static_cast<int>(send_reqs.size()), &send_reqs[0], MPI_STATUSES_IGNORE);
+    }
+    return;
+} // exchange
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_SparseExchange_inl_h
@@ -58,8 +58,6 @@
 #include "CoarsenOperator.h"
 #include "CoarsenSchedule.h"
 #include "HierarchyCellDataOpsReal.h"
-#include "HierarchyDataOpsManager.h"
-#include "HierarchyDataOpsReal.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -215,40 +213,168 @@ inline short int get_dirichlet_bdry_ids(const std::vector<short int>& bdry_ids)
 
 inline double get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2>& X_node)
 {
-    const unsigned int max_nodes = (elem->dim() == 3 ? 27 : 9);
-    std::vector<libMesh::Point> s_node_cache(max_nodes);
-    const unsigned int n_node = elem->n_nodes();
-    TBOX_ASSERT(n_node <= max_nodes);
-    for (unsigned int k = 0; k < n_node; ++k)
-    {
-        s_node_cache[k] = elem->point(k);
-        libMesh::Point& X = elem->point(k);
-        for (int d = 0; d < NDIM; ++d)
-        {
-            X(d) = X_node[k][d];
-        }
-    }
-    double hmax = 0.0;
+    // NOTE: The maximum edge length is computed directly from the positions of
+    // the vertices at the ends of each edge.  This gives the same value as
+    // computing the maximum of the values of hmax for the element edges, but
+    // it does not require modifying the element or building the edges, and so
+    // it may be called concurrently for elements that share nodes.
+    double hmax_sq = 0.0;
     switch (elem->type())
     {
     case EDGE2:
     case EDGE3:
     case EDGE4:
-        hmax = elem->hmax();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            hmax_sq += (X_node[1][d] - X_node[0][d]) * (X_node[1][d] - X_node[0][d]);
+        }
         break;
     default:
         for (unsigned int e = 0; e < elem->n_edges(); ++e)
         {
-            hmax = std::max(hmax, elem->build_edge(e)->hmax());
+            unsigned int edge_vertices[2] = { 0, 0 };
+            unsigned int n_edge_vertices = 0;
+            for (unsigned int n = 0; n < elem->n_vertices() && n_edge_vertices < 2; ++n)
+            {
+                if (elem->is_node_on_edge(n, e)) edge_vertices[n_edge_vertices++] = n;
+            }
+            TBOX_ASSERT(n_edge_vertices == 2);
+            double edge_len_sq = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double dX = X_node[edge_vertices[1]][d] - X_node[edge_vertices[0]][d];
+                edge_len_sq += dX * dX;
+            }
+            hmax_sq = std::max(hmax_sq, edge_len_sq);
         }
         break;
     }
-    for (unsigned int k = 0; k < n_node; ++k)
+    return std::sqrt(hmax_sq);
+} // get_elem_hmax
+
+inline Order get_adaptive_quad_order(const QuadratureType type, const int npts)
+{
+    Order order = INVALID_ORDER;
+    switch (type)
+    {
+    case QGAUSS:
+        order = static_cast<Order>(std::min(2 * npts - 1, static_cast<int>(FORTYTHIRD)));
+        break;
+    case QGRID:
+        order = static_cast<Order>(npts);
+        break;
+    default:
+        TBOX_ERROR("FEDataManager::updateQuadratureRule():\n"
+                   << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
+                      "or QGRID\n");
+    }
+    return order;
+} // get_adaptive_quad_order
+
+// Compute the permutation that orders the quadrature points on a patch by the
+// linear index of the Cartesian grid cell that contains each point.  Points
+// that are not located within the specified box are ordered after all other
+// points.  The permutation is computed by a stable LSD radix sort on 8-bit
+// digits of the cell index.
+inline void compute_cell_sorted_qp_order(std::vector<unsigned int>& qp_order,
+                                         const std::vector<double>& X_qp,
+                                         const Patch<NDIM>& patch,
+                                         const Box<NDIM>& box)
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch.getPatchGeometry();
+    const double* const patch_x_lower = patch_geom->getXLower();
+    const double* const patch_x_upper = patch_geom->getXUpper();
+    const double* const patch_dx = patch_geom->getDx();
+    const Box<NDIM>& patch_box = patch.getBox();
+    const Index<NDIM>& patch_lower = patch_box.lower();
+    const Index<NDIM>& patch_upper = patch_box.upper();
+    const Index<NDIM>& box_lower = box.lower();
+    const IntVector<NDIM> box_extents = box.numberCells();
+
+    // Determine the sort key of each point.
+    const unsigned int n_qp = static_cast<unsigned int>(X_qp.size() / NDIM);
+    const unsigned int outside_key = static_cast<unsigned int>(box.size());
+    std::vector<unsigned int> keys(n_qp);
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
     {
-        elem->point(k) = s_node_cache[k];
+        const Index<NDIM> i = IndexUtilities::getCellIndex(&X_qp[NDIM * qp], patch_x_lower, patch_x_upper, patch_dx,
+                                                           patch_lower, patch_upper);
+        if (!box.contains(i))
+        {
+            keys[qp] = outside_key;
+            continue;
+        }
+        unsigned int key = 0;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            key = key * box_extents(d) + (i(d) - box_lower(d));
+        }
+        keys[qp] = key;
     }
-    return hmax;
-} // get_elem_hmax
+
+    // Sort the points by key.
+    qp_order.resize(n_qp);
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        qp_order[qp] = qp;
+    }
+    std::vector<unsigned int> sorted_keys(n_qp), sorted_qp_order(n_qp);
+    for (unsigned int shift = 0; shift < 32 && (outside_key >> shift) > 0; shift += 8)
+    {
+        boost::array<unsigned int, 257> offsets;
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (unsigned int k = 0; k < n_qp; ++k)
+        {
+            ++offsets[((keys[k] >> shift) & 0xff) + 1];
+        }
+        for (unsigned int b = 1; b < 257; ++b)
+        {
+            offsets[b] += offsets[b - 1];
+        }
+        for (unsigned int k = 0; k < n_qp; ++k)
+        {
+            const unsigned int pos = offsets[(keys[k] >> shift) & 0xff]++;
+            sorted_keys[pos] = keys[k];
+            sorted_qp_order[pos] = qp_order[k];
+        }
+        keys.swap(sorted_keys);
+        qp_order.swap(sorted_qp_order);
+    }
+    return;
+} // compute_cell_sorted_qp_order
+
+// Gather quadrature point data of the specified depth into the order specified
+// by qp_order.
+inline void gather_qp_data(std::vector<double>& sorted_data,
+                           const std::vector<double>& data,
+                           const unsigned int depth,
+                           const std::vector<unsigned int>& qp_order)
+{
+    const size_t n_qp = qp_order.size();
+    sorted_data.resize(depth * n_qp);
+    for (size_t k = 0; k < n_qp; ++k)
+    {
+        const double* const src = &data[depth * qp_order[k]];
+        std::copy(src, src + depth, &sorted_data[depth * k]);
+    }
+    return;
+} // gather_qp_data
+
+// Scatter quadrature point data of the specified depth from the order
+// specified by qp_order back to the original ordering.
+inline void scatter_qp_data(std::vector<double>& data,
+                            const std::vector<double>& sorted_data,
+                            const unsigned int depth,
+                            const std::vector<unsigned int>& qp_order)
+{
+    const size_t n_qp = qp_order.size();
+    for (size_t k = 0; k < n_qp; ++k)
+    {
+        const double* const src = &sorted_data[depth * k];
+        std::copy(src, src + depth, &data[depth * qp_order[k]]);
+    }
+    return;
+} // scatter_qp_data
 }
 
 const short int FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID = 0x100;
@@ -339,6 +465,28 @@ std::pair<int, int> FEDataManager::getPatchLevels() const
 
 void FEDataManager::setEquationSystems(EquationSystems* const equation_systems, const int level_number)
 {
+    // Delete cached L2 projection data associated with any previous equation
+    // systems object.
+    if (d_es && d_es != equation_systems)
+    {
+        std::set<std::string> system_names;
+        for (std::map<std::string, SparseMatrix<double>*>::const_iterator cit = d_L2_proj_matrix.begin();
+             cit != d_L2_proj_matrix.end(); ++cit)
+        {
+            system_names.insert(cit->first);
+        }
+        for (std::map<std::string, NumericVector<double>*>::const_iterator cit = d_L2_proj_matrix_diag.begin();
+             cit != d_L2_proj_matrix_diag.end(); ++cit)
+        {
+            system_names.insert(cit->first);
+        }
+        for (std::set<std::string>::const_iterator cit = system_names.begin(); cit != system_names.end(); ++cit)
+        {
+            clearL2ProjectionData(*cit);
+        }
+        clearQuadratureRuleCache(d_spread_qrule_cache);
+        clearQuadratureRuleCache(d_interp_qrule_cache);
+    }
     d_es = equation_systems;
     d_level_number = level_number;
     return;
@@ -387,6 +535,8 @@ void FEDataManager::reinitElementMappings()
         delete it->second;
     }
     d_system_ghost_vec.clear();
+    clearQuadratureRuleCache(d_spread_qrule_cache);
+    clearQuadratureRuleCache(d_interp_qrule_cache);
 
     // Reset the mappings between grid patches and active mesh elements.
     collectActivePatchElements(d_active_patch_elem_map, d_level_number, d_ghost_width);
@@ -446,9 +596,11 @@ void FEDataManager::spread(const int f_data_idx,
                            NumericVector<double>& X_vec,
                            const std::string& system_name,
                            RobinPhysBdryPatchStrategy* f_phys_bdry_op,
-                           const double fill_data_time)
+                           const double fill_data_time,
+                           const bool f_data_is_zero)
 {
-    spread(f_data_idx, F_vec, X_vec, system_name, d_default_spread_spec, f_phys_bdry_op, fill_data_time);
+    spread(f_data_idx, F_vec, X_vec, system_name, d_default_spread_spec, f_phys_bdry_op, fill_data_time,
+           f_data_is_zero);
     return;
 } // spread
 
@@ -458,7 +610,8 @@ void FEDataManager::spread(const int f_data_idx,
                            const std::string& system_name,
                            const FEDataManager::SpreadSpec& spread_spec,
                            RobinPhysBdryPatchStrategy* f_phys_bdry_op,
-                           const double fill_data_time)
+                           const double fill_data_time,
+                           const bool f_data_is_zero)
 {
     IBTK_TIMER_START(t_spread);
 
@@ -475,22 +628,16 @@ void FEDataManager::spread(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || sc_data);
 
-    // Make a copy of the Eulerian data.
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
-    }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
-        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
+    // Prepare the Eulerian data to accumulate spread values.  The physical
+    // boundary operator overwrites values on the physical boundary, and so in
+    // that case any nonzero existing values are stored in scratch data.
+    const bool preserve_data = !f_data_is_zero && f_phys_bdry_op != NULL;
+    d_spread_accumulator.beginAccumulation(f_data_idx, d_hierarchy, coarsest_ln, finest_ln, preserve_data);
 
     // Extract the mesh.
     const MeshBase& mesh = d_es->get_mesh();
     const unsigned int dim = mesh.mesh_dimension();
-    AutoPtr<QBase> qrule;
+    QBase* qrule = NULL;
 
     // Extract the FE systems and DOF maps, and setup the FE object.
     System& F_system = d_es->get_system(system_name);
@@ -537,7 +684,8 @@ void FEDataManager::spread(const int f_data_idx,
     // element quadrature points, then spread those values onto the Eulerian
     // grid.
     boost::multi_array<double, 2> F_node, X_node;
-    std::vector<double> F_JxW_qp, X_qp;
+    std::vector<double> F_JxW_qp, X_qp, F_JxW_qp_sorted, X_qp_sorted;
+    std::vector<unsigned int> qp_order;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
@@ -563,11 +711,9 @@ void FEDataManager::spread(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                qrule->init(elem->type(), elem->p_level());
-            }
+            updateCachedQuadratureRule(qrule, d_spread_qrule_cache, spread_spec.quad_type, spread_spec.quad_order,
+                                       spread_spec.use_adaptive_quadrature, spread_spec.point_density, elem, X_node,
+                                       patch_dx_min);
             n_qp_patch += qrule->n_points();
         }
         if (!n_qp_patch) continue;
@@ -576,7 +722,7 @@ void FEDataManager::spread(const int f_data_idx,
 
         // Loop over the elements and compute the values to be spread and the
         // positions of the quadrature points.
-        qrule.reset();
+        qrule = NULL;
         unsigned int qp_offset = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -591,7 +737,10 @@ void FEDataManager::spread(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
+            const bool qrule_needs_reinit =
+                updateCachedQuadratureRule(qrule, d_spread_qrule_cache, spread_spec.quad_type, spread_spec.quad_order,
+                                           spread_spec.use_adaptive_quadrature, spread_spec.point_density, elem, X_node,
+                                           patch_dx_min);
             if (qrule_needs_reinit)
             {
                 // NOTE: Because we are only using the shape function values for
@@ -600,8 +749,8 @@ void FEDataManager::spread(const int f_data_idx,
                 // notice that the shape function values depend only on the
                 // element type and quadrature rule, not on the element
                 // geometry.
-                F_fe->attach_quadrature_rule(qrule.get());
-                X_fe->attach_quadrature_rule(qrule.get());
+                F_fe->attach_quadrature_rule(qrule);
+                X_fe->attach_quadrature_rule(qrule);
                 if (X_fe != F_fe) X_fe->reinit(elem);
             }
             F_fe->reinit(elem);
@@ -630,21 +779,29 @@ void FEDataManager::spread(const int f_data_idx,
             qp_offset += n_qp;
         }
 
+        // Reorder the quadrature point data by Cartesian grid cell so that
+        // consecutive quadrature points access nearby Eulerian grid data.
+        const Box<NDIM> spread_box = Box<NDIM>::grow(patch->getBox(), d_ghost_width);
+        compute_cell_sorted_qp_order(qp_order, X_qp, *patch, spread_box);
+        gather_qp_data(F_JxW_qp_sorted, F_JxW_qp, n_vars, qp_order);
+        gather_qp_data(X_qp_sorted, X_qp, NDIM, qp_order);
+
         // Spread values from the quadrature points to the Cartesian grid patch.
         //
         // NOTE: Values are spread only from those quadrature points that are
         // within the ghost cell width of the patch interior.
-        const Box<NDIM> spread_box = Box<NDIM>::grow(patch->getBox(), d_ghost_width);
         Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
         if (cc_data)
         {
             Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-            LEInteractor::spread(f_cc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+            LEInteractor::spread(f_cc_data, F_JxW_qp_sorted, n_vars, X_qp_sorted, NDIM, patch, spread_box,
+                                 spread_spec.kernel_fcn);
         }
         if (sc_data)
         {
             Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-            LEInteractor::spread(f_sc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+            LEInteractor::spread(f_sc_data, F_JxW_qp_sorted, n_vars, X_qp_sorted, NDIM, patch, spread_box,
+                                 spread_spec.kernel_fcn);
         }
         if (f_phys_bdry_op)
         {
@@ -654,14 +811,7 @@ void FEDataManager::spread(const int f_data_idx,
     }
 
     // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
-    }
-    var_db->removePatchDataIndex(f_copy_data_idx);
+    d_spread_accumulator.endAccumulation();
 
     VecRestoreArray(F_local_vec, &F_local_soln);
     VecGhostRestoreLocalForm(F_global_vec, &F_local_vec);
@@ -927,7 +1077,7 @@ void FEDataManager::interp(const int f_data_idx,
     // Extract the mesh.
     const MeshBase& mesh = d_es->get_mesh();
     const unsigned int dim = mesh.mesh_dimension();
-    AutoPtr<QBase> qrule;
+    QBase* qrule = NULL;
 
     // Extract the FE systems and DOF maps, and setup the FE object.
     System& F_system = d_es->get_system(system_name);
@@ -973,7 +1123,8 @@ void FEDataManager::interp(const int f_data_idx,
     AutoPtr<NumericVector<double> > F_rhs_vec = F_vec.zero_clone();
     std::vector<DenseVector<double> > F_rhs_e(n_vars);
     boost::multi_array<double, 2> X_node;
-    std::vector<double> F_qp, X_qp;
+    std::vector<double> F_qp, X_qp, F_qp_sorted, X_qp_sorted;
+    std::vector<unsigned int> qp_order;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
@@ -999,20 +1150,17 @@ void FEDataManager::interp(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-            if (qrule_needs_reinit)
-            {
-                qrule->init(elem->type(), elem->p_level());
-            }
+            updateCachedQuadratureRule(qrule, d_interp_qrule_cache, interp_spec.quad_type, interp_spec.quad_order,
+                                       interp_spec.use_adaptive_quadrature, interp_spec.point_density, elem, X_node,
+                                       patch_dx_min);
             n_qp_patch += qrule->n_points();
         }
         if (!n_qp_patch) continue;
         F_qp.resize(n_vars * n_qp_patch);
         X_qp.resize(NDIM * n_qp_patch);
-        std::fill(F_qp.begin(), F_qp.end(), 0.0);
 
         // Loop over the elements and compute the positions of the quadrature points.
-        qrule.reset();
+        qrule = NULL;
         unsigned int qp_offset = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -1022,7 +1170,10 @@ void FEDataManager::interp(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
+            const bool qrule_needs_reinit =
+                updateCachedQuadratureRule(qrule, d_interp_qrule_cache, interp_spec.quad_type, interp_spec.quad_order,
+                                           interp_spec.use_adaptive_quadrature, interp_spec.point_density, elem, X_node,
+                                           patch_dx_min);
             if (qrule_needs_reinit)
             {
                 // NOTE: Because we are only using the shape function values for
@@ -1031,7 +1182,7 @@ void FEDataManager::interp(const int f_data_idx,
                 // notice that the shape function values depend only on the
                 // element type and quadrature rule, not on the element
                 // geometry.
-                X_fe->attach_quadrature_rule(qrule.get());
+                X_fe->attach_quadrature_rule(qrule);
                 X_fe->reinit(elem);
             }
             const unsigned int n_node = elem->n_nodes();
@@ -1052,26 +1203,37 @@ void FEDataManager::interp(const int f_data_idx,
             qp_offset += n_qp;
         }
 
+        // Reorder the quadrature point positions by Cartesian grid cell so that
+        // consecutive quadrature points access nearby Eulerian grid data.
+        const Box<NDIM>& interp_box = patch->getBox();
+        compute_cell_sorted_qp_order(qp_order, X_qp, *patch, interp_box);
+        gather_qp_data(X_qp_sorted, X_qp, NDIM, qp_order);
+        F_qp_sorted.resize(n_vars * n_qp_patch);
+        std::fill(F_qp_sorted.begin(), F_qp_sorted.end(), 0.0);
+
         // Interpolate values from the Cartesian grid patch to the quadrature
-        // points.
+        // points, and then return the interpolated values to the element
+        // ordering of the quadrature points.
         //
         // NOTE: Values are interpolated only to those quadrature points that
         // are within the patch interior.
-        const Box<NDIM>& interp_box = patch->getBox();
         Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
         if (cc_data)
         {
             Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-            LEInteractor::interpolate(F_qp, n_vars, X_qp, NDIM, f_cc_data, patch, interp_box, interp_spec.kernel_fcn);
+            LEInteractor::interpolate(F_qp_sorted, n_vars, X_qp_sorted, NDIM, f_cc_data, patch, interp_box,
+                                      interp_spec.kernel_fcn);
         }
         if (sc_data)
         {
             Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-            LEInteractor::interpolate(F_qp, n_vars, X_qp, NDIM, f_sc_data, patch, interp_box, interp_spec.kernel_fcn);
+            LEInteractor::interpolate(F_qp_sorted, n_vars, X_qp_sorted, NDIM, f_sc_data, patch, interp_box,
+                                      interp_spec.kernel_fcn);
         }
+        scatter_qp_data(F_qp, F_qp_sorted, n_vars, qp_order);
 
         // Loop over the elements and accumulate the right-hand-side values.
-        qrule.reset();
+        qrule = NULL;
         qp_offset = 0;
         for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
         {
@@ -1086,7 +1248,10 @@ void FEDataManager::interp(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
+            const bool qrule_needs_reinit =
+                updateCachedQuadratureRule(qrule, d_interp_qrule_cache, interp_spec.quad_type, interp_spec.quad_order,
+                                           interp_spec.use_adaptive_quadrature, interp_spec.point_density, elem, X_node,
+                                           patch_dx_min);
             if (qrule_needs_reinit)
             {
                 // NOTE: Because we are only using the shape function values for
@@ -1095,8 +1260,8 @@ void FEDataManager::interp(const int f_data_idx,
                 // notice that the shape function values depend only on the
                 // element type and quadrature rule, not on the element
                 // geometry.
-                F_fe->attach_quadrature_rule(qrule.get());
-                X_fe->attach_quadrature_rule(qrule.get());
+                F_fe->attach_quadrature_rule(qrule);
+                X_fe->attach_quadrature_rule(qrule);
                 if (X_fe != F_fe) X_fe->reinit(elem);
             }
             F_fe->reinit(elem);
@@ -1356,12 +1521,17 @@ FEDataManager::buildL2ProjectionSolver(const std::string& system_name,
 {
     IBTK_TIMER_START(t_build_l2_projection_solver);
 
-    if (!d_L2_proj_solver.count(system_name) || !d_L2_proj_matrix.count(system_name) ||
-        (d_L2_proj_quad_type[system_name] != quad_type) || (d_L2_proj_quad_order[system_name] != quad_order))
+    if (!d_L2_proj_matrix.count(system_name) || (d_L2_proj_quad_type[system_name] != quad_type) ||
+        (d_L2_proj_quad_order[system_name] != quad_order))
     {
         plog << "FEDataManager::buildL2ProjectionSolver(): building L2 projection solver for "
                 "system: " << system_name << "\n";
 
+        // Deallocate any previously built solver components.
+        if (d_L2_proj_solver.count(system_name)) delete d_L2_proj_solver[system_name];
+        if (d_L2_proj_matrix.count(system_name)) delete d_L2_proj_matrix[system_name];
+        clearL2ProjectionBlockSolvers(system_name);
+
         // Extract the mesh.
         const MeshBase& mesh = d_es->get_mesh();
         const Parallel::Communicator& comm = mesh.comm();
@@ -1475,6 +1645,15 @@ FEDataManager::buildL2ProjectionSolver(const std::string& system_name,
         d_L2_proj_quad_type[system_name] = quad_type;
         d_L2_proj_quad_order[system_name] = quad_order;
     }
+    else if (!d_L2_proj_solver.count(system_name))
+    {
+        // The solver is freed once the block solvers are built, but the mass
+        // matrix is retained and need not be rebuilt.
+        LinearSolver<double>* solver = LinearSolver<double>::build(d_es->get_mesh().comm()).release();
+        solver->init();
+        solver->reuse_preconditioner(true);
+        d_L2_proj_solver[system_name] = solver;
+    }
 
     IBTK_TIMER_STOP(t_build_l2_projection_solver);
     return std::make_pair(d_L2_proj_solver[system_name], d_L2_proj_matrix[system_name]);
@@ -1620,6 +1799,17 @@ NumericVector<double>* FEDataManager::buildDiagonalL2MassMatrix(const std::strin
     return d_L2_proj_matrix_diag[system_name];
 } // buildDiagonalL2MassMatrix
 
+void FEDataManager::setUseBlockL2ProjectionSolver(const bool use_block_L2_proj_solver)
+{
+    d_use_block_L2_proj_solver = use_block_L2_proj_solver;
+    return;
+} // setUseBlockL2ProjectionSolver
+
+bool FEDataManager::getUseBlockL2ProjectionSolver() const
+{
+    return d_use_block_L2_proj_solver;
+} // getUseBlockL2ProjectionSolver
+
 bool FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
                                         NumericVector<double>& F_vec,
                                         const std::string& system_name,
@@ -1637,7 +1827,61 @@ bool FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
     /*if (!F_vec.closed())*/ F_vec.close();
     const System& system = d_es->get_system(system_name);
     const DofMap& dof_map = system.get_dof_map();
-    if (consistent_mass_matrix)
+    checkL2ProjectionData(system_name);
+    if (consistent_mass_matrix && d_use_block_L2_proj_solver)
+    {
+        if (!d_L2_proj_block_ksp.count(system_name) || (d_L2_proj_quad_type[system_name] != quad_type) ||
+            (d_L2_proj_quad_order[system_name] != quad_order))
+        {
+            buildL2ProjectionSolver(system_name, quad_type, quad_order);
+            buildL2ProjectionBlockSolvers(system_name);
+
+            // Only the mass matrix is required by the block solvers, and so the
+            // solver for the full system is freed.
+            delete d_L2_proj_solver[system_name];
+            d_L2_proj_solver.erase(system_name);
+        }
+        PetscBool rtol_set;
+        double runtime_rtol;
+        ierr = PetscOptionsGetReal("fe_l2_proj_", "-ksp_rtol", &runtime_rtol, &rtol_set);
+        IBTK_CHKERRQ(ierr);
+        PetscBool max_it_set;
+        int runtime_max_it;
+        ierr = PetscOptionsGetInt("fe_l2_proj_", "-ksp_max_it", &runtime_max_it, &max_it_set);
+        IBTK_CHKERRQ(ierr);
+
+        // Solve for each variable using the solver associated with its block
+        // of the mass matrix.
+        Vec U_petsc_vec = static_cast<PetscVector<double>*>(&U_vec)->vec();
+        Vec F_petsc_vec = static_cast<PetscVector<double>*>(&F_vec)->vec();
+        const std::vector<IS>& block_is = d_L2_proj_block_is[system_name];
+        const std::vector<int>& block_ksp_idx = d_L2_proj_block_ksp_idx[system_name];
+        const std::vector<KSP>& block_ksp = d_L2_proj_block_ksp[system_name];
+        converged = true;
+        for (unsigned int var_num = 0; var_num < block_is.size(); ++var_num)
+        {
+            KSP ksp = block_ksp[block_ksp_idx[var_num]];
+            ierr = KSPSetTolerances(ksp, rtol_set ? runtime_rtol : tol, PETSC_DEFAULT, PETSC_DEFAULT,
+                                    max_it_set ? runtime_max_it : static_cast<int>(max_its));
+            IBTK_CHKERRQ(ierr);
+            Vec U_block_vec, F_block_vec;
+            ierr = VecGetSubVector(U_petsc_vec, block_is[var_num], &U_block_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecGetSubVector(F_petsc_vec, block_is[var_num], &F_block_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSolve(ksp, F_block_vec, U_block_vec);
+            IBTK_CHKERRQ(ierr);
+            KSPConvergedReason reason;
+            ierr = KSPGetConvergedReason(ksp, &reason);
+            IBTK_CHKERRQ(ierr);
+            converged = converged && reason > 0;
+            ierr = VecRestoreSubVector(F_petsc_vec, block_is[var_num], &F_block_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecRestoreSubVector(U_petsc_vec, block_is[var_num], &U_block_vec);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    else if (consistent_mass_matrix)
     {
         std::pair<libMesh::LinearSolver<double>*, SparseMatrix<double>*> proj_solver_components =
             buildL2ProjectionSolver(system_name, quad_type, quad_order);
@@ -1692,19 +1936,7 @@ bool FEDataManager::updateQuadratureRule(AutoPtr<QBase>& qrule,
         const double hmax = get_elem_hmax(elem, X_node);
         const int min_pts = elem->default_order() == FIRST ? 2 : 3;
         const int npts = std::max(min_pts, static_cast<int>(std::ceil(point_density * hmax / dx_min)));
-        switch (type)
-        {
-        case QGAUSS:
-            order = static_cast<Order>(std::min(2 * npts - 1, static_cast<int>(FORTYTHIRD)));
-            break;
-        case QGRID:
-            order = static_cast<Order>(npts);
-            break;
-        default:
-            TBOX_ERROR("FEDataManager::updateQuadratureRule():\n"
-                       << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
-                          "or QGRID\n");
-        }
+        order = get_adaptive_quad_order(type, npts);
     }
     bool qrule_needs_reinit = false;
     if (!qrule.get() || qrule->type() != type || qrule->get_dim() != dim || qrule->get_order() != order)
@@ -1739,6 +1971,32 @@ bool FEDataManager::updateSpreadQuadratureRule(AutoPtr<QBase>& qrule,
                                 spec.point_density, elem, X_node, dx_min);
 }
 
+void FEDataManager::setAdaptiveQuadratureHysteresis(const double hysteresis)
+{
+    TBOX_ASSERT(hysteresis >= 0.0 && hysteresis < 1.0);
+    d_adaptive_quad_hysteresis = hysteresis;
+    return;
+} // setAdaptiveQuadratureHysteresis
+
+void FEDataManager::printQuadratureRuleCacheStatistics(std::ostream& os) const
+{
+    const QuadratureRuleCache* const caches[2] = { &d_spread_qrule_cache, &d_interp_qrule_cache };
+    const char* const cache_names[2] = { "spread", "interp" };
+    os << d_object_name << "::printQuadratureRuleCacheStatistics():\n";
+    for (int k = 0; k < 2; ++k)
+    {
+        const QuadratureRuleCache& cache = *caches[k];
+        const double reuse_fraction =
+            cache.num_lookups ? 1.0 - static_cast<double>(cache.num_updates) / static_cast<double>(cache.num_lookups) :
+                                0.0;
+        os << "  " << cache_names[k] << " quadrature rules: " << cache.num_lookups << " element lookups, "
+           << cache.num_updates << " element updates (" << 100.0 * reuse_fraction << "% reused), "
+           << cache.num_rule_builds << " rules built, " << cache.qrules.size() << " rules cached, "
+           << cache.num_resets << " cache resets\n";
+    }
+    return;
+} // printQuadratureRuleCacheStatistics
+
 void FEDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest_ln_in)
 {
     if (!d_load_balancer) return;
@@ -1976,9 +2234,12 @@ FEDataManager::FEDataManager(const std::string& object_name,
                              bool register_for_restart)
     : COORDINATES_SYSTEM_NAME("coordinates system"), d_object_name(object_name),
       d_registered_for_restart(register_for_restart), d_load_balancer(NULL), d_hierarchy(NULL), d_coarsest_ln(-1),
-      d_finest_ln(-1), d_default_interp_spec(default_interp_spec), d_default_spread_spec(default_spread_spec),
-      d_ghost_width(ghost_width), d_es(NULL), d_level_number(-1), d_active_patch_ghost_dofs(), d_L2_proj_solver(),
-      d_L2_proj_matrix(), d_L2_proj_matrix_diag(), d_L2_proj_quad_type(), d_L2_proj_quad_order()
+      d_finest_ln(-1), d_spread_accumulator(), d_default_interp_spec(default_interp_spec),
+      d_default_spread_spec(default_spread_spec), d_ghost_width(ghost_width), d_es(NULL), d_level_number(-1),
+      d_active_patch_ghost_dofs(), d_L2_proj_solver(), d_L2_proj_matrix(), d_L2_proj_matrix_diag(),
+      d_L2_proj_quad_type(), d_L2_proj_quad_order(), d_L2_proj_dof_map_signature(), d_use_block_L2_proj_solver(false),
+      d_L2_proj_block_is(), d_L2_proj_block_ksp_idx(), d_L2_proj_block_ksp(), d_spread_qrule_cache(),
+      d_interp_qrule_cache(), d_adaptive_quad_hysteresis(0.1)
 {
     TBOX_ASSERT(!object_name.empty());
 
@@ -2049,6 +2310,12 @@ FEDataManager::~FEDataManager()
     {
         delete it->second;
     }
+    while (!d_L2_proj_block_is.empty())
+    {
+        clearL2ProjectionBlockSolvers(d_L2_proj_block_is.begin()->first);
+    }
+    clearQuadratureRuleCache(d_spread_qrule_cache);
+    clearQuadratureRuleCache(d_interp_qrule_cache);
     return;
 } // ~FEDataManager
 
@@ -2504,6 +2771,329 @@ void FEDataManager::collectGhostDOFIndices(std::vector<unsigned int>& ghost_dofs
     return;
 } // collectGhostDOFIndices
 
+bool FEDataManager::updateCachedQuadratureRule(QBase*& qrule,
+                                               QuadratureRuleCache& cache,
+                                               const QuadratureType type,
+                                               const Order order,
+                                               const bool use_adaptive_quadrature,
+                                               const double point_density,
+                                               Elem* const elem,
+                                               const boost::multi_array<double, 2>& X_node,
+                                               const double dx_min)
+{
+    // Reset the cache if the quadrature rule specification has changed.
+    if (cache.quad_type != type || cache.quad_order != order ||
+        cache.use_adaptive_quadrature != use_adaptive_quadrature || cache.point_density != point_density)
+    {
+        clearQuadratureRuleCache(cache);
+        cache.quad_type = type;
+        cache.quad_order = order;
+        cache.use_adaptive_quadrature = use_adaptive_quadrature;
+        cache.point_density = point_density;
+    }
+    const unsigned int elem_id = elem->id();
+    if (elem_id >= cache.elem_qrule.size())
+    {
+        const size_t cache_size = std::max(static_cast<size_t>(elem_id) + 1,
+                                           static_cast<size_t>(d_es->get_mesh().max_elem_id()));
+        cache.elem_qrule.resize(cache_size, NULL);
+        cache.elem_npts.resize(cache_size, 0);
+        cache.elem_dx_min.resize(cache_size, 0.0);
+    }
+    ++cache.num_lookups;
+
+    // Determine whether the cached rule for this element can be reused.
+    QBase*& elem_qrule = cache.elem_qrule[elem_id];
+    int& elem_npts = cache.elem_npts[elem_id];
+    double& elem_dx_min = cache.elem_dx_min[elem_id];
+    bool reuse_elem_qrule = elem_qrule && elem_qrule->get_elem_type() == elem->type() &&
+                            elem_qrule->get_p_level() == elem->p_level() && elem_dx_min == dx_min;
+    int npts = 0;
+    Order elem_order = order;
+    if (use_adaptive_quadrature)
+    {
+        // The number of points is increased as soon as the deformed element
+        // requires more points, but it is only decreased once the required
+        // number of points is sufficiently below the threshold for the
+        // smaller rule.
+        const double npts_est = point_density * get_elem_hmax(elem, X_node) / dx_min;
+        const int min_pts = elem->default_order() == FIRST ? 2 : 3;
+        npts = std::max(min_pts, static_cast<int>(std::ceil(npts_est)));
+        if (reuse_elem_qrule && npts < elem_npts &&
+            npts_est > (1.0 - d_adaptive_quad_hysteresis) * static_cast<double>(elem_npts - 1))
+        {
+            npts = elem_npts;
+        }
+        reuse_elem_qrule = reuse_elem_qrule && npts == elem_npts;
+        elem_order = get_adaptive_quad_order(type, npts);
+    }
+
+    // Update the cached rule for this element, building a new rule if needed.
+    if (!reuse_elem_qrule)
+    {
+        ++cache.num_updates;
+        const std::pair<int, std::pair<int, int> > qrule_key =
+            std::make_pair(static_cast<int>(elem_order),
+                           std::make_pair(static_cast<int>(elem->type()), static_cast<int>(elem->p_level())));
+        std::map<std::pair<int, std::pair<int, int> >, QBase*>::iterator it = cache.qrules.find(qrule_key);
+        if (it == cache.qrules.end())
+        {
+            const unsigned int dim = elem->dim();
+            QBase* new_qrule =
+                (type == QGRID ? new QGrid(dim, elem_order) : QBase::build(type, dim, elem_order).release());
+            new_qrule->init(elem->type(), elem->p_level());
+            it = cache.qrules.insert(std::make_pair(qrule_key, new_qrule)).first;
+            ++cache.num_rule_builds;
+        }
+        elem_qrule = it->second;
+        elem_npts = npts;
+        elem_dx_min = dx_min;
+    }
+    const bool qrule_changed = qrule != elem_qrule;
+    qrule = elem_qrule;
+    return qrule_changed;
+} // updateCachedQuadratureRule
+
+void FEDataManager::clearQuadratureRuleCache(QuadratureRuleCache& cache)
+{
+    for (std::map<std::pair<int, std::pair<int, int> >, QBase*>::iterator it = cache.qrules.begin();
+         it != cache.qrules.end(); ++it)
+    {
+        delete it->second;
+    }
+    cache.qrules.clear();
+    cache.elem_qrule.clear();
+    cache.elem_npts.clear();
+    cache.elem_dx_min.clear();
+    ++cache.num_resets;
+    return;
+} // clearQuadratureRuleCache
+
+void FEDataManager::buildL2ProjectionBlockSolvers(const std::string& system_name)
+{
+    if (d_L2_proj_block_ksp.count(system_name)) return;
+
+    plog << "FEDataManager::buildL2ProjectionBlockSolvers(): building L2 projection block solvers for system: "
+         << system_name << "\n";
+
+    int ierr;
+
+    // Extract the mesh, the FE system and DOF map, and the mass matrix.
+    const MeshBase& mesh = d_es->get_mesh();
+    const System& system = d_es->get_system(system_name);
+    const DofMap& dof_map = system.get_dof_map();
+    const unsigned int n_vars = system.n_vars();
+    const unsigned int first_local_dof = dof_map.first_dof();
+    const unsigned int end_local_dof = dof_map.end_dof();
+    TBOX_ASSERT(d_L2_proj_matrix.count(system_name));
+    Mat M_mat = static_cast<PetscMatrix<double>*>(d_L2_proj_matrix[system_name])->mat();
+    MPI_Comm petsc_comm = PetscObjectComm(reinterpret_cast<PetscObject>(M_mat));
+
+    // Determine the locally owned DOFs associated with each variable.
+    std::vector<std::vector<int> > var_dofs(n_vars);
+    std::vector<unsigned int> dof_indices;
+    const MeshBase::const_element_iterator el_begin = mesh.active_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        for (unsigned int var_num = 0; var_num < n_vars; ++var_num)
+        {
+            dof_map.dof_indices(elem, dof_indices, var_num);
+            for (std::vector<unsigned int>::const_iterator cit = dof_indices.begin(); cit != dof_indices.end(); ++cit)
+            {
+                if (*cit >= first_local_dof && *cit < end_local_dof) var_dofs[var_num].push_back(*cit);
+            }
+        }
+    }
+
+    // Extract the block of the mass matrix associated with each variable.
+    // Variables with identical blocks share a single solver.
+    std::vector<IS>& block_is = d_L2_proj_block_is[system_name];
+    std::vector<int>& block_ksp_idx = d_L2_proj_block_ksp_idx[system_name];
+    std::vector<KSP>& block_ksp = d_L2_proj_block_ksp[system_name];
+    block_is.resize(n_vars);
+    block_ksp_idx.resize(n_vars);
+    std::vector<Mat> block_mats;
+    for (unsigned int var_num = 0; var_num < n_vars; ++var_num)
+    {
+        std::vector<int>& dofs = var_dofs[var_num];
+        std::sort(dofs.begin(), dofs.end());
+        dofs.erase(std::unique(dofs.begin(), dofs.end()), dofs.end());
+        const int n_dofs = static_cast<int>(dofs.size());
+        ierr = ISCreateGeneral(
+            petsc_comm, n_dofs, (dofs.empty() ? NULL : &dofs[0]), PETSC_COPY_VALUES, &block_is[var_num]);
+        IBTK_CHKERRQ(ierr);
+        Mat M_block;
+        ierr = MatGetSubMatrix(M_mat, block_is[var_num], block_is[var_num], MAT_INITIAL_MATRIX, &M_block);
+        IBTK_CHKERRQ(ierr);
+        int m_block, n_block;
+        ierr = MatGetSize(M_block, &m_block, &n_block);
+        IBTK_CHKERRQ(ierr);
+        block_ksp_idx[var_num] = -1;
+        for (unsigned int k = 0; k < block_mats.size() && block_ksp_idx[var_num] < 0; ++k)
+        {
+            int m_k, n_k;
+            ierr = MatGetSize(block_mats[k], &m_k, &n_k);
+            IBTK_CHKERRQ(ierr);
+            if (m_k != m_block || n_k != n_block) continue;
+            PetscBool blocks_equal;
+            ierr = MatEqual(block_mats[k], M_block, &blocks_equal);
+            IBTK_CHKERRQ(ierr);
+            if (blocks_equal) block_ksp_idx[var_num] = static_cast<int>(k);
+        }
+        if (block_ksp_idx[var_num] >= 0)
+        {
+            ierr = MatDestroy(&M_block);
+            IBTK_CHKERRQ(ierr);
+        }
+        else
+        {
+            block_ksp_idx[var_num] = static_cast<int>(block_mats.size());
+            block_mats.push_back(M_block);
+        }
+    }
+
+    // Setup one solver for each distinct block.  Unless overridden at runtime,
+    // the block solvers use block Jacobi preconditioners with exact local LU
+    // factorizations, which are computed here and reused by all subsequent
+    // solves.
+    for (unsigned int k = 0; k < block_mats.size(); ++k)
+    {
+        KSP ksp;
+        ierr = KSPCreate(petsc_comm, &ksp);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetOperators(ksp, block_mats[k], block_mats[k]);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetReusePreconditioner(ksp, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetType(ksp, KSPGMRES);
+        IBTK_CHKERRQ(ierr);
+        PC pc;
+        ierr = KSPGetPC(ksp, &pc);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCSetType(pc, PCBJACOBI);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetOptionsPrefix(ksp, "fe_l2_proj_");
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetFromOptions(ksp);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetUp(ksp);
+        IBTK_CHKERRQ(ierr);
+        PetscBool is_bjacobi;
+        ierr = PetscObjectTypeCompare(reinterpret_cast<PetscObject>(pc), PCBJACOBI, &is_bjacobi);
+        IBTK_CHKERRQ(ierr);
+        if (is_bjacobi)
+        {
+            int n_local_blocks;
+            KSP* sub_ksps;
+            ierr = PCBJacobiGetSubKSP(pc, &n_local_blocks, NULL, &sub_ksps);
+            IBTK_CHKERRQ(ierr);
+            for (int b = 0; b < n_local_blocks; ++b)
+            {
+                ierr = KSPSetType(sub_ksps[b], KSPPREONLY);
+                IBTK_CHKERRQ(ierr);
+                PC sub_pc;
+                ierr = KSPGetPC(sub_ksps[b], &sub_pc);
+                IBTK_CHKERRQ(ierr);
+                ierr = PCSetType(sub_pc, PCLU);
+                IBTK_CHKERRQ(ierr);
+                ierr = KSPSetFromOptions(sub_ksps[b]);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+        ierr = KSPSetUpOnBlocks(ksp);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatDestroy(&block_mats[k]);
+        IBTK_CHKERRQ(ierr);
+        block_ksp.push_back(ksp);
+    }
+    return;
+} // buildL2ProjectionBlockSolvers
+
+void FEDataManager::clearL2ProjectionBlockSolvers(const std::string& system_name)
+{
+    int ierr;
+    std::map<std::string, std::vector<KSP> >::iterator ksp_it = d_L2_proj_block_ksp.find(system_name);
+    if (ksp_it != d_L2_proj_block_ksp.end())
+    {
+        for (std::vector<KSP>::iterator it = ksp_it->second.begin(); it != ksp_it->second.end(); ++it)
+        {
+            ierr = KSPDestroy(&(*it));
+            IBTK_CHKERRQ(ierr);
+        }
+        d_L2_proj_block_ksp.erase(ksp_it);
+    }
+    std::map<std::string, std::vector<IS> >::iterator is_it = d_L2_proj_block_is.find(system_name);
+    if (is_it != d_L2_proj_block_is.end())
+    {
+        for (std::vector<IS>::iterator it = is_it->second.begin(); it != is_it->second.end(); ++it)
+        {
+            ierr = ISDestroy(&(*it));
+            IBTK_CHKERRQ(ierr);
+        }
+        d_L2_proj_block_is.erase(is_it);
+    }
+    d_L2_proj_block_ksp_idx.erase(system_name);
+    return;
+} // clearL2ProjectionBlockSolvers
+
+void FEDataManager::clearL2ProjectionData(const std::string& system_name)
+{
+    clearL2ProjectionBlockSolvers(system_name);
+    std::map<std::string, LinearSolver<double>*>::iterator solver_it = d_L2_proj_solver.find(system_name);
+    if (solver_it != d_L2_proj_solver.end())
+    {
+        delete solver_it->second;
+        d_L2_proj_solver.erase(solver_it);
+    }
+    std::map<std::string, SparseMatrix<double>*>::iterator matrix_it = d_L2_proj_matrix.find(system_name);
+    if (matrix_it != d_L2_proj_matrix.end())
+    {
+        delete matrix_it->second;
+        d_L2_proj_matrix.erase(matrix_it);
+    }
+    std::map<std::string, NumericVector<double>*>::iterator diag_it = d_L2_proj_matrix_diag.find(system_name);
+    if (diag_it != d_L2_proj_matrix_diag.end())
+    {
+        delete diag_it->second;
+        d_L2_proj_matrix_diag.erase(diag_it);
+    }
+    d_L2_proj_quad_type.erase(system_name);
+    d_L2_proj_quad_order.erase(system_name);
+    d_L2_proj_dof_map_signature.erase(system_name);
+    return;
+} // clearL2ProjectionData
+
+void FEDataManager::checkL2ProjectionData(const std::string& system_name)
+{
+    // The cached data are rebuilt on all processes whenever the DOF
+    // distribution changes on any process.
+    const DofMap& dof_map = d_es->get_system(system_name).get_dof_map();
+    std::vector<unsigned int> signature(3);
+    signature[0] = dof_map.n_dofs();
+    signature[1] = dof_map.first_dof();
+    signature[2] = dof_map.end_dof();
+    std::map<std::string, std::vector<unsigned int> >::const_iterator cit =
+        d_L2_proj_dof_map_signature.find(system_name);
+    const bool dof_map_changed = cit != d_L2_proj_dof_map_signature.end() && cit->second != signature;
+
+    // The reduction is only required when there are cached data to invalidate
+    // or when the block solvers are to be used.  Because these data are built
+    // collectively, all processes make the same choice here.
+    const bool check_all_procs = d_use_block_L2_proj_solver || d_L2_proj_solver.count(system_name) ||
+                                 d_L2_proj_matrix.count(system_name) || d_L2_proj_matrix_diag.count(system_name) ||
+                                 d_L2_proj_block_ksp.count(system_name);
+    if (check_all_procs && SAMRAI_MPI::maxReduction(dof_map_changed ? 1 : 0))
+    {
+        plog << "FEDataManager::checkL2ProjectionData(): DOF map changed; clearing L2 projection data for system: "
+             << system_name << "\n";
+        clearL2ProjectionData(system_name);
+    }
+    d_L2_proj_dof_map_signature[system_name] = signature;
+    return;
+} // checkL2ProjectionData
+
 void FEDataManager::getFromRestart()
 {
     Pointer<Database> restart_db = RestartManager::getManager()->getRootDatabase();
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -139,7 +140,7 @@ LData::LData(const std::string& name,
     return;
 } // LData
 
-LData::LData(Pointer<Database> db)
+LData::LData(Pointer<Database> db, const std::vector<double>* const vals_snapshot)
     : d_name(db->getString("d_name")), d_global_node_count(0), d_local_node_count(0), d_ghost_node_count(0),
       d_depth(db->getInteger("d_depth")), d_nonlocal_petsc_indices(), d_global_vec(NULL), d_array(NULL),
       d_boost_array(NULL), d_boost_local_array(NULL), d_boost_vec_array(NULL), d_boost_local_vec_array(NULL),
@@ -191,11 +192,24 @@ LData::LData(Pointer<Database> db)
     d_local_node_count = num_local_nodes;
     d_ghost_node_count = static_cast<int>(d_nonlocal_petsc_indices.size());
 
-    // Extract the values from the database.
+    // Extract the values from the database (or from the snapshot buffer).
     double* ghosted_local_vec_array = getGhostedLocalFormVecArray()->data();
-    if (num_local_nodes + num_ghost_nodes > 0)
+    const int num_vals = d_depth * (num_local_nodes + num_ghost_nodes);
+    if (num_vals > 0 && db->keyExists("vals_offset"))
+    {
+        const int vals_offset = db->getInteger("vals_offset");
+        if (!vals_snapshot || vals_offset < 0 ||
+            static_cast<size_t>(vals_offset + num_vals) > vals_snapshot->size())
+        {
+            TBOX_ERROR("LData::LData(): data values for " << d_name << " not found in the snapshot buffer.\n");
+        }
+        std::copy(vals_snapshot->begin() + vals_offset,
+                  vals_snapshot->begin() + vals_offset + num_vals,
+                  ghosted_local_vec_array);
+    }
+    else if (num_vals > 0)
     {
-        db->getDoubleArray("vals", ghosted_local_vec_array, d_depth * (num_local_nodes + num_ghost_nodes));
+        db->getDoubleArray("vals", ghosted_local_vec_array, num_vals);
     }
     restoreArrays();
     return;
@@ -278,6 +292,32 @@ void LData::putToDatabase(Pointer<Database> db)
     return;
 } // putToDatabase
 
+void LData::putToDatabase(Pointer<Database> db, std::vector<double>& vals_snapshot)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(db);
+#endif
+    const int num_local_nodes = getLocalNodeCount();
+    const int num_ghost_nodes = static_cast<int>(d_nonlocal_petsc_indices.size());
+    db->putString("d_name", d_name);
+    db->putInteger("d_depth", d_depth);
+    db->putInteger("num_local_nodes", num_local_nodes);
+    db->putInteger("num_ghost_nodes", num_ghost_nodes);
+    if (num_ghost_nodes > 0)
+    {
+        db->putIntegerArray("d_nonlocal_petsc_indices", &d_nonlocal_petsc_indices[0], num_ghost_nodes);
+    }
+    const int num_vals = d_depth * (num_local_nodes + num_ghost_nodes);
+    db->putInteger("vals_offset", static_cast<int>(vals_snapshot.size()));
+    if (num_vals > 0)
+    {
+        const double* const ghosted_local_vec_array = getGhostedLocalFormVecArray()->data();
+        vals_snapshot.insert(vals_snapshot.end(), ghosted_local_vec_array, ghosted_local_vec_array + num_vals);
+        restoreArrays();
+    }
+    return;
+} // putToDatabase
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
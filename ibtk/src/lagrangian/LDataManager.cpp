@@ -33,8 +33,13 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <math.h>
+#include <pthread.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <string.h>
 #include <algorithm>
+#include <fstream>
+#include <functional>
 #include <limits>
 #include <map>
 #include <numeric>
@@ -64,8 +69,7 @@
 #include "EdgeData.h"
 #include "EdgeVariable.h"
 #include "HierarchyCellDataOpsReal.h"
-#include "HierarchyDataOpsManager.h"
-#include "HierarchyDataOpsReal.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "MultiblockDataTranslator.h"
@@ -128,15 +132,6 @@
 #include "tbox/Transaction.h"
 #include "tbox/Utilities.h"
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Index;
-} // namespace hier
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -169,12 +164,178 @@ static const int CFL_WIDTH = 2;
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
 
+// Identifier written at the beginning of asynchronous checkpoint files.
+static const int ASYNC_CHECKPOINT_MAGIC = 0x4c444d43;
+
 inline int round(double x)
 {
     return floor(x + 0.5);
 } // round
+
+template <typename T>
+inline void pack_vals(std::vector<char>& buffer, const T* const vals, const size_t n)
+{
+    if (n == 0) return;
+    const char* const begin = reinterpret_cast<const char*>(vals);
+    buffer.insert(buffer.end(), begin, begin + n * sizeof(T));
+    return;
+} // pack_vals
+
+template <typename T>
+inline T unpack_val(const std::vector<char>& buffer, size_t& pos)
+{
+    if (pos + sizeof(T) > buffer.size())
+    {
+        TBOX_ERROR("LDataManager: unexpected end of checkpoint data.\n");
+    }
+    T val;
+    memcpy(&val, &buffer[pos], sizeof(T));
+    pos += sizeof(T);
+    return val;
+} // unpack_val
+
+// Write the data to a temporary file that is renamed once the write has
+// completed, so that partially written checkpoint files are never mistaken for
+// complete ones.
+template <typename T>
+bool write_checkpoint_file(const std::string& filename, const std::vector<T>& data)
+{
+    const std::string tmp_filename = filename + ".tmp";
+    std::ofstream of(tmp_filename.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!of) return false;
+    const size_t num_bytes = data.size() * sizeof(T);
+    of.write(reinterpret_cast<const char*>(&ASYNC_CHECKPOINT_MAGIC), sizeof(int));
+    of.write(reinterpret_cast<const char*>(&num_bytes), sizeof(size_t));
+    if (num_bytes > 0) of.write(reinterpret_cast<const char*>(&data[0]), num_bytes);
+    of.close();
+    if (!of) return false;
+    return rename(tmp_filename.c_str(), filename.c_str()) == 0;
+} // write_checkpoint_file
+
+template <typename T>
+bool read_checkpoint_file(const std::string& filename, std::vector<T>& data)
+{
+    std::ifstream is(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!is) return false;
+    int magic = 0;
+    size_t num_bytes = 0;
+    is.read(reinterpret_cast<char*>(&magic), sizeof(int));
+    is.read(reinterpret_cast<char*>(&num_bytes), sizeof(size_t));
+    if (!is || magic != ASYNC_CHECKPOINT_MAGIC || num_bytes % sizeof(T) != 0) return false;
+    data.resize(num_bytes / sizeof(T));
+    if (num_bytes > 0) is.read(reinterpret_cast<char*>(&data[0]), num_bytes);
+    return !is.fail();
+} // read_checkpoint_file
+
+// Data used to reorder the local nodes.
+struct LNodeOrderingData
+{
+    unsigned long key;
+    int lag_idx;
+    LNode* node;
+};
+
+struct LNodeOrderingDataComp : std::binary_function<const LNodeOrderingData&, const LNodeOrderingData&, bool>
+{
+    inline bool operator()(const LNodeOrderingData& lhs, const LNodeOrderingData& rhs) const
+    {
+        return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.lag_idx < rhs.lag_idx);
+    }
+};
+
+struct LagrangianIndexPairComp
+    : std::binary_function<const std::pair<int, LNode*>&, const std::pair<int, LNode*>&, bool>
+{
+    inline bool operator()(const std::pair<int, LNode*>& lhs, const std::pair<int, LNode*>& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+// Determine the number of bits per coordinate direction used to compute
+// space-filling curve keys for cells in the specified box.  When the box is too
+// large for the keys to fit in an unsigned long, the cell indices are coarsened
+// by the returned shift.
+inline void compute_sfc_key_bits(const Box<NDIM>& domain_box, int& num_bits, int& num_shift)
+{
+    const int max_extent = domain_box.numberCells().max();
+    num_bits = 1;
+    while (num_bits < std::numeric_limits<int>::digits && (1 << num_bits) < max_extent) ++num_bits;
+    const int max_bits = std::numeric_limits<unsigned long>::digits / NDIM;
+    num_shift = std::max(num_bits - max_bits, 0);
+    num_bits -= num_shift;
+    return;
+} // compute_sfc_key_bits
+
+// Compute the Morton (Z-order) or Hilbert key of the specified cell index.  The
+// Hilbert key is computed by using Skilling's transpose algorithm (J. Skilling,
+// "Programming the Hilbert curve," AIP Conf. Proc. 707, 2004).
+inline unsigned long compute_sfc_key(const Index<NDIM>& i,
+                                     const Box<NDIM>& domain_box,
+                                     const int num_bits,
+                                     const int num_shift,
+                                     const bool use_hilbert_curve)
+{
+    const unsigned int mask = (num_bits < std::numeric_limits<unsigned int>::digits) ? (1U << num_bits) - 1U : ~0U;
+    unsigned int X[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const int x = std::max(i(d) - domain_box.lower()(d), 0);
+        X[d] = (static_cast<unsigned int>(x) >> num_shift) & mask;
+    }
+    if (use_hilbert_curve)
+    {
+        const unsigned int M = 1U << (num_bits - 1);
+        for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+            const unsigned int P = Q - 1;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (X[d] & Q)
+                {
+                    X[0] ^= P;
+                }
+                else
+                {
+                    const unsigned int t = (X[0] ^ X[d]) & P;
+                    X[0] ^= t;
+                    X[d] ^= t;
+                }
+            }
+        }
+        for (unsigned int d = 1; d < NDIM; ++d) X[d] ^= X[d - 1];
+        unsigned int t = 0;
+        for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+            if (X[NDIM - 1] & Q) t ^= Q - 1;
+        }
+        for (unsigned int d = 0; d < NDIM; ++d) X[d] ^= t;
+    }
+    unsigned long key = 0;
+    for (int bit = num_bits - 1; bit >= 0; --bit)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            key = (key << 1) | ((X[d] >> bit) & 1U);
+        }
+    }
+    return key;
+} // compute_sfc_key
 }
 
+// The data written out by a single asynchronous checkpoint.  The buffers are
+// owned by the job so that the writer thread never accesses data that the
+// application may modify.
+struct LDataManager::AsyncCheckpointJob
+{
+    pthread_t thread;
+    bool thread_started, failed;
+    std::string data_filename;
+    std::vector<double> vals;
+    std::string metadata_filename;
+    std::vector<char> metadata;
+};
+
 const std::string LDataManager::POSN_DATA_NAME = "X";
 const std::string LDataManager::INIT_POSN_DATA_NAME = "X0";
 const std::string LDataManager::VEL_DATA_NAME = "U";
@@ -377,7 +538,8 @@ void LDataManager::spread(const int f_data_idx,
                           const bool X_data_ghost_node_update,
                           const bool ds_data_ghost_node_update,
                           const int coarsest_ln,
-                          const int finest_ln)
+                          const int finest_ln,
+                          const bool f_data_is_zero)
 {
     spread(f_data_idx,
            F_data,
@@ -391,7 +553,8 @@ void LDataManager::spread(const int f_data_idx,
            X_data_ghost_node_update,
            ds_data_ghost_node_update,
            coarsest_ln,
-           finest_ln);
+           finest_ln,
+           f_data_is_zero);
     return;
 } // spread
 
@@ -407,7 +570,8 @@ void LDataManager::spread(const int f_data_idx,
                           const bool X_data_ghost_node_update,
                           const bool ds_data_ghost_node_update,
                           const int coarsest_ln_in,
-                          const int finest_ln_in)
+                          const int finest_ln_in,
+                          const bool f_data_is_zero)
 {
     IBTK_TIMER_START(t_spread);
 
@@ -466,7 +630,8 @@ void LDataManager::spread(const int f_data_idx,
            /*F_data_ghost_node_update*/ false,
            X_data_ghost_node_update,
            coarsest_ln,
-           finest_ln);
+           finest_ln,
+           f_data_is_zero);
     return;
 } // spread
 
@@ -536,7 +701,8 @@ void LDataManager::spread(const int f_data_idx,
                           const bool F_data_ghost_node_update,
                           const bool X_data_ghost_node_update,
                           const int coarsest_ln,
-                          const int finest_ln)
+                          const int finest_ln,
+                          const bool f_data_is_zero)
 {
     spread(f_data_idx,
            F_data,
@@ -548,7 +714,8 @@ void LDataManager::spread(const int f_data_idx,
            F_data_ghost_node_update,
            X_data_ghost_node_update,
            coarsest_ln,
-           finest_ln);
+           finest_ln,
+           f_data_is_zero);
     return;
 } // spread
 
@@ -562,7 +729,8 @@ void LDataManager::spread(const int f_data_idx,
                           const bool F_data_ghost_node_update,
                           const bool X_data_ghost_node_update,
                           const int coarsest_ln_in,
-                          const int finest_ln_in)
+                          const int finest_ln_in,
+                          const bool f_data_is_zero)
 {
     IBTK_TIMER_START(t_spread);
 
@@ -583,17 +751,17 @@ void LDataManager::spread(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
 
-    // Make a copy of the Eulerian data.
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    // Prepare the Eulerian data to accumulate spread values.  Prolonging data
+    // from coarser levels overwrites the existing values on finer levels, and
+    // the physical boundary operator overwrites values on the physical
+    // boundary, and so in those cases any nonzero existing values are stored
+    // in scratch data.
+    bool preserve_data = !f_data_is_zero && f_phys_bdry_op != NULL;
+    for (int ln = coarsest_ln + 1; ln <= finest_ln && !f_data_is_zero; ++ln)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
+        if (ln < static_cast<int>(f_prolongation_scheds.size()) && f_prolongation_scheds[ln]) preserve_data = true;
     }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
-        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
+    d_spread_accumulator.beginAccumulation(f_data_idx, d_hierarchy, coarsest_ln, finest_ln, preserve_data);
 
     // Start filling Lagrangian ghost node values.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -661,14 +829,7 @@ void LDataManager::spread(const int f_data_idx,
     }
 
     // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
-    }
-    var_db->removePatchDataIndex(f_copy_data_idx);
+    d_spread_accumulator.endAccumulation();
 
     IBTK_TIMER_STOP(t_spread);
     return;
@@ -1170,6 +1331,7 @@ void LDataManager::activateLagrangianStructures(const std::vector<int>& structur
         d_inactive_strcts[level_number].removeItem(*cit);
     }
     d_inactive_strcts[level_number].communicateData();
+    ++d_strct_metadata_version;
     return;
 } // activateLagrangianStructures
 
@@ -1183,6 +1345,7 @@ void LDataManager::inactivateLagrangianStructures(const std::vector<int>& struct
         d_inactive_strcts[level_number].addItem(*cit);
     }
     d_inactive_strcts[level_number].communicateData();
+    ++d_strct_metadata_version;
     return;
 } // inactivateLagrangianStructures
 
@@ -2196,6 +2359,7 @@ void LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> >
         {
             d_last_lag_idx_to_strct_id_map[level_number][cit->second.second - 1] = cit->first;
         }
+        ++d_strct_metadata_version;
 
         // WARNING: If either of the following offsets is ever nonzero, note
         // that it may be necessary to modify IBHierarchyIntegrator, in
@@ -2335,6 +2499,9 @@ void LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<
     setPatchHierarchy(hierarchy);
     setPatchLevels(0, finest_hier_level);
 
+    // Scratch data used for spreading are reallocated as needed.
+    d_spread_accumulator.deallocateScratchData();
+
     // Reset the Silo data writer.
     if (d_silo_writer)
     {
@@ -2481,6 +2648,61 @@ void LDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM>
     return;
 } // applyGradientDetector
 
+void LDataManager::setNodeOrdering(const LNodeOrderingType node_ordering)
+{
+    if (node_ordering == UNKNOWN_LNODE_ORDERING_TYPE)
+    {
+        TBOX_ERROR(d_object_name << "::setNodeOrdering():\n"
+                                 << "  unknown node ordering type." << std::endl);
+    }
+    d_node_ordering = node_ordering;
+    return;
+} // setNodeOrdering
+
+LNodeOrderingType LDataManager::getNodeOrdering() const
+{
+    return d_node_ordering;
+} // getNodeOrdering
+
+void LDataManager::setAsynchronousCheckpointing(const bool use_async_checkpointing,
+                                                const std::string& checkpoint_dirname)
+{
+    waitForAsynchronousCheckpoint();
+    d_use_async_checkpointing = use_async_checkpointing;
+    if (!d_use_async_checkpointing) return;
+    d_async_checkpoint_dirname = checkpoint_dirname;
+    while (!d_async_checkpoint_dirname.empty() &&
+           d_async_checkpoint_dirname[d_async_checkpoint_dirname.size() - 1] == '/')
+    {
+        d_async_checkpoint_dirname = std::string(d_async_checkpoint_dirname, 0, d_async_checkpoint_dirname.size() - 1);
+    }
+    if (d_async_checkpoint_dirname.empty())
+    {
+        TBOX_ERROR(d_object_name << "::setAsynchronousCheckpointing():\n"
+                                 << "  asynchronous checkpointing requires a nonempty checkpoint directory name."
+                                 << std::endl);
+    }
+    Utilities::recursiveMkdir(d_async_checkpoint_dirname);
+    SAMRAI_MPI::barrier();
+    return;
+} // setAsynchronousCheckpointing
+
+void LDataManager::waitForAsynchronousCheckpoint()
+{
+    if (!d_async_checkpoint_job) return;
+    if (d_async_checkpoint_job->thread_started) pthread_join(d_async_checkpoint_job->thread, NULL);
+    const bool failed = d_async_checkpoint_job->failed;
+    const std::string data_filename = d_async_checkpoint_job->data_filename;
+    delete d_async_checkpoint_job;
+    d_async_checkpoint_job = NULL;
+    if (failed)
+    {
+        TBOX_ERROR(d_object_name << "::waitForAsynchronousCheckpoint():\n"
+                                 << "  unable to write checkpoint data file " << data_filename << std::endl);
+    }
+    return;
+} // waitForAsynchronousCheckpoint
+
 void LDataManager::putToDatabase(Pointer<Database> db)
 {
     IBTK_TIMER_START(t_put_to_database);
@@ -2494,6 +2716,40 @@ void LDataManager::putToDatabase(Pointer<Database> db)
     db->putInteger("d_finest_ln", d_finest_ln);
     db->putDouble("d_beta_work", d_beta_work);
 
+    // When using asynchronous checkpointing, LData values are copied into a
+    // snapshot buffer and structure metadata are only written out when they
+    // have been modified since the previous checkpoint.
+    AsyncCheckpointJob* job = NULL;
+    if (d_use_async_checkpointing)
+    {
+        waitForAsynchronousCheckpoint();
+        job = new AsyncCheckpointJob();
+        job->thread_started = false;
+        job->failed = false;
+        std::string file_prefix = d_object_name;
+        std::replace(file_prefix.begin(), file_prefix.end(), ':', '_');
+        file_prefix = d_async_checkpoint_dirname + "/" + file_prefix;
+        job->data_filename = file_prefix + ".ldata." + Utilities::intToString(d_async_checkpoint_counter, 6) + "." +
+                             Utilities::processorToString(SAMRAI_MPI::getRank());
+        ++d_async_checkpoint_counter;
+        if (d_strct_metadata_version != d_strct_metadata_checkpoint_version)
+        {
+            d_strct_metadata_checkpoint_filename =
+                file_prefix + ".strct_metadata." + Utilities::intToString(d_strct_metadata_version, 6);
+            d_strct_metadata_checkpoint_version = d_strct_metadata_version;
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                job->metadata_filename = d_strct_metadata_checkpoint_filename;
+                packStructureMetadata(job->metadata);
+            }
+        }
+        db->putBool("d_use_async_checkpointing", true);
+        db->putInteger("d_async_checkpoint_counter", d_async_checkpoint_counter);
+        db->putString("d_async_checkpoint_filename", job->data_filename);
+        db->putInteger("d_strct_metadata_version", d_strct_metadata_checkpoint_version);
+        db->putString("d_strct_metadata_checkpoint_filename", d_strct_metadata_checkpoint_filename);
+    }
+
     // Write out data that is stored on a level-by-level basis.
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
     {
@@ -2506,34 +2762,40 @@ void LDataManager::putToDatabase(Pointer<Database> db)
 
         if (!d_level_contains_lag_data[level_number]) continue;
 
-        std::vector<int> lstruct_ids, lstruct_lag_idx_range_first, lstruct_lag_idx_range_second, lstruct_activation;
-        std::vector<std::string> lstruct_names;
-        for (std::map<int, std::string>::iterator it = d_strct_id_to_strct_name_map[level_number].begin();
-             it != d_strct_id_to_strct_name_map[level_number].end();
-             ++it)
+        if (!job)
         {
-            const int id = it->first;
-            lstruct_ids.push_back(id);
-            lstruct_names.push_back(it->second);
-            lstruct_lag_idx_range_first.push_back(d_strct_id_to_lag_idx_range_map[level_number].find(id)->second.first);
-            lstruct_lag_idx_range_second.push_back(
-                d_strct_id_to_lag_idx_range_map[level_number].find(id)->second.second);
-            lstruct_activation.push_back(static_cast<int>(d_inactive_strcts[level_number].getSet().find(id) !=
-                                                          d_inactive_strcts[level_number].getSet().end()));
-        }
-        level_db->putInteger("n_lstructs", static_cast<int>(lstruct_ids.size()));
-        if (!lstruct_ids.empty())
-        {
-            level_db->putIntegerArray("lstruct_ids", &lstruct_ids[0], static_cast<int>(lstruct_ids.size()));
-            level_db->putIntegerArray("lstruct_lag_idx_range_first",
-                                      &lstruct_lag_idx_range_first[0],
-                                      static_cast<int>(lstruct_lag_idx_range_first.size()));
-            level_db->putIntegerArray("lstruct_lag_idx_range_second",
-                                      &lstruct_lag_idx_range_second[0],
-                                      static_cast<int>(lstruct_lag_idx_range_second.size()));
-            level_db->putIntegerArray(
-                "lstruct_activation", &lstruct_activation[0], static_cast<int>(lstruct_activation.size()));
-            level_db->putStringArray("lstruct_names", &lstruct_names[0], static_cast<int>(lstruct_names.size()));
+            std::vector<int> lstruct_ids, lstruct_lag_idx_range_first, lstruct_lag_idx_range_second,
+                lstruct_activation;
+            std::vector<std::string> lstruct_names;
+            for (std::map<int, std::string>::iterator it = d_strct_id_to_strct_name_map[level_number].begin();
+                 it != d_strct_id_to_strct_name_map[level_number].end();
+                 ++it)
+            {
+                const int id = it->first;
+                lstruct_ids.push_back(id);
+                lstruct_names.push_back(it->second);
+                lstruct_lag_idx_range_first.push_back(
+                    d_strct_id_to_lag_idx_range_map[level_number].find(id)->second.first);
+                lstruct_lag_idx_range_second.push_back(
+                    d_strct_id_to_lag_idx_range_map[level_number].find(id)->second.second);
+                lstruct_activation.push_back(static_cast<int>(d_inactive_strcts[level_number].getSet().find(id) !=
+                                                              d_inactive_strcts[level_number].getSet().end()));
+            }
+            level_db->putInteger("n_lstructs", static_cast<int>(lstruct_ids.size()));
+            if (!lstruct_ids.empty())
+            {
+                level_db->putIntegerArray("lstruct_ids", &lstruct_ids[0], static_cast<int>(lstruct_ids.size()));
+                level_db->putIntegerArray("lstruct_lag_idx_range_first",
+                                          &lstruct_lag_idx_range_first[0],
+                                          static_cast<int>(lstruct_lag_idx_range_first.size()));
+                level_db->putIntegerArray("lstruct_lag_idx_range_second",
+                                          &lstruct_lag_idx_range_second[0],
+                                          static_cast<int>(lstruct_lag_idx_range_second.size()));
+                level_db->putIntegerArray(
+                    "lstruct_activation", &lstruct_activation[0], static_cast<int>(lstruct_activation.size()));
+                level_db->putStringArray(
+                    "lstruct_names", &lstruct_names[0], static_cast<int>(lstruct_names.size()));
+            }
         }
 
         std::vector<std::string> ldata_names;
@@ -2542,7 +2804,14 @@ void LDataManager::putToDatabase(Pointer<Database> db)
              ++it)
         {
             ldata_names.push_back(it->first);
-            it->second->putToDatabase(level_db->putDatabase(ldata_names.back()));
+            if (job)
+            {
+                it->second->putToDatabase(level_db->putDatabase(ldata_names.back()), job->vals);
+            }
+            else
+            {
+                it->second->putToDatabase(level_db->putDatabase(ldata_names.back()));
+            }
         }
         level_db->putInteger("n_ldata_names", static_cast<int>(ldata_names.size()));
         if (!ldata_names.empty())
@@ -2587,6 +2856,20 @@ void LDataManager::putToDatabase(Pointer<Database> db)
         }
     }
 
+    // Stream the snapshot to disk in the background.  If the writer thread
+    // cannot be started, the data are written out synchronously.
+    if (job)
+    {
+        db->putInteger("d_async_checkpoint_num_vals", static_cast<int>(job->vals.size()));
+        d_async_checkpoint_job = job;
+        job->thread_started = pthread_create(&job->thread, NULL, &LDataManager::writeAsynchronousCheckpoint, job) == 0;
+        if (!job->thread_started)
+        {
+            writeAsynchronousCheckpoint(job);
+            waitForAsynchronousCheckpoint();
+        }
+    }
+
     IBTK_TIMER_STOP(t_put_to_database);
     return;
 } // putToDatabase
@@ -2599,16 +2882,19 @@ LDataManager::LDataManager(const std::string& object_name,
                            const IntVector<NDIM>& ghost_width,
                            bool register_for_restart)
     : d_object_name(object_name), d_registered_for_restart(register_for_restart), d_hierarchy(NULL), d_grid_geom(NULL),
-      d_coarsest_ln(-1), d_finest_ln(-1), d_visit_writer(NULL), d_silo_writer(NULL), d_load_balancer(NULL),
-      d_lag_init(NULL), d_level_contains_lag_data(), d_lag_node_index_var(NULL), d_lag_node_index_current_idx(-1),
-      d_lag_node_index_scratch_idx(-1), d_beta_work(1.0), d_workload_var(NULL), d_workload_idx(-1),
-      d_output_workload(false), d_node_count_var(NULL), d_node_count_idx(-1), d_output_node_count(false),
-      d_default_interp_kernel_fcn(default_interp_kernel_fcn), d_default_spread_kernel_fcn(default_spread_kernel_fcn),
-      d_ghost_width(ghost_width), d_lag_node_index_bdry_fill_alg(NULL), d_lag_node_index_bdry_fill_scheds(),
-      d_node_count_coarsen_alg(NULL), d_node_count_coarsen_scheds(), d_current_context(NULL), d_scratch_context(NULL),
-      d_current_data(), d_scratch_data(), d_lag_mesh(), d_lag_mesh_data(), d_needs_synch(true), d_ao(), d_num_nodes(),
-      d_node_offset(), d_local_lag_indices(), d_nonlocal_lag_indices(), d_local_petsc_indices(),
-      d_nonlocal_petsc_indices()
+      d_coarsest_ln(-1), d_finest_ln(-1), d_spread_accumulator(), d_visit_writer(NULL), d_silo_writer(NULL),
+      d_load_balancer(NULL), d_lag_init(NULL), d_level_contains_lag_data(), d_lag_node_index_var(NULL),
+      d_lag_node_index_current_idx(-1), d_lag_node_index_scratch_idx(-1), d_beta_work(1.0), d_workload_var(NULL),
+      d_workload_idx(-1), d_output_workload(false), d_node_count_var(NULL), d_node_count_idx(-1),
+      d_output_node_count(false), d_default_interp_kernel_fcn(default_interp_kernel_fcn),
+      d_default_spread_kernel_fcn(default_spread_kernel_fcn), d_ghost_width(ghost_width),
+      d_lag_node_index_bdry_fill_alg(NULL), d_lag_node_index_bdry_fill_scheds(), d_node_count_coarsen_alg(NULL),
+      d_node_count_coarsen_scheds(), d_current_context(NULL), d_scratch_context(NULL), d_current_data(),
+      d_scratch_data(), d_lag_mesh(), d_lag_mesh_data(), d_needs_synch(true), d_ao(), d_node_ordering(PATCH_ORDERING),
+      d_use_async_checkpointing(false), d_async_checkpoint_dirname(), d_async_checkpoint_counter(0),
+      d_async_checkpoint_job(NULL), d_strct_metadata_version(0), d_strct_metadata_checkpoint_version(-1),
+      d_strct_metadata_checkpoint_filename(), d_num_nodes(), d_node_offset(), d_local_lag_indices(),
+      d_nonlocal_lag_indices(), d_local_petsc_indices(), d_nonlocal_petsc_indices()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -2700,6 +2986,9 @@ LDataManager::LDataManager(const std::string& object_name,
 
 LDataManager::~LDataManager()
 {
+    // Ensure that any outstanding checkpoint data are written out.
+    waitForAsynchronousCheckpoint();
+
     // Destroy any remaining AO objects.
     int ierr;
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
@@ -2871,10 +3160,16 @@ void LDataManager::computeNodeDistribution(AO& ao,
     // Non-local nodes ONLY appear in ghost cells for on processor patches.
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
 
-    // Collect the local nodes and assign local indices to the local nodes.
-    unsigned int local_offset = 0;
-    std::map<int, int> lag_idx_to_petsc_idx;
-#if 1
+    // Collect the local nodes.  When a space-filling-curve or Lagrangian index
+    // ordering is requested, the local nodes are sorted before local PETSc
+    // indices are assigned, so that nodes that are close to each other are
+    // also stored close to each other in the local portions of the PETSc Vec
+    // objects.
+    std::vector<LNodeOrderingData> local_nodes;
+    const bool use_sfc_ordering = d_node_ordering == MORTON_ORDERING || d_node_ordering == HILBERT_ORDERING;
+    const Box<NDIM> domain_box = BoxList<NDIM>(level->getPhysicalDomain()).getBoundingBox();
+    int num_key_bits = 0, num_key_shift = 0;
+    if (use_sfc_ordering) compute_sfc_key_bits(domain_box, num_key_bits, num_key_shift);
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -2882,39 +3177,44 @@ void LDataManager::computeNodeDistribution(AO& ao,
         const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
         for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
         {
-            LNode* const node_idx = *it;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            local_lag_indices.push_back(lag_idx);
-            const int petsc_idx = local_offset++;
-            node_idx->setLocalPETScIndex(petsc_idx);
-            lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+            LNodeOrderingData node_data;
+            node_data.node = *it;
+            node_data.lag_idx = node_data.node->getLagrangianIndex();
+            node_data.key = use_sfc_ordering ? compute_sfc_key(it.getCellIndex(),
+                                                               domain_box,
+                                                               num_key_bits,
+                                                               num_key_shift,
+                                                               d_node_ordering == HILBERT_ORDERING) :
+                                               0;
+            local_nodes.push_back(node_data);
         }
     }
-#else
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    if (d_node_ordering != PATCH_ORDERING)
     {
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        for (Box<NDIM>::Iterator b(patch_box); b; b++)
-        {
-            const Index<NDIM>& i = b();
-            if (!idx_data->isElement(i)) continue;
-            const LNodeSet* const node_set = idx_data->getItem(i);
-            for (LNodeSet::const_iterator node_it = node_set->begin(); node_it != node_set->end(); ++node_it)
-            {
-                LNode* const node_idx = *node_it;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                local_lag_indices.push_back(lag_idx);
-                const int petsc_idx = local_offset++;
-                node_idx->setLocalPETScIndex(petsc_idx);
-                lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
-            }
-        }
+        std::sort(local_nodes.begin(), local_nodes.end(), LNodeOrderingDataComp());
     }
-#endif
+
+    // Assign local indices to the local nodes, and build a sorted table of
+    // (Lagrangian index, local PETSc index) pairs for the local nodes.
+    unsigned int local_offset = 0;
+    std::vector<std::pair<int, int> > lag_idx_to_petsc_idx;
+    lag_idx_to_petsc_idx.reserve(local_nodes.size());
+    local_lag_indices.reserve(local_nodes.size());
+    for (std::vector<LNodeOrderingData>::const_iterator it = local_nodes.begin(); it != local_nodes.end(); ++it)
+    {
+        const int petsc_idx = local_offset++;
+        it->node->setLocalPETScIndex(petsc_idx);
+        local_lag_indices.push_back(it->lag_idx);
+        lag_idx_to_petsc_idx.push_back(std::make_pair(it->lag_idx, petsc_idx));
+    }
+    std::sort(lag_idx_to_petsc_idx.begin(), lag_idx_to_petsc_idx.end());
 
     // Determine the Lagrangian indices of the nonlocal nodes.
+    //
+    // NOTE: A nonlocal node may appear in the ghost cell regions of several
+    // local patches.  The nonlocal nodes are assigned local PETSc indices in
+    // order of increasing Lagrangian index.
+    std::vector<std::pair<int, LNode*> > ghost_nodes;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -2928,23 +3228,30 @@ void LDataManager::computeNodeDistribution(AO& ao,
             {
                 LNode* const node_idx = *it;
                 const int lag_idx = node_idx->getLagrangianIndex();
-                std::map<int, int>::const_iterator idx_it = lag_idx_to_petsc_idx.find(lag_idx);
-                if (idx_it == lag_idx_to_petsc_idx.end())
+                std::vector<std::pair<int, int> >::const_iterator idx_it = std::lower_bound(
+                    lag_idx_to_petsc_idx.begin(), lag_idx_to_petsc_idx.end(), std::make_pair(lag_idx, -1));
+                if (idx_it != lag_idx_to_petsc_idx.end() && idx_it->first == lag_idx)
                 {
-                    // This is the first time we have encountered this index; it
-                    // must be a nonlocal index.
-                    nonlocal_lag_indices.push_back(lag_idx);
-                    const int petsc_idx = local_offset++;
-                    node_idx->setLocalPETScIndex(petsc_idx);
-                    lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+                    node_idx->setLocalPETScIndex(idx_it->second);
                 }
                 else
                 {
-                    node_idx->setLocalPETScIndex(idx_it->second);
+                    ghost_nodes.push_back(std::make_pair(lag_idx, node_idx));
                 }
             }
         }
     }
+    std::sort(ghost_nodes.begin(), ghost_nodes.end(), LagrangianIndexPairComp());
+    for (std::vector<std::pair<int, LNode*> >::const_iterator it = ghost_nodes.begin(); it != ghost_nodes.end(); ++it)
+    {
+        const int lag_idx = it->first;
+        if (nonlocal_lag_indices.empty() || nonlocal_lag_indices.back() != lag_idx)
+        {
+            nonlocal_lag_indices.push_back(lag_idx);
+            ++local_offset;
+        }
+        it->second->setLocalPETScIndex(local_offset - 1);
+    }
 
     // Compute the new PETSc global ordering and initialize the AO object.
     int ierr;
@@ -3046,6 +3353,87 @@ LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_off
     return;
 } // computeNodeOffsets
 
+void LDataManager::packStructureMetadata(std::vector<char>& buffer) const
+{
+    buffer.clear();
+    for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        const int n_lstructs = static_cast<int>(d_strct_id_to_strct_name_map[level_number].size());
+        pack_vals(buffer, &level_number, 1);
+        pack_vals(buffer, &n_lstructs, 1);
+        for (std::map<int, std::string>::const_iterator cit = d_strct_id_to_strct_name_map[level_number].begin();
+             cit != d_strct_id_to_strct_name_map[level_number].end();
+             ++cit)
+        {
+            const int id = cit->first;
+            const std::pair<int, int>& lag_idx_range = d_strct_id_to_lag_idx_range_map[level_number].find(id)->second;
+            const int inactive = static_cast<int>(d_inactive_strcts[level_number].getSet().count(id));
+            const int name_length = static_cast<int>(cit->second.size());
+            pack_vals(buffer, &id, 1);
+            pack_vals(buffer, &lag_idx_range.first, 1);
+            pack_vals(buffer, &lag_idx_range.second, 1);
+            pack_vals(buffer, &inactive, 1);
+            pack_vals(buffer, &name_length, 1);
+            pack_vals(buffer, cit->second.data(), name_length);
+        }
+    }
+    return;
+} // packStructureMetadata
+
+void LDataManager::readStructureMetadata(const std::string& filename)
+{
+    std::vector<char> buffer;
+    if (!read_checkpoint_file(filename, buffer))
+    {
+        TBOX_ERROR(d_object_name << "::readStructureMetadata():\n"
+                                 << "  unable to read structure metadata file " << filename << std::endl);
+    }
+    size_t pos = 0;
+    while (pos < buffer.size())
+    {
+        const int level_number = unpack_val<int>(buffer, pos);
+        const int n_lstructs = unpack_val<int>(buffer, pos);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+        for (int k = 0; k < n_lstructs; ++k)
+        {
+            const int id = unpack_val<int>(buffer, pos);
+            const int lag_idx_range_first = unpack_val<int>(buffer, pos);
+            const int lag_idx_range_second = unpack_val<int>(buffer, pos);
+            const int inactive = unpack_val<int>(buffer, pos);
+            const size_t name_length = static_cast<size_t>(unpack_val<int>(buffer, pos));
+            if (pos + name_length > buffer.size())
+            {
+                TBOX_ERROR(d_object_name << "::readStructureMetadata():\n"
+                                         << "  corrupt structure metadata file " << filename << std::endl);
+            }
+            d_strct_id_to_strct_name_map[level_number][id] =
+                name_length > 0 ? std::string(&buffer[pos], name_length) : std::string();
+            pos += name_length;
+            d_strct_id_to_lag_idx_range_map[level_number][id] =
+                std::make_pair(lag_idx_range_first, lag_idx_range_second);
+            if (inactive == 1)
+            {
+                d_inactive_strcts[level_number].addItem(id);
+            }
+        }
+    }
+    return;
+} // readStructureMetadata
+
+void* LDataManager::writeAsynchronousCheckpoint(void* job_ptr)
+{
+    AsyncCheckpointJob* const job = static_cast<AsyncCheckpointJob*>(job_ptr);
+    job->failed = !write_checkpoint_file(job->data_filename, job->vals);
+    if (!job->metadata_filename.empty())
+    {
+        job->failed = !write_checkpoint_file(job->metadata_filename, job->metadata) || job->failed;
+    }
+    return NULL;
+} // writeAsynchronousCheckpoint
+
 void LDataManager::getFromRestart()
 {
     Pointer<Database> restart_db = RestartManager::getManager()->getRootDatabase();
@@ -3071,6 +3459,25 @@ void LDataManager::getFromRestart()
     d_finest_ln = db->getInteger("d_finest_ln");
     d_beta_work = db->getDouble("d_beta_work");
 
+    // Read in the snapshot buffer if the data were written asynchronously.
+    const bool from_async_checkpoint =
+        db->keyExists("d_use_async_checkpointing") && db->getBool("d_use_async_checkpointing");
+    std::vector<double> vals_snapshot;
+    if (from_async_checkpoint)
+    {
+        d_async_checkpoint_counter = db->getInteger("d_async_checkpoint_counter");
+        d_strct_metadata_version = db->getInteger("d_strct_metadata_version");
+        d_strct_metadata_checkpoint_version = d_strct_metadata_version;
+        d_strct_metadata_checkpoint_filename = db->getString("d_strct_metadata_checkpoint_filename");
+        const std::string data_filename = db->getString("d_async_checkpoint_filename");
+        if (!read_checkpoint_file(data_filename, vals_snapshot) ||
+            static_cast<int>(vals_snapshot.size()) != db->getInteger("d_async_checkpoint_num_vals"))
+        {
+            TBOX_ERROR(d_object_name << ":  "
+                                     << "Unable to read checkpoint data file " << data_filename << std::endl);
+        }
+    }
+
     // Resize some arrays.
     d_level_contains_lag_data.resize(d_finest_ln + 1, false);
     d_strct_name_to_strct_id_map.resize(d_finest_ln + 1);
@@ -3093,6 +3500,11 @@ void LDataManager::getFromRestart()
     d_local_petsc_indices.resize(d_finest_ln + 1);
     d_nonlocal_petsc_indices.resize(d_finest_ln + 1);
 
+    if (from_async_checkpoint)
+    {
+        readStructureMetadata(d_strct_metadata_checkpoint_filename);
+    }
+
     // Read in data that is stored on a level-by-level basis.
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
     {
@@ -3105,31 +3517,34 @@ void LDataManager::getFromRestart()
 
         if (!d_level_contains_lag_data[level_number]) continue;
 
-        const int n_lstructs = level_db->getInteger("n_lstructs");
-        std::vector<int> lstruct_ids(n_lstructs), lstruct_lag_idx_range_first(n_lstructs),
-            lstruct_lag_idx_range_second(n_lstructs), lstruct_activation(n_lstructs);
-        std::vector<std::string> lstruct_names(n_lstructs);
-        if (n_lstructs > 0)
-        {
-            level_db->getIntegerArray("lstruct_ids", &lstruct_ids[0], static_cast<int>(lstruct_ids.size()));
-            level_db->getIntegerArray("lstruct_lag_idx_range_first",
-                                      &lstruct_lag_idx_range_first[0],
-                                      static_cast<int>(lstruct_lag_idx_range_first.size()));
-            level_db->getIntegerArray("lstruct_lag_idx_range_second",
-                                      &lstruct_lag_idx_range_second[0],
-                                      static_cast<int>(lstruct_lag_idx_range_second.size()));
-            level_db->getIntegerArray(
-                "lstruct_activation", &lstruct_activation[0], static_cast<int>(lstruct_activation.size()));
-            level_db->getStringArray("lstruct_names", &lstruct_names[0], static_cast<int>(lstruct_names.size()));
-        }
-        for (int k = 0; k < n_lstructs; ++k)
+        if (!from_async_checkpoint)
         {
-            d_strct_id_to_strct_name_map[level_number][lstruct_ids[k]] = lstruct_names[k];
-            d_strct_id_to_lag_idx_range_map[level_number][lstruct_ids[k]] =
-                std::make_pair(lstruct_lag_idx_range_first[k], lstruct_lag_idx_range_second[k]);
-            if (lstruct_activation[k] == 1)
+            const int n_lstructs = level_db->getInteger("n_lstructs");
+            std::vector<int> lstruct_ids(n_lstructs), lstruct_lag_idx_range_first(n_lstructs),
+                lstruct_lag_idx_range_second(n_lstructs), lstruct_activation(n_lstructs);
+            std::vector<std::string> lstruct_names(n_lstructs);
+            if (n_lstructs > 0)
+            {
+                level_db->getIntegerArray("lstruct_ids", &lstruct_ids[0], static_cast<int>(lstruct_ids.size()));
+                level_db->getIntegerArray("lstruct_lag_idx_range_first",
+                                          &lstruct_lag_idx_range_first[0],
+                                          static_cast<int>(lstruct_lag_idx_range_first.size()));
+                level_db->getIntegerArray("lstruct_lag_idx_range_second",
+                                          &lstruct_lag_idx_range_second[0],
+                                          static_cast<int>(lstruct_lag_idx_range_second.size()));
+                level_db->getIntegerArray(
+                    "lstruct_activation", &lstruct_activation[0], static_cast<int>(lstruct_activation.size()));
+                level_db->getStringArray("lstruct_names", &lstruct_names[0], static_cast<int>(lstruct_names.size()));
+            }
+            for (int k = 0; k < n_lstructs; ++k)
             {
-                d_inactive_strcts[level_number].addItem(k);
+                d_strct_id_to_strct_name_map[level_number][lstruct_ids[k]] = lstruct_names[k];
+                d_strct_id_to_lag_idx_range_map[level_number][lstruct_ids[k]] =
+                    std::make_pair(lstruct_lag_idx_range_first[k], lstruct_lag_idx_range_second[k]);
+                if (lstruct_activation[k] == 1)
+                {
+                    d_inactive_strcts[level_number].addItem(k);
+                }
             }
         }
         d_inactive_strcts[level_number].communicateData();
@@ -3160,7 +3575,7 @@ void LDataManager::getFromRestart()
         for (std::vector<std::string>::iterator it = ldata_names.begin(); it != ldata_names.end(); ++it)
         {
             const std::string& ldata_name = *it;
-            d_lag_mesh_data[level_number][ldata_name] = new LData(level_db->getDatabase(ldata_name));
+            d_lag_mesh_data[level_number][ldata_name] = new LData(level_db->getDatabase(ldata_name), &vals_snapshot);
             data_depths.insert(d_lag_mesh_data[level_number][ldata_name]->getDepth());
         }
 
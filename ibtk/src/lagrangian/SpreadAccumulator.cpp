@@ -0,0 +1,237 @@
+// Filename: SpreadAccumulator.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <utility>
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "BoxList.h"
+#include "CellData.h"
+#include "EdgeData.h"
+#include "EdgeGeometry.h"
+#include "HierarchyDataOpsManager.h"
+#include "HierarchyDataOpsReal.h"
+#include "NodeData.h"
+#include "NodeGeometry.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
+#include "ibtk/SpreadAccumulator.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+inline void zero_ghost_values(ArrayData<NDIM, double>& data, const Box<NDIM>& interior_box)
+{
+    BoxList<NDIM> ghost_boxes(data.getBox());
+    ghost_boxes.removeIntersections(interior_box);
+    for (BoxList<NDIM>::Iterator b(ghost_boxes); b; b++)
+    {
+        data.fillAll(0.0, b());
+    }
+    return;
+} // zero_ghost_values
+
+void zero_ghost_values(Pointer<PatchData<NDIM> > data)
+{
+    const Box<NDIM>& patch_box = data->getBox();
+    Pointer<CellData<NDIM, double> > cc_data = data;
+    Pointer<EdgeData<NDIM, double> > ec_data = data;
+    Pointer<NodeData<NDIM, double> > nc_data = data;
+    Pointer<SideData<NDIM, double> > sc_data = data;
+    if (cc_data)
+    {
+        zero_ghost_values(cc_data->getArrayData(), patch_box);
+    }
+    else if (ec_data)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            zero_ghost_values(ec_data->getArrayData(axis), EdgeGeometry<NDIM>::toEdgeBox(patch_box, axis));
+        }
+    }
+    else if (nc_data)
+    {
+        zero_ghost_values(nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(patch_box));
+    }
+    else if (sc_data)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            if (!sc_data->getDirectionVector()(axis)) continue;
+            zero_ghost_values(sc_data->getArrayData(axis), SideGeometry<NDIM>::toSideBox(patch_box, axis));
+        }
+    }
+    else
+    {
+        TBOX_ERROR("SpreadAccumulator::beginAccumulation():\n"
+                   << "  unsupported data centering.\n");
+    }
+    return;
+} // zero_ghost_values
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SpreadAccumulator::SpreadAccumulator()
+    : d_hierarchy(NULL), d_scratch_idxs(), d_f_data_idx(-1), d_scratch_idx(-1), d_f_data_ops(NULL)
+{
+    // intentionally blank
+    return;
+} // SpreadAccumulator
+
+SpreadAccumulator::~SpreadAccumulator()
+{
+    deallocateScratchData();
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (std::map<int, int>::const_iterator it = d_scratch_idxs.begin(); it != d_scratch_idxs.end(); ++it)
+    {
+        var_db->removePatchDataIndex(it->second);
+    }
+    return;
+} // ~SpreadAccumulator
+
+void SpreadAccumulator::beginAccumulation(const int f_data_idx,
+                                          Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                          const int coarsest_ln,
+                                          const int finest_ln,
+                                          const bool preserve_data)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_f_data_idx == -1);
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(0 <= coarsest_ln && coarsest_ln <= finest_ln);
+#endif
+    if (d_hierarchy && d_hierarchy != hierarchy) deallocateScratchData();
+    d_hierarchy = hierarchy;
+    d_f_data_idx = f_data_idx;
+    d_scratch_idx = -1;
+
+    // When the existing values do not need to be preserved, spread values are
+    // accumulated directly into the patch data, and only the ghost cell values
+    // need to be reset.
+    if (!preserve_data)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                zero_ghost_values(patch->getPatchData(f_data_idx));
+            }
+        }
+        return;
+    }
+
+    // Otherwise, move the existing values into the scratch data.  Scratch data
+    // are allocated only on patch levels on which they are not already
+    // allocated.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > f_var;
+    var_db->mapIndexToVariable(f_data_idx, f_var);
+    std::map<int, int>::const_iterator it = d_scratch_idxs.find(f_data_idx);
+    if (it != d_scratch_idxs.end())
+    {
+        d_scratch_idx = it->second;
+    }
+    else
+    {
+        d_scratch_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
+        d_scratch_idxs.insert(std::make_pair(f_data_idx, d_scratch_idx));
+    }
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_scratch_idx)) level->allocatePatchData(d_scratch_idx);
+    }
+    d_f_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
+    d_f_data_ops->resetLevels(coarsest_ln, finest_ln);
+    d_f_data_ops->swapData(d_scratch_idx, f_data_idx);
+    d_f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
+    return;
+} // beginAccumulation
+
+void SpreadAccumulator::endAccumulation()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_f_data_idx != -1);
+#endif
+    if (d_scratch_idx != -1)
+    {
+        d_f_data_ops->swapData(d_scratch_idx, d_f_data_idx);
+        d_f_data_ops->add(d_f_data_idx, d_f_data_idx, d_scratch_idx);
+        d_f_data_ops.setNull();
+    }
+    d_f_data_idx = -1;
+    d_scratch_idx = -1;
+    return;
+} // endAccumulation
+
+void SpreadAccumulator::deallocateScratchData()
+{
+    if (!d_hierarchy) return;
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (std::map<int, int>::const_iterator it = d_scratch_idxs.begin(); it != d_scratch_idxs.end(); ++it)
+        {
+            if (level->checkAllocated(it->second)) level->deallocatePatchData(it->second);
+        }
+    }
+    return;
+} // deallocateScratchData
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
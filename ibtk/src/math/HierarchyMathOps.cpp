@@ -46,6 +46,7 @@
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellDataFactory.h"
 #include "CellVariable.h"
 #include "CoarseFineBoundary.h"
 #include "CoarsenAlgorithm.h"
@@ -91,6 +92,7 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/PatchMathOps.h"
+#include "ibtk/PatchTaskList.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
 #include "tbox/MathUtilities.h"
@@ -601,9 +603,11 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -631,9 +635,11 @@ void HierarchyMathOps::curl(const int dst_idx,
             {
                 Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                const PatchTaskList patches(level);
+                IBTK_PATCH_TASK_LOOP(patches)
+                for (int p = 0; p < patches.size(); ++p)
                 {
-                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    const Pointer<Patch<NDIM> >& patch = patches[p];
 
                     Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                     Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(d_sc_idx);
@@ -739,9 +745,11 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -766,9 +774,11 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -793,9 +803,11 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -820,9 +832,11 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -855,9 +869,11 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -890,9 +906,11 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -926,9 +944,11 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -962,9 +982,11 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -998,9 +1020,11 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<EdgeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1034,9 +1058,11 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1068,9 +1094,11 @@ void HierarchyMathOps::div(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete divergence.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1133,9 +1161,11 @@ void HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1190,9 +1220,11 @@ void HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1239,9 +1271,11 @@ void HierarchyMathOps::grad(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete gradient.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1333,9 +1367,11 @@ void HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1391,9 +1427,11 @@ void HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1584,9 +1622,11 @@ void HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1680,9 +1720,11 @@ void HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1769,9 +1811,11 @@ void HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1816,9 +1860,11 @@ void HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1863,9 +1909,11 @@ void HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1913,9 +1961,11 @@ void HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2003,9 +2053,11 @@ void HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete Laplacian.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2165,9 +2217,11 @@ void HierarchyMathOps::laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2191,9 +2245,11 @@ void HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
@@ -2213,6 +2269,115 @@ void HierarchyMathOps::laplace(const int dst_idx,
     return;
 } // laplace
 
+void HierarchyMathOps::stokes(const int dst_u_idx,
+                              const Pointer<SideVariable<NDIM, double> > dst_u_var,
+                              const int dst_p_idx,
+                              const Pointer<CellVariable<NDIM, double> > dst_p_var,
+                              const PoissonSpecifications& poisson_spec,
+                              const int src_u_idx,
+                              const Pointer<SideVariable<NDIM, double> > src_u_var,
+                              const int src_p_idx,
+                              const Pointer<CellVariable<NDIM, double> > src_p_var,
+                              const Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+                              const double src_ghost_fill_time,
+                              const double gamma,
+                              const double delta)
+{
+    if (!poisson_spec.dIsConstant())
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  MAC Stokes operator requires spatially constant scalar-valued "
+                      "diffusivity" << std::endl);
+    }
+
+    if (!(poisson_spec.cIsConstant() || poisson_spec.cIsZero()))
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  MAC Stokes operator requires spatially constant scalar-valued "
+                      "damping factor" << std::endl);
+    }
+
+    Pointer<SideDataFactory<NDIM, double> > dst_u_factory = dst_u_var->getPatchDataFactory();
+    Pointer<SideDataFactory<NDIM, double> > src_u_factory = src_u_var->getPatchDataFactory();
+    Pointer<CellDataFactory<NDIM, double> > dst_p_factory = dst_p_var->getPatchDataFactory();
+    Pointer<CellDataFactory<NDIM, double> > src_p_factory = src_p_var->getPatchDataFactory();
+    if (dst_u_factory->getDefaultDepth() != 1 || src_u_factory->getDefaultDepth() != 1 ||
+        dst_p_factory->getDefaultDepth() != 1 || src_p_factory->getDefaultDepth() != 1)
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  MAC Stokes operator requires scalar-valued data" << std::endl);
+    }
+
+    const double alpha = poisson_spec.getDConstant();
+    const double beta = poisson_spec.cIsZero() ? 0.0 : poisson_spec.getCConstant();
+
+    // Synchronize the coarse-fine interface values of src_u, starting from the
+    // finest level of the hierarchy, so that the discrete divergence is
+    // conservative and so that ghost cell values are computed from the
+    // synchronized data.
+    for (int ln = d_finest_ln; ln > d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_os_idx);
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
+        {
+            const Pointer<Patch<NDIM> >& patch = patches[p];
+            Pointer<SideData<NDIM, double> > src_u_data = patch->getPatchData(src_u_idx);
+            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+            os_data->copy(*src_u_data);
+        }
+        xeqScheduleOutersideRestriction(src_u_idx, d_os_idx, ln - 1);
+        level->deallocatePatchData(d_os_idx);
+    }
+
+    // Fill ghost cell values using the synchronized data.
+    if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
+
+    // Compute the operator level-by-level, starting from the finest level of
+    // the hierarchy.  The values of dst_u along the coarse-fine interface are
+    // synchronized once the operator has been evaluated on the coarse level.
+    for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
+        {
+            const Pointer<Patch<NDIM> >& patch = patches[p];
+            Pointer<SideData<NDIM, double> > dst_u_data = patch->getPatchData(dst_u_idx);
+            Pointer<CellData<NDIM, double> > dst_p_data = patch->getPatchData(dst_p_idx);
+            Pointer<SideData<NDIM, double> > src_u_data = patch->getPatchData(src_u_idx);
+            Pointer<CellData<NDIM, double> > src_p_data = patch->getPatchData(src_p_idx);
+            d_patch_math_ops.stokes(
+                dst_u_data, dst_p_data, alpha, beta, src_u_data, gamma, src_p_data, delta, patch);
+        }
+
+        // Synchronize the coarse-fine interface of dst_u on this level.
+        if (ln < d_finest_ln)
+        {
+            xeqScheduleOutersideRestriction(dst_u_idx, d_os_idx, ln);
+            d_hierarchy->getPatchLevel(ln + 1)->deallocatePatchData(d_os_idx);
+        }
+
+        // Extract the values of dst_u on the coarse-fine interface.
+        if (ln > d_coarsest_ln)
+        {
+            level->allocatePatchData(d_os_idx);
+            IBTK_PATCH_TASK_LOOP(patches)
+            for (int p = 0; p < patches.size(); ++p)
+            {
+                const Pointer<Patch<NDIM> >& patch = patches[p];
+                Pointer<SideData<NDIM, double> > dst_u_data = patch->getPatchData(dst_u_idx);
+                Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+                os_data->copy(*dst_u_data);
+            }
+        }
+    }
+    return;
+} // stokes
+
 void HierarchyMathOps::vc_laplace(const int dst_idx,
                                   const Pointer<SideVariable<NDIM, double> > dst_var,
                                   const double alpha,
@@ -2251,9 +2416,11 @@ void HierarchyMathOps::vc_laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > coef_data = patch->getPatchData(coef_idx);
@@ -2278,9 +2445,11 @@ void HierarchyMathOps::vc_laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
@@ -2316,9 +2485,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2350,9 +2521,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2387,9 +2560,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2421,9 +2596,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2455,9 +2632,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2492,9 +2671,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2526,9 +2707,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2560,9 +2743,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2597,9 +2782,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2631,9 +2818,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2665,9 +2854,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2702,9 +2893,11 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2729,9 +2922,11 @@ void HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2751,9 +2946,11 @@ void HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2773,9 +2970,11 @@ void HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2795,9 +2994,11 @@ void HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2817,9 +3018,11 @@ void HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2839,9 +3042,11 @@ void HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const PatchTaskList patches(level);
+        IBTK_PATCH_TASK_LOOP(patches)
+        for (int p = 0; p < patches.size(); ++p)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[p];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
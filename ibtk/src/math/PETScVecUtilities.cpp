@@ -248,6 +248,32 @@ void PETScVecUtilities::constructPatchLevelDOFIndices(std::vector<int>& num_dofs
     return;
 } // constructPatchLevelDOFIndices
 
+void PETScVecUtilities::constructPatchLevelSchwarzSubdomains(std::vector<std::vector<int> >& subdomain_dofs,
+                                                             const std::vector<int>& num_dofs_per_proc,
+                                                             const int dof_index_idx,
+                                                             Pointer<PatchLevel<NDIM> > patch_level)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > dof_index_var;
+    var_db->mapIndexToVariable(dof_index_idx, dof_index_var);
+    Pointer<CellVariable<NDIM, int> > dof_index_cc_var = dof_index_var;
+    Pointer<SideVariable<NDIM, int> > dof_index_sc_var = dof_index_var;
+    if (dof_index_cc_var)
+    {
+        constructPatchLevelSchwarzSubdomains_cell(subdomain_dofs, num_dofs_per_proc, dof_index_idx, patch_level);
+    }
+    else if (dof_index_sc_var)
+    {
+        constructPatchLevelSchwarzSubdomains_side(subdomain_dofs, num_dofs_per_proc, dof_index_idx, patch_level);
+    }
+    else
+    {
+        TBOX_ERROR("PETScVecUtilities::constructPatchLevelSchwarzSubdomains():\n"
+                   << "  unsupported data centering type for variable " << dof_index_var->getName() << "\n");
+    }
+    return;
+} // constructPatchLevelSchwarzSubdomains
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -596,6 +622,77 @@ void PETScVecUtilities::constructPatchLevelDOFIndices_side(std::vector<int>& num
     return;
 } // constructPatchLevelDOFIndices_side
 
+void PETScVecUtilities::constructPatchLevelSchwarzSubdomains_cell(std::vector<std::vector<int> >& subdomain_dofs,
+                                                                  const std::vector<int>& num_dofs_per_proc,
+                                                                  const int dof_index_idx,
+                                                                  Pointer<PatchLevel<NDIM> > patch_level)
+{
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int i_lower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int i_upper = i_lower + num_dofs_per_proc[mpi_rank];
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++, ++local_patch_num)
+    {
+        if (static_cast<int>(subdomain_dofs.size()) <= local_patch_num) subdomain_dofs.resize(local_patch_num + 1);
+        std::vector<int>& patch_dofs = subdomain_dofs[local_patch_num];
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        const int depth = dof_index_data->getDepth();
+        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
+        {
+            const CellIndex<NDIM>& i = b();
+            for (int d = 0; d < depth; ++d)
+            {
+                const int dof_index = (*dof_index_data)(i, d);
+                if (LIKELY(i_lower <= dof_index && dof_index < i_upper)) patch_dofs.push_back(dof_index);
+            }
+        }
+    }
+    return;
+} // constructPatchLevelSchwarzSubdomains_cell
+
+void PETScVecUtilities::constructPatchLevelSchwarzSubdomains_side(std::vector<std::vector<int> >& subdomain_dofs,
+                                                                  const std::vector<int>& num_dofs_per_proc,
+                                                                  const int dof_index_idx,
+                                                                  Pointer<PatchLevel<NDIM> > patch_level)
+{
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int i_lower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int i_upper = i_lower + num_dofs_per_proc[mpi_rank];
+
+    // Side-centered DOFs shared by neighboring local patches are assigned only
+    // to the first patch that contains them.
+    std::vector<bool> dof_assigned(num_dofs_per_proc[mpi_rank], false);
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++, ++local_patch_num)
+    {
+        if (static_cast<int>(subdomain_dofs.size()) <= local_patch_num) subdomain_dofs.resize(local_patch_num + 1);
+        std::vector<int>& patch_dofs = subdomain_dofs[local_patch_num];
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        const int depth = dof_index_data->getDepth();
+        for (unsigned int component_axis = 0; component_axis < NDIM; ++component_axis)
+        {
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, component_axis)); b; b++)
+            {
+                const SideIndex<NDIM> i(b(), component_axis, SideIndex<NDIM>::Lower);
+                for (int d = 0; d < depth; ++d)
+                {
+                    const int dof_index = (*dof_index_data)(i, d);
+                    if (LIKELY(i_lower <= dof_index && dof_index < i_upper) && !dof_assigned[dof_index - i_lower])
+                    {
+                        dof_assigned[dof_index - i_lower] = true;
+                        patch_dofs.push_back(dof_index);
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // constructPatchLevelSchwarzSubdomains_side
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
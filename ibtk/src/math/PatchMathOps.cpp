@@ -1173,6 +1173,26 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Compute the strides and the offset required to access the (column-major)
+// array data with the specified index box.
+inline void compute_array_strides(const Box<NDIM>& data_box, int stride[NDIM], int& offset)
+{
+    stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        stride[d] = stride[d - 1] * data_box.numberCells(d - 1);
+    }
+    offset = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset -= data_box.lower(d) * stride[d];
+    }
+    return;
+} // compute_array_strides
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 PatchMathOps::PatchMathOps()
@@ -4039,6 +4059,171 @@ void PatchMathOps::vc_laplace(Pointer<SideData<NDIM, double> > dst,
     return;
 } // vc_laplace
 
+void PatchMathOps::stokes(Pointer<SideData<NDIM, double> > dst_u,
+                          Pointer<CellData<NDIM, double> > dst_p,
+                          const double alpha,
+                          const double beta,
+                          const Pointer<SideData<NDIM, double> > src_u,
+                          const double gamma,
+                          const Pointer<CellData<NDIM, double> > src_p,
+                          const double delta,
+                          const Pointer<Patch<NDIM> > patch) const
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    const Box<NDIM>& patch_box = patch->getBox();
+
+#if !defined(NDEBUG)
+    if (src_u->getGhostCellWidth().min() < 1 || src_p->getGhostCellWidth().min() < 1)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src_u and src_p must have at least one layer of ghost cells" << std::endl);
+    }
+
+    if (src_u == dst_u)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src_u == dst_u." << std::endl);
+    }
+
+    if (patch_box != dst_u->getBox() || patch_box != dst_p->getBox() || patch_box != src_u->getBox() ||
+        patch_box != src_p->getBox())
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  dst_u, dst_p, src_u, and src_p must all live on the same patch" << std::endl);
+    }
+
+    if (dst_u->getDepth() != 1 || dst_p->getDepth() != 1 || src_u->getDepth() != 1 || src_p->getDepth() != 1)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  dst_u, dst_p, src_u, and src_p must be scalar-valued" << std::endl);
+    }
+#endif
+
+    // Setup the array strides and offsets.
+    double* A_U[NDIM];
+    const double* U[NDIM];
+    int A_U_stride[NDIM][NDIM], A_U_offset[NDIM], U_stride[NDIM][NDIM], U_offset[NDIM];
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        A_U[axis] = dst_u->getPointer(axis);
+        U[axis] = src_u->getPointer(axis);
+        compute_array_strides(dst_u->getArrayData(axis).getBox(), A_U_stride[axis], A_U_offset[axis]);
+        compute_array_strides(src_u->getArrayData(axis).getBox(), U_stride[axis], U_offset[axis]);
+    }
+    double* const A_P = dst_p->getPointer();
+    const double* const P = src_p->getPointer();
+    int A_P_stride[NDIM], A_P_offset, P_stride[NDIM], P_offset;
+    compute_array_strides(dst_p->getArrayData().getBox(), A_P_stride, A_P_offset);
+    compute_array_strides(src_p->getArrayData().getBox(), P_stride, P_offset);
+
+    double lap_fac[NDIM], grad_fac[NDIM], div_fac[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        lap_fac[d] = alpha / (dx[d] * dx[d]);
+        grad_fac[d] = gamma / dx[d];
+        div_fac[d] = delta / dx[d];
+    }
+
+    // Sweep over the rows of the patch (i.e., the index lines in the 0th
+    // coordinate direction).  Each row of side indices for each axis and each
+    // row of cell indices is processed simultaneously, so that each row of
+    // src_u and src_p is loaded only once.
+    const int ilower0 = patch_box.lower(0);
+    const int n0 = patch_box.numberCells(0);
+    int num_rows = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        num_rows *= patch_box.numberCells(d) + 1;
+    }
+    for (int row = 0; row < num_rows; ++row)
+    {
+        // Determine the index of the first entry of the row.
+        int idx[NDIM];
+        idx[0] = ilower0;
+        for (unsigned int d = 1, r = row; d < NDIM; ++d)
+        {
+            const int n = patch_box.numberCells(d) + 1;
+            idx[d] = patch_box.lower(d) + static_cast<int>(r) % n;
+            r /= n;
+        }
+
+        // Determine which data are defined along this row.
+        bool axis_active[NDIM];
+        bool cell_active = true;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            axis_active[axis] = true;
+            for (unsigned int d = 1; d < NDIM; ++d)
+            {
+                if (idx[d] > patch_box.upper(d) + (d == axis ? 1 : 0)) axis_active[axis] = false;
+            }
+        }
+        for (unsigned int d = 1; d < NDIM; ++d)
+        {
+            if (idx[d] > patch_box.upper(d)) cell_active = false;
+        }
+
+        // Compute the offsets of the first entries of the row.
+        int A_U_row[NDIM], U_row[NDIM];
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            A_U_row[axis] = A_U_offset[axis];
+            U_row[axis] = U_offset[axis];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                A_U_row[axis] += idx[d] * A_U_stride[axis][d];
+                U_row[axis] += idx[d] * U_stride[axis][d];
+            }
+        }
+        int A_P_row = A_P_offset, P_row = P_offset;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            A_P_row += idx[d] * A_P_stride[d];
+            P_row += idx[d] * P_stride[d];
+        }
+
+        // Compute dst_u = alpha L src_u + beta src_u + gamma grad src_p.
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            if (!axis_active[axis]) continue;
+            const int n = (axis == 0 ? n0 + 1 : n0);
+            double* const a_u = A_U[axis] + A_U_row[axis];
+            const double* const u = U[axis] + U_row[axis];
+            const double* const p = P + P_row;
+            const int p_shift = P_stride[axis];
+            for (int i = 0; i < n; ++i)
+            {
+                const double u_i = u[i];
+                double lap_u = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const int s = U_stride[axis][d];
+                    lap_u += lap_fac[d] * (u[i + s] - 2.0 * u_i + u[i - s]);
+                }
+                a_u[i] = lap_u + beta * u_i + grad_fac[axis] * (p[i] - p[i - p_shift]);
+            }
+        }
+
+        // Compute dst_p = delta div src_u.
+        if (cell_active)
+        {
+            double* const a_p = A_P + A_P_row;
+            for (int i = 0; i < n0; ++i)
+            {
+                double div_u = 0.0;
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const double* const u = U[axis] + U_row[axis];
+                    div_u += div_fac[axis] * (u[i + U_stride[axis][axis]] - u[i]);
+                }
+                a_p[i] = div_u;
+            }
+        }
+    }
+    return;
+} // stokes
+
 void PatchMathOps::pointwiseMultiply(Pointer<CellData<NDIM, double> > dst,
                                      const double alpha,
                                      const Pointer<CellData<NDIM, double> > src1,
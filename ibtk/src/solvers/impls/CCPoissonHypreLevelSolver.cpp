@@ -130,7 +130,8 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
                                                      Pointer<Database> input_db,
                                                      const std::string& /*default_options_prefix*/)
     : d_hierarchy(), d_level_num(-1), d_grid_aligned_anisotropy(true), d_depth(0), d_grid(NULL), d_stencil(NULL),
-      d_matrices(), d_rhs_vecs(), d_sol_vecs(), d_solvers(), d_preconds(), d_solver_type("PFMG"),
+      d_matrices(), d_rhs_vecs(), d_sol_vecs(), d_solvers(), d_preconds(), d_stencil_offsets(), d_grid_patch_boxes(),
+      d_solver_type("PFMG"),
       d_precond_type("none"), d_rel_change(0), d_num_pre_relax_steps(1), d_num_post_relax_steps(1), d_memory_use(0),
       d_rap_type(RAP_TYPE_GALERKIN), d_relax_type(RELAX_TYPE_WEIGHTED_JACOBI), d_skip_relax(1), d_two_norm(1)
 {
@@ -201,6 +202,7 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
 CCPoissonHypreLevelSolver::~CCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    deallocateHypreData();
     return;
 } // ~CCPoissonHypreLevelSolver
 
@@ -301,30 +303,33 @@ void CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDI
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized) deallocateSolverState();
 
-    // Get the hierarchy information.
-    d_hierarchy = x.getPatchHierarchy();
-    d_level_num = x.getCoarsestLevelNumber();
-
-    // Allocate and initialize the hypre data structures.
+    // Determine the problem configuration.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int x_idx = x.getComponentDescriptorIndex(0);
     Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
-    d_depth = x_fac->getDefaultDepth();
-    if (d_poisson_spec.dIsConstant())
+    const unsigned int depth = x_fac->getDefaultDepth();
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
     {
-        d_grid_aligned_anisotropy = true;
-    }
-    else
-    {
-        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
         Pointer<SideDataFactory<NDIM, double> > pdat_factory =
             var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
 #if !defined(NDEBUG)
         TBOX_ASSERT(pdat_factory);
 #endif
-        d_grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+    }
+
+    // Allocate the hypre data structures, unless the ones that were allocated
+    // by a previous call can be reused, and (re-)initialize the hypre matrices.
+    if (!canReuseHypreData(x.getPatchHierarchy(), x.getCoarsestLevelNumber(), depth, grid_aligned_anisotropy))
+    {
+        deallocateHypreData();
+        d_hierarchy = x.getPatchHierarchy();
+        d_level_num = x.getCoarsestLevelNumber();
+        d_depth = depth;
+        d_grid_aligned_anisotropy = grid_aligned_anisotropy;
+        allocateHypreData();
     }
-    allocateHypreData();
     if (d_grid_aligned_anisotropy)
     {
         setMatrixCoefficients_aligned();
@@ -348,9 +353,9 @@ void CCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
+    // Deallocate the hypre solvers.  The hypre grid, stencil, matrices, and
+    // vectors are retained so that they may be reused by initializeSolverState().
     destroyHypreSolver();
-    deallocateHypreData();
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -363,6 +368,29 @@ void CCPoissonHypreLevelSolver::deallocateSolverState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool CCPoissonHypreLevelSolver::canReuseHypreData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                  const int level_num,
+                                                  const unsigned int depth,
+                                                  const bool grid_aligned_anisotropy) const
+{
+    // NOTE: The hypre grid depends on the patch boxes on all processors, so the
+    // decision must be made collectively.
+    bool reuse_hypre_data = d_grid && hierarchy == d_hierarchy && level_num == d_level_num && depth == d_depth &&
+                            grid_aligned_anisotropy == d_grid_aligned_anisotropy;
+    if (reuse_hypre_data)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
+        unsigned int k = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); reuse_hypre_data && p; p++, ++k)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            reuse_hypre_data = k < d_grid_patch_boxes.size() && patch_box == d_grid_patch_boxes[k];
+        }
+        reuse_hypre_data = reuse_hypre_data && k == d_grid_patch_boxes.size();
+    }
+    return SAMRAI_MPI::minReduction(reuse_hypre_data ? 1 : 0) == 1;
+} // canReuseHypreData
+
 void CCPoissonHypreLevelSolver::allocateHypreData()
 {
     // Get the MPI communicator.
@@ -375,12 +403,14 @@ void CCPoissonHypreLevelSolver::allocateHypreData()
     const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(ratio);
 
     HYPRE_StructGridCreate(communicator, NDIM, &d_grid);
+    d_grid_patch_boxes.clear();
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
         Index<NDIM> lower = patch_box.lower();
         Index<NDIM> upper = patch_box.upper();
         HYPRE_StructGridSetExtents(d_grid, lower, upper);
+        d_grid_patch_boxes.push_back(patch_box);
     }
 
     int hypre_periodic_shift[3];
@@ -495,25 +525,26 @@ void CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
     {
         stencil_indices[i] = i;
     }
-    std::vector<double> mat_vals(stencil_sz, 0.0);
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_num);
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
+        Index<NDIM> lower = patch_box.lower();
+        Index<NDIM> upper = patch_box.upper();
         CellData<NDIM, double> matrix_coefs(patch_box, stencil_sz, IntVector<NDIM>(0));
         for (unsigned int k = 0; k < d_depth; ++k)
         {
             PoissonUtilities::computeCCMatrixCoefficients(
                 patch, matrix_coefs, d_stencil_offsets, d_poisson_spec, d_bc_coefs[k], d_solution_time);
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+
+            // NOTE: Each depth of matrix_coefs stores the values of a single
+            // stencil entry for all of the cells in the patch, in the same
+            // order used by hypre for box values.
+            for (int j = 0; j < stencil_sz; ++j)
             {
-                Index<NDIM> i = b();
-                for (int j = 0; j < stencil_sz; ++j)
-                {
-                    mat_vals[j] = matrix_coefs(i, j);
-                }
-                HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, &stencil_indices[0], &mat_vals[0]);
+                HYPRE_StructMatrixSetBoxValues(
+                    d_matrices[k], lower, upper, 1, &stencil_indices[j], matrix_coefs.getPointer(j));
             }
         }
     }
@@ -613,13 +644,15 @@ void CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
 
         // Set the matrix coefficients to correspond to a second-order accurate
         // finite difference stencil for the Laplace operator.
+        CellData<NDIM, double> matrix_coefs(patch_box, stencil_sz, no_ghosts);
+        std::vector<double> mat_vals(stencil_sz, 0.0);
         for (Box<NDIM>::Iterator b(patch_box); b; b++)
         {
             Index<NDIM> i = b();
             static const Index<NDIM> i_stencil_center(0);
             const int stencil_center = stencil_index_map[i_stencil_center];
 
-            std::vector<double> mat_vals(stencil_sz, 0.0);
+            std::fill(mat_vals.begin(), mat_vals.end(), 0.0);
             mat_vals[stencil_center] = (*C_data)(i);
 
             // The grid aligned part of the stencil (normal derivatives).
@@ -717,9 +750,21 @@ void CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
                 }
             }
 
-            for (unsigned int k = 0; k < d_depth; ++k)
+            for (int j = 0; j < stencil_sz; ++j)
+            {
+                matrix_coefs(i, j) = mat_vals[j];
+            }
+        }
+
+        // Copy the matrix coefficients to the hypre matrix structures.
+        Index<NDIM> lower = patch_box.lower();
+        Index<NDIM> upper = patch_box.upper();
+        for (unsigned int k = 0; k < d_depth; ++k)
+        {
+            for (int j = 0; j < stencil_sz; ++j)
             {
-                HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, stencil_indices, &mat_vals[0]);
+                HYPRE_StructMatrixSetBoxValues(
+                    d_matrices[k], lower, upper, 1, &stencil_indices[j], matrix_coefs.getPointer(j));
             }
         }
     }
@@ -1272,6 +1317,7 @@ void CCPoissonHypreLevelSolver::deallocateHypreData()
     if (d_stencil) HYPRE_StructStencilDestroy(d_stencil);
     d_grid = NULL;
     d_stencil = NULL;
+    d_grid_patch_boxes.clear();
     for (unsigned int k = 0; k < d_depth; ++k)
     {
         if (d_matrices[k]) HYPRE_StructMatrixDestroy(d_matrices[k]);
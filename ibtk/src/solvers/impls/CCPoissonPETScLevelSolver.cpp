@@ -196,6 +196,14 @@ void CCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     return;
 } // setupKSPVecs
 
+void CCPoissonPETScLevelSolver::generateSchwarzSubdomains(std::vector<std::vector<int> >& subdomain_dofs)
+{
+    Pointer<PatchLevel<NDIM> > patch_level = d_hierarchy->getPatchLevel(d_level_num);
+    PETScVecUtilities::constructPatchLevelSchwarzSubdomains(
+        subdomain_dofs, d_num_dofs_per_proc, d_dof_index_idx, patch_level);
+    return;
+} // generateSchwarzSubdomains
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
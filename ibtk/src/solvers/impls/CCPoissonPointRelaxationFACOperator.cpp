@@ -83,6 +83,7 @@
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/SolverTelemetryManager.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "petscmat.h"
@@ -101,10 +102,14 @@
 #if (NDIM == 2)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth2d, GSSMOOTH2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp2d, GSSMOOTHSP2D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp2d, RBGSSMOOTHSP2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp3d, GSSMOOTHSP3D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp3d, RBGSSMOOTHSP3D)
 #endif
 
 // Function interfaces
@@ -141,6 +146,39 @@ void RB_GS_SMOOTH_FC(double* U,
 #endif
                      const double* dx,
                      const int& red_or_black);
+
+void GS_SMOOTH_SP_FC(float* U,
+                     const int& U_gcw,
+                     const double& alpha,
+                     const double& beta,
+                     const float* F,
+                     const int& F_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+#if (NDIM == 3)
+                     const int& ilower2,
+                     const int& iupper2,
+#endif
+                     const double* dx);
+
+void RB_GS_SMOOTH_SP_FC(float* U,
+                        const int& U_gcw,
+                        const double& alpha,
+                        const double& beta,
+                        const float* F,
+                        const int& F_gcw,
+                        const int& ilower0,
+                        const int& iupper0,
+                        const int& ilower1,
+                        const int& iupper1,
+#if (NDIM == 3)
+                        const int& ilower2,
+                        const int& iupper2,
+#endif
+                        const double* dx,
+                        const int& red_or_black);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -248,7 +286,8 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
           input_db,
           default_options_prefix),
       d_coarse_solver(NULL), d_coarse_solver_db(), d_using_petsc_smoothers(true), d_patch_vec_e(), d_patch_vec_f(),
-      d_patch_mat(), d_patch_bc_box_overlap(), d_patch_neighbor_overlap()
+      d_patch_mat(), d_patch_bc_box_overlap(), d_patch_neighbor_overlap(), d_using_single_precision_smoother(false),
+      d_patch_sp_error_data(), d_patch_sp_residual_data(), d_patch_sp_exchange_boxes(), d_patch_sp_residual_idx()
 {
     // Set some default values.
     d_smoother_type = "PATCH_GAUSS_SEIDEL";
@@ -340,6 +379,7 @@ void CCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string&
     d_coarse_solver_type = coarse_solver_type;
     if (get_smoother_type(d_coarse_solver_type) == UNKNOWN && !d_coarse_solver)
     {
+        setCoarseSolverAgglomerationOptions(d_coarse_solver_db);
         d_coarse_solver = CCPoissonSolverManager::getManager()->allocateSolver(d_coarse_solver_type,
                                                                                d_object_name + "::coarse_solver",
                                                                                d_coarse_solver_db,
@@ -352,17 +392,24 @@ void CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, dou
                                                       const SAMRAIVectorReal<NDIM, double>& residual,
                                                       int level_num,
                                                       int num_sweeps,
-                                                      bool /*performing_pre_sweeps*/,
-                                                      bool /*performing_post_sweeps*/)
+                                                      bool performing_pre_sweeps,
+                                                      bool performing_post_sweeps)
 {
     if (num_sweeps == 0) return;
 
-    IBTK_TIMER_START(t_smooth_error);
+    IBTK_TIMER_START_LEVEL(t_smooth_error, level_num);
 
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int error_idx = error.getComponentDescriptorIndex(0);
+    const int residual_idx = residual.getComponentDescriptorIndex(0);
     const int scratch_idx = d_scratch_idx;
 
+    // The residual on this level is not modified between the pre- and
+    // post-smoothing sweeps of a cycle, and so the single-precision copy made
+    // during pre-smoothing is reused during post-smoothing.
+    const bool reuse_sp_residual_data = d_using_single_precision_smoother && performing_post_sweeps &&
+                                        d_patch_sp_residual_idx[level_num] == residual_idx;
+
     // Determine the smoother type.
     const std::string& smoother_type_string = (level_num == d_coarsest_ln ? d_coarse_solver_type : d_smoother_type);
     const SmootherType smoother_type = get_smoother_type(smoother_type_string);
@@ -476,6 +523,29 @@ void CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, dou
                 }
             }
 
+            // Update the single-precision copies of the error and residual.
+            // Only values along the patch boundary can have been modified
+            // since the previous sweep.
+            if (d_using_single_precision_smoother)
+            {
+                ArrayData<NDIM, float>& sp_error_data = *d_patch_sp_error_data[level_num][patch_counter];
+                ArrayData<NDIM, float>& sp_residual_data = *d_patch_sp_residual_data[level_num][patch_counter];
+                if (isweep == 0)
+                {
+                    copyToSinglePrecision(sp_error_data, error_data->getArrayData());
+                    if (!reuse_sp_residual_data)
+                    {
+                        copyToSinglePrecision(sp_residual_data, residual_data->getArrayData());
+                    }
+                }
+                else
+                {
+                    copyToSinglePrecision(sp_error_data,
+                                          error_data->getArrayData(),
+                                          d_patch_sp_exchange_boxes[level_num][patch_counter]);
+                }
+            }
+
             // Smooth the error for each data depth.
             //
             // NOTE: Since the boundary conditions are handled "implicitly" by
@@ -529,6 +599,66 @@ void CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, dou
                     IBTK_CHKERRQ(ierr);
                 }
             }
+            else if (d_using_single_precision_smoother)
+            {
+                // Smooth the single-precision error via Gauss-Seidel.
+                const double& alpha = d_poisson_spec.getDConstant();
+                const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+                ArrayData<NDIM, float>& sp_error_data = *d_patch_sp_error_data[level_num][patch_counter];
+                ArrayData<NDIM, float>& sp_residual_data = *d_patch_sp_residual_data[level_num][patch_counter];
+                for (int depth = 0; depth < error_data->getDepth(); ++depth)
+                {
+                    float* const U = sp_error_data.getPointer(depth);
+                    const int U_ghosts = (error_data->getGhostCellWidth()).max();
+                    const float* const F = sp_residual_data.getPointer(depth);
+                    const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+                    if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        RB_GS_SMOOTH_SP_FC(U,
+                                           U_ghosts,
+                                           alpha,
+                                           beta,
+                                           F,
+                                           F_ghosts,
+                                           patch_box.lower(0),
+                                           patch_box.upper(0),
+                                           patch_box.lower(1),
+                                           patch_box.upper(1),
+#if (NDIM == 3)
+                                           patch_box.lower(2),
+                                           patch_box.upper(2),
+#endif
+                                           dx,
+                                           red_or_black);
+                    }
+                    else
+                    {
+                        GS_SMOOTH_SP_FC(U,
+                                        U_ghosts,
+                                        alpha,
+                                        beta,
+                                        F,
+                                        F_ghosts,
+                                        patch_box.lower(0),
+                                        patch_box.upper(0),
+                                        patch_box.lower(1),
+                                        patch_box.upper(1),
+#if (NDIM == 3)
+                                        patch_box.lower(2),
+                                        patch_box.upper(2),
+#endif
+                                        dx);
+                    }
+                }
+
+                // Copy the updated patch boundary values back into the
+                // double-precision error so that they are available for ghost
+                // cell filling and for neighboring patches.
+                copyToDoublePrecision(error_data->getArrayData(),
+                                      sp_error_data,
+                                      d_patch_sp_exchange_boxes[level_num][patch_counter]);
+            }
             else
             {
                 // Smooth the error via Gauss-Seidel.
@@ -582,6 +712,19 @@ void CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, dou
             }
         }
     }
+
+    // Copy the smoothed single-precision error into the double-precision error.
+    if (d_using_single_precision_smoother)
+    {
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            copyToDoublePrecision(error_data->getArrayData(), *d_patch_sp_error_data[level_num][patch_counter]);
+        }
+        d_patch_sp_residual_idx[level_num] = performing_pre_sweeps ? residual_idx : -1;
+    }
     IBTK_TIMER_STOP(t_smooth_error);
     return;
 } // smoothError
@@ -655,7 +798,9 @@ void CCPoissonPointRelaxationFACOperator::computeResidual(SAMRAIVectorReal<NDIM,
             transaction_comp, d_hierarchy, coarsest_level_num, finest_level_num);
     }
     d_level_bdry_fill_ops[finest_level_num]->setHomogeneousBc(true);
+    SolverTelemetryManager::startPhase(GHOST_FILL_PHASE);
     d_level_bdry_fill_ops[finest_level_num]->fillData(d_solution_time);
+    SolverTelemetryManager::stopPhase(GHOST_FILL_PHASE);
     InterpolationTransactionComponent default_transaction_comp(d_solution->getComponentDescriptorIndex(0),
                                                                DATA_REFINE_TYPE,
                                                                USE_CF_INTERPOLATION,
@@ -807,6 +952,38 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         }
     }
 
+    // Allocate single-precision smoother data and determine the patch boundary
+    // layers that must be exchanged with the double-precision data.
+    d_using_single_precision_smoother = d_use_single_precision_smoother && !d_using_petsc_smoothers;
+    if (d_using_single_precision_smoother)
+    {
+        const int depth = solution_pdat_fac->getDefaultDepth();
+        d_patch_sp_error_data.resize(d_finest_ln + 1);
+        d_patch_sp_residual_data.resize(d_finest_ln + 1);
+        d_patch_sp_exchange_boxes.resize(d_finest_ln + 1);
+        d_patch_sp_residual_idx.resize(d_finest_ln + 1, -1);
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            d_patch_sp_residual_idx[ln] = -1;
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_sp_error_data[ln].resize(num_local_patches);
+            d_patch_sp_residual_data[ln].resize(num_local_patches);
+            d_patch_sp_exchange_boxes[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const Box<NDIM>& ghost_box = Box<NDIM>::grow(patch_box, d_gcw);
+                d_patch_sp_error_data[ln][patch_counter] = new ArrayData<NDIM, float>(ghost_box, depth);
+                d_patch_sp_residual_data[ln][patch_counter] = new ArrayData<NDIM, float>(ghost_box, depth);
+                d_patch_sp_exchange_boxes[ln][patch_counter] = BoxList<NDIM>(ghost_box);
+                d_patch_sp_exchange_boxes[ln][patch_counter].removeIntersections(Box<NDIM>::grow(patch_box, -1));
+            }
+        }
+    }
+
     // Get overlap information for re-setting patch boundary conditions during
     // smoothing.
     d_patch_neighbor_overlap.resize(d_finest_ln + 1);
@@ -879,6 +1056,10 @@ void CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(con
         d_patch_mat.clear();
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_patch_sp_error_data.clear();
+        d_patch_sp_residual_data.clear();
+        d_patch_sp_exchange_boxes.clear();
+        d_patch_sp_residual_idx.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <limits>
 #include <ostream>
 #include <string>
 
@@ -44,8 +45,10 @@
 #include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/SolverTelemetryManager.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
@@ -121,6 +124,11 @@ bool FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVec
     if (d_f) d_f->allocateVectorData();
     if (d_r) d_r->allocateVectorData();
 
+    // Begin recording solver telemetry.
+    SolverTelemetryManager* const telemetry_manager =
+        SolverTelemetryManager::isEnabled() ? SolverTelemetryManager::getManager() : NULL;
+    if (telemetry_manager) telemetry_manager->beginSolve(d_object_name);
+
     // Set the initial guess to equal zero.
     u.setToScalar(0.0, /*interior_only*/ false);
 
@@ -160,6 +168,15 @@ bool FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVec
         }
     }
 
+    // Finish recording solver telemetry.  The residual norm is not computed by
+    // the FAC preconditioner.
+    if (telemetry_manager)
+    {
+        static const int num_iterations = 1;
+        static const bool converged = true;
+        telemetry_manager->endSolve(num_iterations, std::numeric_limits<double>::quiet_NaN(), converged);
+    }
+
     // Deallocate scratch data.
     d_fac_strategy->deallocateScratchData();
     if (d_f) d_f->deallocateVectorData();
@@ -173,6 +190,8 @@ bool FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVec
 void FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& solution,
                                               const SAMRAIVectorReal<NDIM, double>& rhs)
 {
+    const double setup_start_time = MPI_Wtime();
+
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized)
     {
@@ -200,6 +219,13 @@ void FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, doubl
 
     // Indicate the operator is initialized.
     d_is_initialized = true;
+
+    // Record the setup cost, including the cost of initializing the FAC
+    // strategy.
+    if (SolverTelemetryManager::isEnabled())
+    {
+        SolverTelemetryManager::getManager()->recordSetup(d_object_name, MPI_Wtime() - setup_start_time);
+    }
     return;
 } // initializeSolverState
 
@@ -290,12 +316,16 @@ void FACPreconditioner::FACVCycleNoPreSmoothing(SAMRAIVectorReal<NDIM, double>&
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
+        SolverTelemetryManager::startPhase(COARSE_SOLVE_PHASE);
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        SolverTelemetryManager::stopPhase(COARSE_SOLVE_PHASE);
     }
     else
     {
         // Restrict the residual to the next coarser level.
+        SolverTelemetryManager::startPhase(RESTRICTION_PHASE);
         d_fac_strategy->restrictResidual(f, f, level_num - 1);
+        SolverTelemetryManager::stopPhase(RESTRICTION_PHASE);
 
         // Recursively call the FAC algorithm.
         FACVCycleNoPreSmoothing(u, f, level_num - 1);
@@ -303,12 +333,16 @@ void FACPreconditioner::FACVCycleNoPreSmoothing(SAMRAIVectorReal<NDIM, double>&
         // Prolong the error from the next coarser level.  Because we did not
         // perform any presmoothing, we do not need to correct the solution on
         // the current level.
+        SolverTelemetryManager::startPhase(PROLONGATION_PHASE);
         d_fac_strategy->prolongError(u, u, level_num);
+        SolverTelemetryManager::stopPhase(PROLONGATION_PHASE);
 
         // Smooth error on the current level.
         if (d_num_post_sweeps > 0)
         {
+            SolverTelemetryManager::startPhase(SMOOTH_PHASE);
             d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
+            SolverTelemetryManager::stopPhase(SMOOTH_PHASE);
         }
     }
     return;
@@ -319,7 +353,9 @@ void FACPreconditioner::FACVCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
+        SolverTelemetryManager::startPhase(COARSE_SOLVE_PHASE);
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        SolverTelemetryManager::stopPhase(COARSE_SOLVE_PHASE);
         d_recompute_residual = true;
     }
     else
@@ -327,7 +363,9 @@ void FACPreconditioner::FACVCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
         // Smooth the error on the current level.
         if (d_num_pre_sweeps > 0)
         {
+            SolverTelemetryManager::startPhase(SMOOTH_PHASE);
             d_fac_strategy->smoothError(u, f, level_num, d_num_pre_sweeps, true, false);
+            SolverTelemetryManager::stopPhase(SMOOTH_PHASE);
             d_recompute_residual = true;
         }
 
@@ -335,12 +373,18 @@ void FACPreconditioner::FACVCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
         // coarser level, and restrict the residual to the next coarser level.
         if (d_recompute_residual)
         {
+            SolverTelemetryManager::startPhase(RESIDUAL_PHASE);
             d_fac_strategy->computeResidual(*d_r, u, f, level_num - 1, level_num);
+            SolverTelemetryManager::stopPhase(RESIDUAL_PHASE);
+            SolverTelemetryManager::startPhase(RESTRICTION_PHASE);
             d_fac_strategy->restrictResidual(*d_r, f, level_num - 1);
+            SolverTelemetryManager::stopPhase(RESTRICTION_PHASE);
         }
         else
         {
+            SolverTelemetryManager::startPhase(RESTRICTION_PHASE);
             d_fac_strategy->restrictResidual(f, f, level_num - 1);
+            SolverTelemetryManager::stopPhase(RESTRICTION_PHASE);
         }
 
         // Recursively call the FAC algorithm.
@@ -348,12 +392,16 @@ void FACPreconditioner::FACVCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
 
         // Prolong the error from the next coarser level and correct the
         // solution on level.
+        SolverTelemetryManager::startPhase(PROLONGATION_PHASE);
         d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
+        SolverTelemetryManager::stopPhase(PROLONGATION_PHASE);
 
         // Smooth error on level.
         if (d_num_post_sweeps > 0)
         {
+            SolverTelemetryManager::startPhase(SMOOTH_PHASE);
             d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
+            SolverTelemetryManager::stopPhase(SMOOTH_PHASE);
             d_recompute_residual = true;
         }
     }
@@ -365,7 +413,9 @@ void FACPreconditioner::FACWCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
+        SolverTelemetryManager::startPhase(COARSE_SOLVE_PHASE);
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        SolverTelemetryManager::stopPhase(COARSE_SOLVE_PHASE);
         d_recompute_residual = true;
     }
     else
@@ -373,7 +423,9 @@ void FACPreconditioner::FACWCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
         // Smooth the error on the current level.
         if (d_num_pre_sweeps > 0)
         {
+            SolverTelemetryManager::startPhase(SMOOTH_PHASE);
             d_fac_strategy->smoothError(u, f, level_num, d_num_pre_sweeps, true, false);
+            SolverTelemetryManager::stopPhase(SMOOTH_PHASE);
             d_recompute_residual = true;
         }
 
@@ -381,12 +433,18 @@ void FACPreconditioner::FACWCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
         // coarser level, and restrict the residual to the next coarser level.
         if (d_recompute_residual)
         {
+            SolverTelemetryManager::startPhase(RESIDUAL_PHASE);
             d_fac_strategy->computeResidual(*d_r, u, f, level_num - 1, level_num);
+            SolverTelemetryManager::stopPhase(RESIDUAL_PHASE);
+            SolverTelemetryManager::startPhase(RESTRICTION_PHASE);
             d_fac_strategy->restrictResidual(*d_r, f, level_num - 1);
+            SolverTelemetryManager::stopPhase(RESTRICTION_PHASE);
         }
         else
         {
+            SolverTelemetryManager::startPhase(RESTRICTION_PHASE);
             d_fac_strategy->restrictResidual(f, f, level_num - 1);
+            SolverTelemetryManager::stopPhase(RESTRICTION_PHASE);
         }
 
         // Recursively call the FAC algorithm.
@@ -395,12 +453,16 @@ void FACPreconditioner::FACWCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
 
         // Prolong the error from the next coarser level and correct the
         // solution on level.
+        SolverTelemetryManager::startPhase(PROLONGATION_PHASE);
         d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
+        SolverTelemetryManager::stopPhase(PROLONGATION_PHASE);
 
         // Smooth error on level.
         if (d_num_post_sweeps > 0)
         {
+            SolverTelemetryManager::startPhase(SMOOTH_PHASE);
             d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
+            SolverTelemetryManager::stopPhase(SMOOTH_PHASE);
             d_recompute_residual = true;
         }
     }
@@ -412,7 +474,9 @@ void FACPreconditioner::FACFCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
+        SolverTelemetryManager::startPhase(COARSE_SOLVE_PHASE);
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        SolverTelemetryManager::stopPhase(COARSE_SOLVE_PHASE);
         d_recompute_residual = true;
     }
     else
@@ -420,7 +484,9 @@ void FACPreconditioner::FACFCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
         // Smooth the error on the current level.
         if (d_num_pre_sweeps > 0)
         {
+            SolverTelemetryManager::startPhase(SMOOTH_PHASE);
             d_fac_strategy->smoothError(u, f, level_num, d_num_pre_sweeps, true, false);
+            SolverTelemetryManager::stopPhase(SMOOTH_PHASE);
             d_recompute_residual = true;
         }
 
@@ -428,12 +494,18 @@ void FACPreconditioner::FACFCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
         // coarser level, and restrict the residual to the next coarser level.
         if (d_recompute_residual)
         {
+            SolverTelemetryManager::startPhase(RESIDUAL_PHASE);
             d_fac_strategy->computeResidual(*d_r, u, f, level_num - 1, level_num);
+            SolverTelemetryManager::stopPhase(RESIDUAL_PHASE);
+            SolverTelemetryManager::startPhase(RESTRICTION_PHASE);
             d_fac_strategy->restrictResidual(*d_r, f, level_num - 1);
+            SolverTelemetryManager::stopPhase(RESTRICTION_PHASE);
         }
         else
         {
+            SolverTelemetryManager::startPhase(RESTRICTION_PHASE);
             d_fac_strategy->restrictResidual(f, f, level_num - 1);
+            SolverTelemetryManager::stopPhase(RESTRICTION_PHASE);
         }
 
         // Recursively call the FAC algorithm.
@@ -442,12 +514,16 @@ void FACPreconditioner::FACFCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
 
         // Prolong the error from the next coarser level and correct the
         // solution on level.
+        SolverTelemetryManager::startPhase(PROLONGATION_PHASE);
         d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
+        SolverTelemetryManager::stopPhase(PROLONGATION_PHASE);
 
         // Smooth error on level.
         if (d_num_post_sweeps > 0)
         {
+            SolverTelemetryManager::startPhase(SMOOTH_PHASE);
             d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
+            SolverTelemetryManager::stopPhase(SMOOTH_PHASE);
             d_recompute_residual = true;
         }
     }
@@ -53,6 +53,7 @@
 #include "ibtk/PETScMatLOWrapper.h"
 #include "ibtk/PETScPCLSWrapper.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
+#include "ibtk/SolverTelemetryManager.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
@@ -118,6 +119,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("recycled_subspace_size"))
+            setRecycledSubspaceSize(input_db->getInteger("recycled_subspace_size"));
     }
 
     // Common constructor functionality.
@@ -222,6 +225,21 @@ bool PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAM
     // Allocate scratch data.
     if (d_b) d_b->allocateVectorData();
 
+    // Begin recording solver telemetry.
+    SolverTelemetryManager* const telemetry_manager =
+        SolverTelemetryManager::isEnabled() ? SolverTelemetryManager::getManager() : NULL;
+    if (telemetry_manager)
+    {
+        telemetry_manager->beginSolve(d_object_name);
+        if (telemetry_manager->getRecordResidualHistory())
+        {
+            d_residual_history.resize(std::max(d_max_iterations, 0) + 1);
+            ierr = KSPSetResidualHistory(
+                d_petsc_ksp, &d_residual_history[0], static_cast<PetscInt>(d_residual_history.size()), PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
     // Solve the system using a PETSc KSP object.
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_x, Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
     d_A->setHomogeneousBc(d_homogeneous_bc);
@@ -236,6 +254,18 @@ bool PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAM
         PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, d_b);
         d_A->setHomogeneousBc(true);
     }
+
+    // Improve the initial guess using the recycled subspace.
+    if (d_recycled_subspace_size > 0)
+    {
+        if (!d_initial_guess_nonzero) x.setToScalar(0.0);
+        SAMRAIVectorReal<NDIM, double>& b_hom = d_homogeneous_bc ? b : *d_b;
+        if (projectOntoRecycledSubspace(x, b_hom))
+        {
+            ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(d_petsc_x));
     IBTK_CHKERRQ(ierr);
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(d_petsc_b));
@@ -246,6 +276,12 @@ bool PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAM
     IBTK_CHKERRQ(ierr);
     ierr = KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
     IBTK_CHKERRQ(ierr);
+    if (d_recycled_subspace_size > 0)
+    {
+        updateRecycledSubspace(x);
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, d_initial_guess_nonzero ? PETSC_TRUE : PETSC_FALSE);
+        IBTK_CHKERRQ(ierr);
+    }
     d_A->setHomogeneousBc(d_homogeneous_bc);
 
     // Determine the convergence reason.
@@ -255,6 +291,21 @@ bool PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAM
     const bool converged = (static_cast<int>(reason) > 0);
     if (d_enable_logging) reportKSPConvergedReason(reason, plog);
 
+    // Finish recording solver telemetry.
+    if (telemetry_manager)
+    {
+        std::vector<double> residual_history;
+        if (telemetry_manager->getRecordResidualHistory())
+        {
+            PetscReal* history;
+            PetscInt history_len;
+            ierr = KSPGetResidualHistory(d_petsc_ksp, &history, &history_len);
+            IBTK_CHKERRQ(ierr);
+            residual_history.assign(history, history + history_len);
+        }
+        telemetry_manager->endSolve(d_current_iterations, d_current_residual_norm, converged, residual_history);
+    }
+
     // Dealocate scratch data.
     if (d_b) d_b->deallocateVectorData();
 
@@ -271,6 +322,7 @@ void PETScKrylovLinearSolver::initializeSolverState(const SAMRAIVectorReal<NDIM,
     IBTK_TIMER_START(t_initialize_solver_state);
 
     int ierr;
+    const double setup_start_time = MPI_Wtime();
 
 // Rudimentary error checking.
 #if !defined(NDEBUG)
@@ -384,6 +436,13 @@ void PETScKrylovLinearSolver::initializeSolverState(const SAMRAIVectorReal<NDIM,
     d_reinitializing_solver = false;
     d_is_initialized = true;
 
+    // Record the setup cost, including the cost of initializing the operator
+    // and preconditioner.
+    if (SolverTelemetryManager::isEnabled())
+    {
+        SolverTelemetryManager::getManager()->recordSetup(d_object_name, MPI_Wtime() - setup_start_time);
+    }
+
     IBTK_TIMER_STOP(t_initialize_solver_state);
     return;
 } // initializeSolverState
@@ -418,6 +477,10 @@ void PETScKrylovLinearSolver::deallocateSolverState()
     // Deallocate the nullspace object.
     deallocateNullspaceData();
 
+    // Discard the recycled subspace, which is only valid for the operator and
+    // patch hierarchy configuration used to generate it.
+    resetRecycledSubspace();
+
     // Destroy the KSP solver.
     if (d_managing_petsc_ksp)
     {
@@ -34,6 +34,8 @@
 
 #include <math.h>
 #include <stddef.h>
+#include <algorithm>
+#include <cstring>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -48,12 +50,15 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "petscksp.h"
+#include "petscis.h"
 #include "petscmat.h"
+#include "petscpc.h"
 #include "petscsys.h"
 #include "petscvec.h"
 #include "tbox/Database.h"
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
@@ -70,13 +75,25 @@ namespace
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+inline PCASMType string_to_pc_asm_type(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "ADDITIVE") == 0 || strcasecmp(val.c_str(), "BASIC") == 0) return PC_ASM_BASIC;
+    if (strcasecmp(val.c_str(), "RESTRICTED") == 0 || strcasecmp(val.c_str(), "RESTRICT") == 0) return PC_ASM_RESTRICT;
+    if (strcasecmp(val.c_str(), "INTERPOLATE") == 0) return PC_ASM_INTERPOLATE;
+    TBOX_ERROR("PETScLevelSolver: unsupported Schwarz type: " << val << "\n"
+               << "  valid choices are: ADDITIVE, RESTRICTED, INTERPOLATE\n");
+    return PC_ASM_RESTRICT;
+} // string_to_pc_asm_type
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 PETScLevelSolver::PETScLevelSolver()
     : d_hierarchy(), d_level_num(-1), d_ksp_type(KSPGMRES), d_options_prefix(""), d_petsc_ksp(NULL), d_petsc_mat(NULL),
-      d_petsc_x(NULL), d_petsc_b(NULL)
+      d_petsc_x(NULL), d_petsc_b(NULL), d_use_schwarz_pc(false), d_schwarz_type("RESTRICTED"), d_schwarz_overlap(1),
+      d_schwarz_subdomain_pc_type(PCLU), d_use_agglomeration(false), d_agglomeration_num_procs(1),
+      d_agglomeration_pc_type(PCLU)
 {
     // Setup default options.
     d_max_iterations = 10000;
@@ -256,8 +273,12 @@ void PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double
         ierr = KSPSetOptionsPrefix(d_petsc_ksp, d_options_prefix.c_str());
         IBTK_CHKERRQ(ierr);
     }
+    if (d_use_schwarz_pc) setupSchwarzPreconditioner();
+    if (d_use_agglomeration) setupAgglomeratedPreconditioner();
     ierr = KSPSetFromOptions(d_petsc_ksp);
     IBTK_CHKERRQ(ierr);
+    if (d_use_schwarz_pc) setupSchwarzSubdomainSolvers();
+    if (d_use_agglomeration) setupAgglomeratedSolver();
     if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty()) setupNullspace();
 
     // Indicate that the solver is initialized.
@@ -324,6 +345,40 @@ void PETScLevelSolver::init(Pointer<Database> input_db, const std::string& defau
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("use_schwarz_preconditioner"))
+            d_use_schwarz_pc = input_db->getBool("use_schwarz_preconditioner");
+        if (input_db->keyExists("schwarz_type")) d_schwarz_type = input_db->getString("schwarz_type");
+        if (input_db->keyExists("schwarz_overlap")) d_schwarz_overlap = input_db->getInteger("schwarz_overlap");
+        if (input_db->keyExists("schwarz_subdomain_pc_type"))
+            d_schwarz_subdomain_pc_type = input_db->getString("schwarz_subdomain_pc_type");
+        if (input_db->keyExists("use_agglomeration")) d_use_agglomeration = input_db->getBool("use_agglomeration");
+        if (input_db->keyExists("agglomeration_num_procs"))
+            d_agglomeration_num_procs = input_db->getInteger("agglomeration_num_procs");
+        if (input_db->keyExists("agglomeration_pc_type"))
+            d_agglomeration_pc_type = input_db->getString("agglomeration_pc_type");
+    }
+    if (d_use_schwarz_pc)
+    {
+        string_to_pc_asm_type(d_schwarz_type);
+        if (d_schwarz_overlap < 0)
+        {
+            TBOX_ERROR(d_object_name << "::init()\n"
+                                     << "  schwarz_overlap must be nonnegative" << std::endl);
+        }
+    }
+    if (d_use_agglomeration)
+    {
+        if (d_use_schwarz_pc)
+        {
+            TBOX_ERROR(d_object_name << "::init()\n"
+                                     << "  use_agglomeration and use_schwarz_preconditioner cannot both be set"
+                                     << std::endl);
+        }
+        if (d_agglomeration_num_procs < 1)
+        {
+            TBOX_ERROR(d_object_name << "::init()\n"
+                                     << "  agglomeration_num_procs must be positive" << std::endl);
+        }
     }
     return;
 } // init
@@ -361,8 +416,162 @@ void PETScLevelSolver::setupNullspace()
     return;
 } // setupNullspace
 
+void PETScLevelSolver::generateSchwarzSubdomains(std::vector<std::vector<int> >& /*subdomain_dofs*/)
+{
+    TBOX_ERROR(d_object_name << "::generateSchwarzSubdomains()\n"
+                             << "  patch-based Schwarz preconditioning is not supported by this solver" << std::endl);
+    return;
+} // generateSchwarzSubdomains
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void PETScLevelSolver::setupSchwarzPreconditioner()
+{
+    int ierr;
+
+    // Each local patch defines one non-overlapping subdomain.  PETSc requires
+    // at least one subdomain per process, so processes without patches get a
+    // single empty subdomain.
+    std::vector<std::vector<int> > subdomain_dofs;
+    generateSchwarzSubdomains(subdomain_dofs);
+    if (subdomain_dofs.empty()) subdomain_dofs.resize(1);
+    const int n_subdomains = static_cast<int>(subdomain_dofs.size());
+    std::vector<IS> is_overlap(n_subdomains), is_nonoverlap(n_subdomains);
+    for (int k = 0; k < n_subdomains; ++k)
+    {
+        std::vector<int>& dofs = subdomain_dofs[k];
+        std::sort(dofs.begin(), dofs.end());
+        dofs.erase(std::unique(dofs.begin(), dofs.end()), dofs.end());
+        const int n_dofs = static_cast<int>(dofs.size());
+        ierr = ISCreateGeneral(
+            PETSC_COMM_SELF, n_dofs, (dofs.empty() ? NULL : &dofs[0]), PETSC_COPY_VALUES, &is_overlap[k]);
+        IBTK_CHKERRQ(ierr);
+        ierr = ISCreateGeneral(
+            PETSC_COMM_SELF, n_dofs, (dofs.empty() ? NULL : &dofs[0]), PETSC_COPY_VALUES, &is_nonoverlap[k]);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Setup the preconditioner.  The overlapping subdomains are generated by
+    // PETSc by growing the patch subdomains along the matrix graph.
+    PC petsc_pc;
+    ierr = KSPGetPC(d_petsc_ksp, &petsc_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(petsc_pc, PCASM);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCASMSetType(petsc_pc, string_to_pc_asm_type(d_schwarz_type));
+    IBTK_CHKERRQ(ierr);
+    ierr = PCASMSetLocalSubdomains(petsc_pc, n_subdomains, &is_overlap[0], &is_nonoverlap[0]);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCASMSetOverlap(petsc_pc, d_schwarz_overlap);
+    IBTK_CHKERRQ(ierr);
+    for (int k = 0; k < n_subdomains; ++k)
+    {
+        ierr = ISDestroy(&is_overlap[k]);
+        IBTK_CHKERRQ(ierr);
+        ierr = ISDestroy(&is_nonoverlap[k]);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // setupSchwarzPreconditioner
+
+void PETScLevelSolver::setupSchwarzSubdomainSolvers()
+{
+    int ierr;
+    PC petsc_pc;
+    ierr = KSPGetPC(d_petsc_ksp, &petsc_pc);
+    IBTK_CHKERRQ(ierr);
+    PetscBool is_asm;
+    ierr = PetscObjectTypeCompare(reinterpret_cast<PetscObject>(petsc_pc), PCASM, &is_asm);
+    IBTK_CHKERRQ(ierr);
+    if (!is_asm) return;
+
+    // The subdomain solvers are only available once the preconditioner has
+    // been setup.  Subdomain solves default to a single application of the
+    // (direct) subdomain preconditioner; this may be overridden at runtime.
+    ierr = KSPSetUp(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    int n_local_blocks;
+    KSP* sub_ksps;
+    ierr = PCASMGetSubKSP(petsc_pc, &n_local_blocks, NULL, &sub_ksps);
+    IBTK_CHKERRQ(ierr);
+    for (int k = 0; k < n_local_blocks; ++k)
+    {
+        ierr = KSPSetType(sub_ksps[k], KSPPREONLY);
+        IBTK_CHKERRQ(ierr);
+        PC sub_pc;
+        ierr = KSPGetPC(sub_ksps[k], &sub_pc);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCSetType(sub_pc, d_schwarz_subdomain_pc_type.c_str());
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetFromOptions(sub_ksps[k]);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Factor the subdomain matrices now so that the factorizations are reused
+    // by all subsequent solves.
+    ierr = KSPSetUpOnBlocks(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // setupSchwarzSubdomainSolvers
+
+void PETScLevelSolver::setupAgglomeratedPreconditioner()
+{
+    int ierr;
+
+    // Each subcommunicator receives a complete copy of the level system, so
+    // that the solution is available to every process without any further
+    // communication among the subcommunicators.
+    const int num_procs = SAMRAI_MPI::getNodes();
+    const int num_subcomms = std::max(1, num_procs / std::min(num_procs, d_agglomeration_num_procs));
+    PC petsc_pc;
+    ierr = KSPGetPC(d_petsc_ksp, &petsc_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(petsc_pc, PCREDUNDANT);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCRedundantSetNumber(petsc_pc, num_subcomms);
+    IBTK_CHKERRQ(ierr);
+
+    // The gathered system is solved by a single application of the specified
+    // preconditioner; this may be overridden at runtime.
+    KSP redundant_ksp;
+    ierr = PCRedundantGetKSP(petsc_pc, &redundant_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetType(redundant_ksp, KSPPREONLY);
+    IBTK_CHKERRQ(ierr);
+    PC redundant_pc;
+    ierr = KSPGetPC(redundant_ksp, &redundant_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(redundant_pc, d_agglomeration_pc_type.c_str());
+    IBTK_CHKERRQ(ierr);
+    if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty())
+    {
+        // Shift singular operators so that they can be factored.
+        ierr = PCFactorSetShiftType(redundant_pc, MAT_SHIFT_NONZERO);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // setupAgglomeratedPreconditioner
+
+void PETScLevelSolver::setupAgglomeratedSolver()
+{
+    int ierr;
+    PC petsc_pc;
+    ierr = KSPGetPC(d_petsc_ksp, &petsc_pc);
+    IBTK_CHKERRQ(ierr);
+    PetscBool is_redundant;
+    ierr = PetscObjectTypeCompare(reinterpret_cast<PetscObject>(petsc_pc), PCREDUNDANT, &is_redundant);
+    IBTK_CHKERRQ(ierr);
+    if (!is_redundant) return;
+
+    // Gather and factor the level system now so that the factorization is
+    // reused by all subsequent solves.
+    ierr = KSPSetUp(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUpOnBlocks(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // setupAgglomeratedSolver
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
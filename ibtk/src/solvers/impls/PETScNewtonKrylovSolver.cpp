@@ -33,8 +33,10 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
@@ -52,6 +54,7 @@
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/PETScSNESFunctionGOWrapper.h"
 #include "ibtk/PETScSNESJacobianJOWrapper.h"
+#include "ibtk/SolverTelemetryManager.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
@@ -213,6 +216,25 @@ bool PETScNewtonKrylovSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAM
     if (d_b) d_b->allocateVectorData();
     if (d_r) d_r->allocateVectorData();
 
+    // Begin recording solver telemetry.
+    SolverTelemetryManager* const telemetry_manager =
+        SolverTelemetryManager::isEnabled() ? SolverTelemetryManager::getManager() : NULL;
+    if (telemetry_manager)
+    {
+        telemetry_manager->beginSolve(d_object_name);
+        if (telemetry_manager->getRecordResidualHistory())
+        {
+            d_residual_history.resize(std::max(d_max_iterations, 0) + 1);
+            d_residual_history_its.resize(d_residual_history.size());
+            ierr = SNESSetConvergenceHistory(d_petsc_snes,
+                                             &d_residual_history[0],
+                                             &d_residual_history_its[0],
+                                             static_cast<PetscInt>(d_residual_history.size()),
+                                             PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
     // Solve the system using a PETSc SNES object.
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_x, Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
     Pointer<LinearOperator> A = d_F;
@@ -248,6 +270,22 @@ bool PETScNewtonKrylovSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAM
     const bool converged = (static_cast<int>(reason) > 0);
     if (d_enable_logging) reportSNESConvergedReason(reason, plog);
 
+    // Finish recording solver telemetry.
+    if (telemetry_manager)
+    {
+        std::vector<double> residual_history;
+        if (telemetry_manager->getRecordResidualHistory())
+        {
+            PetscReal* history;
+            PetscInt* history_its;
+            PetscInt history_len;
+            ierr = SNESGetConvergenceHistory(d_petsc_snes, &history, &history_its, &history_len);
+            IBTK_CHKERRQ(ierr);
+            residual_history.assign(history, history + history_len);
+        }
+        telemetry_manager->endSolve(d_current_iterations, d_current_residual_norm, converged, residual_history);
+    }
+
     // Deallocate scratch data.
     if (d_b) d_b->deallocateVectorData();
     if (d_r) d_r->deallocateVectorData();
@@ -265,6 +303,7 @@ void PETScNewtonKrylovSolver::initializeSolverState(const SAMRAIVectorReal<NDIM,
     IBTK_TIMER_START(t_initialize_solver_state);
 
     int ierr;
+    const double setup_start_time = MPI_Wtime();
 
 // Rudimentary error checking.
 #if !defined(NDEBUG)
@@ -383,6 +422,13 @@ void PETScNewtonKrylovSolver::initializeSolverState(const SAMRAIVectorReal<NDIM,
     d_reinitializing_solver = false;
     d_is_initialized = true;
 
+    // Record the setup cost, including the cost of initializing the Krylov
+    // solver.
+    if (SolverTelemetryManager::isEnabled())
+    {
+        SolverTelemetryManager::getManager()->recordSetup(d_object_name, MPI_Wtime() - setup_start_time);
+    }
+
     IBTK_TIMER_STOP(t_initialize_solver_state);
     return;
 } // initializeSolverState
@@ -38,6 +38,9 @@
 #include <string>
 #include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenOperator.h"
@@ -68,9 +71,11 @@
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/SolverTelemetryManager.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Database.h"
+#include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
@@ -105,13 +110,14 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
       d_bc_coefs(1, d_default_bc_coef), d_gcw(ghost_cell_width), d_solution(NULL), d_rhs(NULL), d_hierarchy(),
       d_coarsest_ln(-1), d_finest_ln(-1), d_level_data_ops(), d_level_bdry_fill_ops(), d_level_math_ops(),
       d_in_initialize_operator_state(false), d_coarsest_reset_ln(-1), d_finest_reset_ln(-1), d_smoother_type("DEFAULT"),
-      d_prolongation_method("DEFAULT"), d_restriction_method("DEFAULT"), d_coarse_solver_type("DEFAULT"),
-      d_coarse_solver_default_options_prefix(default_options_prefix + "_coarse"),
+      d_use_single_precision_smoother(false), d_prolongation_method("DEFAULT"), d_restriction_method("DEFAULT"),
+      d_coarse_solver_type("DEFAULT"), d_coarse_solver_default_options_prefix(default_options_prefix + "_coarse"),
       d_coarse_solver_rel_residual_tol(1.0e-5), d_coarse_solver_abs_residual_tol(1.0e-50),
-      d_coarse_solver_max_iterations(10), d_context(NULL), d_bc_op(NULL), d_cf_bdry_op(), d_op_stencil_fill_pattern(),
-      d_prolongation_refine_operator(), d_prolongation_refine_patch_strategy(), d_prolongation_refine_algorithm(),
-      d_prolongation_refine_schedules(), d_restriction_coarsen_operator(), d_restriction_coarsen_algorithm(),
-      d_restriction_coarsen_schedules(), d_ghostfill_nocoarse_refine_algorithm(),
+      d_coarse_solver_max_iterations(10), d_coarse_solver_agglomeration_num_procs(0),
+      d_coarse_solver_agglomeration_pc_type("lu"), d_context(NULL), d_bc_op(NULL), d_cf_bdry_op(),
+      d_op_stencil_fill_pattern(), d_prolongation_refine_operator(), d_prolongation_refine_patch_strategy(),
+      d_prolongation_refine_algorithm(), d_prolongation_refine_schedules(), d_restriction_coarsen_operator(),
+      d_restriction_coarsen_algorithm(), d_restriction_coarsen_schedules(), d_ghostfill_nocoarse_refine_algorithm(),
       d_ghostfill_nocoarse_refine_schedules(), d_synch_refine_algorithm(), d_synch_refine_schedules()
 {
     // Initialize the Poisson specifications.
@@ -142,6 +148,12 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
             d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("coarse_solver_agglomeration_num_procs"))
+            d_coarse_solver_agglomeration_num_procs = input_db->getInteger("coarse_solver_agglomeration_num_procs");
+        if (input_db->keyExists("coarse_solver_agglomeration_pc_type"))
+            d_coarse_solver_agglomeration_pc_type = input_db->getString("coarse_solver_agglomeration_pc_type");
+        if (input_db->keyExists("use_single_precision_smoother"))
+            d_use_single_precision_smoother = input_db->getBool("use_single_precision_smoother");
     }
 
     // Setup scratch variables.
@@ -265,6 +277,17 @@ void PoissonFACPreconditionerStrategy::setRestrictionMethod(const std::string& r
     return;
 } // setRestrictionMethod
 
+void PoissonFACPreconditionerStrategy::setUseSinglePrecisionSmoother(const bool use_single_precision_smoother)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setUseSinglePrecisionSmoother()\n"
+                                 << "  cannot be called while operator state is initialized" << std::endl);
+    }
+    d_use_single_precision_smoother = use_single_precision_smoother;
+    return;
+} // setUseSinglePrecisionSmoother
+
 void PoissonFACPreconditionerStrategy::restrictResidual(const SAMRAIVectorReal<NDIM, double>& src,
                                                         SAMRAIVectorReal<NDIM, double>& dst,
                                                         int dst_ln)
@@ -535,6 +558,108 @@ void PoissonFACPreconditionerStrategy::deallocateScratchData()
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void PoissonFACPreconditionerStrategy::setCoarseSolverAgglomerationOptions(Pointer<Database> coarse_solver_db) const
+{
+    if (d_coarse_solver_agglomeration_num_procs <= 0) return;
+    if (d_coarse_solver_type != "PETSC_LEVEL_SOLVER")
+    {
+        pout << d_object_name << "::setCoarseSolverAgglomerationOptions():\n"
+             << "  WARNING: coarsest level agglomeration requires coarse_solver_type = PETSC_LEVEL_SOLVER\n"
+             << "  ignoring coarse_solver_agglomeration_num_procs = " << d_coarse_solver_agglomeration_num_procs
+             << std::endl;
+        return;
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coarse_solver_db);
+#endif
+    coarse_solver_db->putBool("use_agglomeration", true);
+    coarse_solver_db->putInteger("agglomeration_num_procs", d_coarse_solver_agglomeration_num_procs);
+    coarse_solver_db->putString("agglomeration_pc_type", d_coarse_solver_agglomeration_pc_type);
+    return;
+} // setCoarseSolverAgglomerationOptions
+
+void PoissonFACPreconditionerStrategy::copyToSinglePrecision(ArrayData<NDIM, float>& dst,
+                                                             const ArrayData<NDIM, double>& src)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst.getBox() == src.getBox());
+    TBOX_ASSERT(dst.getDepth() == src.getDepth());
+#endif
+    const int size = dst.getBox().size();
+    for (int d = 0; d < dst.getDepth(); ++d)
+    {
+        float* const dst_data = dst.getPointer(d);
+        const double* const src_data = src.getPointer(d);
+        for (int k = 0; k < size; ++k)
+        {
+            dst_data[k] = static_cast<float>(src_data[k]);
+        }
+    }
+    return;
+} // copyToSinglePrecision
+
+void PoissonFACPreconditionerStrategy::copyToSinglePrecision(ArrayData<NDIM, float>& dst,
+                                                             const ArrayData<NDIM, double>& src,
+                                                             const BoxList<NDIM>& boxes)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst.getDepth() == src.getDepth());
+#endif
+    for (BoxList<NDIM>::Iterator bl(boxes); bl; bl++)
+    {
+        const Box<NDIM> box = bl() * dst.getBox() * src.getBox();
+        for (int d = 0; d < dst.getDepth(); ++d)
+        {
+            for (Box<NDIM>::Iterator b(box); b; b++)
+            {
+                dst(b(), d) = static_cast<float>(src(b(), d));
+            }
+        }
+    }
+    return;
+} // copyToSinglePrecision
+
+void PoissonFACPreconditionerStrategy::copyToDoublePrecision(ArrayData<NDIM, double>& dst,
+                                                             const ArrayData<NDIM, float>& src)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst.getBox() == src.getBox());
+    TBOX_ASSERT(dst.getDepth() == src.getDepth());
+#endif
+    const int size = dst.getBox().size();
+    for (int d = 0; d < dst.getDepth(); ++d)
+    {
+        double* const dst_data = dst.getPointer(d);
+        const float* const src_data = src.getPointer(d);
+        for (int k = 0; k < size; ++k)
+        {
+            dst_data[k] = static_cast<double>(src_data[k]);
+        }
+    }
+    return;
+} // copyToDoublePrecision
+
+void PoissonFACPreconditionerStrategy::copyToDoublePrecision(ArrayData<NDIM, double>& dst,
+                                                             const ArrayData<NDIM, float>& src,
+                                                             const BoxList<NDIM>& boxes)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst.getDepth() == src.getDepth());
+#endif
+    for (BoxList<NDIM>::Iterator bl(boxes); bl; bl++)
+    {
+        const Box<NDIM> box = bl() * dst.getBox() * src.getBox();
+        for (int d = 0; d < dst.getDepth(); ++d)
+        {
+            for (Box<NDIM>::Iterator b(box); b; b++)
+            {
+                dst(b(), d) = static_cast<double>(src(b(), d));
+            }
+        }
+    }
+    return;
+} // copyToDoublePrecision
+
 void PoissonFACPreconditionerStrategy::xeqScheduleProlongation(const int dst_idx, const int src_idx, const int dst_ln)
 {
     d_cf_bdry_op->setPatchDataIndex(dst_idx);
@@ -590,7 +715,9 @@ void PoissonFACPreconditionerStrategy::xeqScheduleGhostFillNoCoarse(const int ds
     RefineAlgorithm<NDIM> refiner;
     refiner.registerRefine(dst_idx, dst_idx, dst_idx, Pointer<RefineOperator<NDIM> >(), d_op_stencil_fill_pattern);
     refiner.resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
+    SolverTelemetryManager::startPhase(GHOST_FILL_PHASE);
     d_ghostfill_nocoarse_refine_schedules[dst_ln]->fillData(d_solution_time);
+    SolverTelemetryManager::stopPhase(GHOST_FILL_PHASE);
     d_ghostfill_nocoarse_refine_algorithm->resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
     for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
     {
@@ -605,7 +732,9 @@ void PoissonFACPreconditionerStrategy::xeqScheduleDataSynch(const int dst_idx, c
     RefineAlgorithm<NDIM> refiner;
     refiner.registerRefine(dst_idx, dst_idx, dst_idx, Pointer<RefineOperator<NDIM> >(), d_synch_fill_pattern);
     refiner.resetSchedule(d_synch_refine_schedules[dst_ln]);
+    SolverTelemetryManager::startPhase(GHOST_FILL_PHASE);
     d_synch_refine_schedules[dst_ln]->fillData(d_solution_time);
+    SolverTelemetryManager::stopPhase(GHOST_FILL_PHASE);
     d_synch_refine_algorithm->resetSchedule(d_synch_refine_schedules[dst_ln]);
     return;
 } // xeqScheduleDataSynch
@@ -51,7 +51,6 @@
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
 #include "SideGeometry.h"
-#include "SideIndex.h"
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/PoissonUtilities.h"
 #include "ibtk/SCPoissonHypreLevelSolver.h"
@@ -96,7 +95,8 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
                                                      Pointer<Database> input_db,
                                                      const std::string& /*default_options_prefix*/)
     : d_hierarchy(), d_level_num(-1), d_grid(NULL), d_stencil(), d_graph(NULL), d_matrix(NULL), d_rhs_vec(NULL),
-      d_sol_vec(NULL), d_solver(NULL), d_precond(NULL), d_solver_type("Split"), d_precond_type("none"),
+      d_sol_vec(NULL), d_solver(NULL), d_precond(NULL), d_stencil_offsets(), d_grid_patch_boxes(),
+      d_solver_type("Split"), d_precond_type("none"),
       d_split_solver_type("PFMG"), d_rel_change(0), d_num_pre_relax_steps(1), d_num_post_relax_steps(1),
       d_relax_type(RELAX_TYPE_WEIGHTED_JACOBI), d_skip_relax(1), d_two_norm(1)
 {
@@ -163,6 +163,7 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
 SCPoissonHypreLevelSolver::~SCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    deallocateHypreData();
     return;
 } // ~SCPoissonHypreLevelSolver
 
@@ -265,12 +266,15 @@ void SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDI
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized) deallocateSolverState();
 
-    // Get the hierarchy information.
-    d_hierarchy = x.getPatchHierarchy();
-    d_level_num = x.getCoarsestLevelNumber();
-
-    // Allocate and initialize the hypre data structures.
-    allocateHypreData();
+    // Allocate the hypre data structures, unless the ones that were allocated
+    // by a previous call can be reused, and (re-)initialize the hypre matrix.
+    if (!canReuseHypreData(x.getPatchHierarchy(), x.getCoarsestLevelNumber()))
+    {
+        deallocateHypreData();
+        d_hierarchy = x.getPatchHierarchy();
+        d_level_num = x.getCoarsestLevelNumber();
+        allocateHypreData();
+    }
     setMatrixCoefficients();
     setupHypreSolver();
 
@@ -287,9 +291,9 @@ void SCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
+    // Deallocate the hypre solver.  The hypre grid, stencil, graph, matrix, and
+    // vectors are retained so that they may be reused by initializeSolverState().
     destroyHypreSolver();
-    deallocateHypreData();
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -302,6 +306,26 @@ void SCPoissonHypreLevelSolver::deallocateSolverState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool SCPoissonHypreLevelSolver::canReuseHypreData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                  const int level_num) const
+{
+    // NOTE: The hypre grid depends on the patch boxes on all processors, so the
+    // decision must be made collectively.
+    bool reuse_hypre_data = d_grid && hierarchy == d_hierarchy && level_num == d_level_num;
+    if (reuse_hypre_data)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
+        unsigned int k = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); reuse_hypre_data && p; p++, ++k)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            reuse_hypre_data = k < d_grid_patch_boxes.size() && patch_box == d_grid_patch_boxes[k];
+        }
+        reuse_hypre_data = reuse_hypre_data && k == d_grid_patch_boxes.size();
+    }
+    return SAMRAI_MPI::minReduction(reuse_hypre_data ? 1 : 0) == 1;
+} // canReuseHypreData
+
 void SCPoissonHypreLevelSolver::allocateHypreData()
 {
     // Get the MPI communicator.
@@ -314,12 +338,14 @@ void SCPoissonHypreLevelSolver::allocateHypreData()
     const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(ratio);
 
     HYPRE_SStructGridCreate(communicator, NDIM, NPARTS, &d_grid);
+    d_grid_patch_boxes.clear();
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
         Index<NDIM> lower = patch_box.lower();
         Index<NDIM> upper = patch_box.upper();
         HYPRE_SStructGridSetExtents(d_grid, PART, lower, upper);
+        d_grid_patch_boxes.push_back(patch_box);
     }
 
     int hypre_periodic_shift[3];
@@ -398,29 +424,30 @@ void SCPoissonHypreLevelSolver::setMatrixCoefficients()
         PoissonUtilities::computeSCMatrixCoefficients(
             patch, matrix_coefs, d_stencil_offsets, d_poisson_spec, d_bc_coefs, d_solution_time);
 
-        // Copy matrix entries to the hypre matrix structure.
+        // Copy matrix entries to the hypre matrix structure, one stencil entry
+        // at a time.  Each depth of matrix_coefs stores the values of a single
+        // stencil entry for all of the sides in the patch, in the same order
+        // used by hypre for box values.
         std::vector<int> stencil_indices(stencil_sz);
         for (int i = 0; i < stencil_sz; ++i)
         {
             stencil_indices[i] = i;
         }
-        std::vector<double> mat_vals(stencil_sz, 0.0);
         for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-            for (Box<NDIM>::Iterator b(side_box); b; b++)
+            // NOTE: In SAMRAI, face-centered values are associated with the
+            // cell index located on the "upper" side of the face, but in
+            // hypre, face-centered values are associated with the cell index
+            // located on the "lower" side of the face.
+            const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            Index<NDIM> lower = side_box.lower();
+            Index<NDIM> upper = side_box.upper();
+            lower(axis) -= 1;
+            upper(axis) -= 1;
+            for (int k = 0; k < stencil_sz; ++k)
             {
-                SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                for (int k = 0; k < stencil_sz; ++k)
-                {
-                    mat_vals[k] = matrix_coefs(i, k);
-                }
-                // NOTE: In SAMRAI, face-centered values are associated with the
-                // cell index located on the "upper" side of the face, but in
-                // hypre, face-centered values are associated with the cell
-                // index located on the "lower" side of the face.
-                i(axis) -= 1;
-                HYPRE_SStructMatrixSetValues(d_matrix, PART, i, axis, stencil_sz, &stencil_indices[0], &mat_vals[0]);
+                HYPRE_SStructMatrixSetBoxValues(
+                    d_matrix, PART, lower, upper, axis, 1, &stencil_indices[k], matrix_coefs.getPointer(axis, k));
             }
         }
     }
@@ -894,7 +921,9 @@ void SCPoissonHypreLevelSolver::deallocateHypreData()
     if (d_matrix) HYPRE_SStructMatrixDestroy(d_matrix);
     if (d_sol_vec) HYPRE_SStructVectorDestroy(d_sol_vec);
     if (d_rhs_vec) HYPRE_SStructVectorDestroy(d_rhs_vec);
+    d_graph = NULL;
     d_grid = NULL;
+    d_grid_patch_boxes.clear();
     for (int var = 0; var < NVARS; ++var)
     {
         d_stencil[var] = NULL;
@@ -80,6 +80,7 @@
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/SideNoCornersFillPattern.h"
 #include "ibtk/SideSynchCopyFillPattern.h"
+#include "ibtk/SolverTelemetryManager.h"
 #include "ibtk/StaggeredPhysicalBoundaryHelper.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -98,12 +99,16 @@
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask2d, GSSMOOTHMASK2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask2d, RBGSSMOOTHMASK2D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp2d, GSSMOOTHSP2D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp2d, RBGSSMOOTHSP2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask3d, GSSMOOTHMASK3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask3d, RBGSSMOOTHMASK3D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp3d, GSSMOOTHSP3D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp3d, RBGSSMOOTHSP3D)
 #endif
 
 // Function interfaces
@@ -177,6 +182,39 @@ void RB_GS_SMOOTH_MASK_FC(double* U,
 #endif
                           const double* dx,
                           const int& red_or_black);
+
+void GS_SMOOTH_SP_FC(float* U,
+                     const int& U_gcw,
+                     const double& alpha,
+                     const double& beta,
+                     const float* F,
+                     const int& F_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+#if (NDIM == 3)
+                     const int& ilower2,
+                     const int& iupper2,
+#endif
+                     const double* dx);
+
+void RB_GS_SMOOTH_SP_FC(float* U,
+                        const int& U_gcw,
+                        const double& alpha,
+                        const double& beta,
+                        const float* F,
+                        const int& F_gcw,
+                        const int& ilower0,
+                        const int& iupper0,
+                        const int& ilower1,
+                        const int& iupper1,
+#if (NDIM == 3)
+                        const int& ilower2,
+                        const int& iupper2,
+#endif
+                        const double* dx,
+                        const int& red_or_black);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -266,7 +304,8 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
           SIDEG,
           input_db,
           default_options_prefix),
-      d_coarse_solver(NULL), d_coarse_solver_db(), d_patch_bc_box_overlap(), d_patch_neighbor_overlap()
+      d_coarse_solver(NULL), d_coarse_solver_db(), d_patch_bc_box_overlap(), d_patch_neighbor_overlap(),
+      d_patch_sp_error_data(), d_patch_sp_residual_data(), d_patch_sp_exchange_boxes(), d_patch_sp_residual_idx()
 {
     // Set some default values.
     d_smoother_type = "PATCH_GAUSS_SEIDEL";
@@ -366,6 +405,7 @@ void SCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string&
     d_coarse_solver_type = coarse_solver_type;
     if (get_smoother_type(d_coarse_solver_type) == UNKNOWN && !d_coarse_solver)
     {
+        setCoarseSolverAgglomerationOptions(d_coarse_solver_db);
         d_coarse_solver = SCPoissonSolverManager::getManager()->allocateSolver(d_coarse_solver_type,
                                                                                d_object_name + "::coarse_solver",
                                                                                d_coarse_solver_db,
@@ -378,17 +418,24 @@ void SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, dou
                                                       const SAMRAIVectorReal<NDIM, double>& residual,
                                                       int level_num,
                                                       int num_sweeps,
-                                                      bool /*performing_pre_sweeps*/,
-                                                      bool /*performing_post_sweeps*/)
+                                                      bool performing_pre_sweeps,
+                                                      bool performing_post_sweeps)
 {
     if (num_sweeps == 0) return;
 
-    IBTK_TIMER_START(t_smooth_error);
+    IBTK_TIMER_START_LEVEL(t_smooth_error, level_num);
 
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int error_idx = error.getComponentDescriptorIndex(0);
+    const int residual_idx = residual.getComponentDescriptorIndex(0);
     const int scratch_idx = d_scratch_idx;
 
+    // The residual on this level is not modified between the pre- and
+    // post-smoothing sweeps of a cycle, and so the single-precision copy made
+    // during pre-smoothing is reused during post-smoothing.
+    const bool reuse_sp_residual_data = d_use_single_precision_smoother && performing_post_sweeps &&
+                                        d_patch_sp_residual_idx[level_num] == residual_idx;
+
     // Determine the smoother type.
     const std::string& smoother_type_string = (level_num == d_coarsest_ln ? d_coarse_solver_type : d_smoother_type);
     const SmootherType smoother_type = get_smoother_type(smoother_type_string);
@@ -523,6 +570,84 @@ void SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, dou
             // Smooth the error using Gauss-Seidel.
             const double& alpha = d_poisson_spec.getDConstant();
             const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+            if (d_use_single_precision_smoother && !patch_has_dirichlet_bdry)
+            {
+                for (int axis = 0; axis < NDIM; ++axis)
+                {
+                    // Update the single-precision copies of the error and
+                    // residual.  Only values along the patch boundary can have
+                    // been modified since the previous sweep.
+                    ArrayData<NDIM, float>& sp_error_data = *d_patch_sp_error_data[level_num][patch_counter][axis];
+                    ArrayData<NDIM, float>& sp_residual_data =
+                        *d_patch_sp_residual_data[level_num][patch_counter][axis];
+                    const BoxList<NDIM>& exchange_boxes = d_patch_sp_exchange_boxes[level_num][patch_counter][axis];
+                    if (isweep == 0)
+                    {
+                        copyToSinglePrecision(sp_error_data, error_data->getArrayData(axis));
+                        if (!reuse_sp_residual_data)
+                        {
+                            copyToSinglePrecision(sp_residual_data, residual_data->getArrayData(axis));
+                        }
+                    }
+                    else
+                    {
+                        copyToSinglePrecision(sp_error_data, error_data->getArrayData(axis), exchange_boxes);
+                    }
+
+                    const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                    for (int depth = 0; depth < error_data->getDepth(); ++depth)
+                    {
+                        float* const U = sp_error_data.getPointer(depth);
+                        const int U_ghosts = (error_data->getGhostCellWidth()).max();
+                        const float* const F = sp_residual_data.getPointer(depth);
+                        const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+                        if (red_black_ordering)
+                        {
+                            int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                            RB_GS_SMOOTH_SP_FC(U,
+                                               U_ghosts,
+                                               alpha,
+                                               beta,
+                                               F,
+                                               F_ghosts,
+                                               side_patch_box.lower(0),
+                                               side_patch_box.upper(0),
+                                               side_patch_box.lower(1),
+                                               side_patch_box.upper(1),
+#if (NDIM == 3)
+                                               side_patch_box.lower(2),
+                                               side_patch_box.upper(2),
+#endif
+                                               dx,
+                                               red_or_black);
+                        }
+                        else
+                        {
+                            GS_SMOOTH_SP_FC(U,
+                                            U_ghosts,
+                                            alpha,
+                                            beta,
+                                            F,
+                                            F_ghosts,
+                                            side_patch_box.lower(0),
+                                            side_patch_box.upper(0),
+                                            side_patch_box.lower(1),
+                                            side_patch_box.upper(1),
+#if (NDIM == 3)
+                                            side_patch_box.lower(2),
+                                            side_patch_box.upper(2),
+#endif
+                                            dx);
+                        }
+                    }
+
+                    // Copy the updated patch boundary values back into the
+                    // double-precision error so that they are available for
+                    // ghost cell filling and for neighboring patches.
+                    copyToDoublePrecision(error_data->getArrayData(axis), sp_error_data, exchange_boxes);
+                }
+                continue;
+            }
             for (int axis = 0; axis < NDIM; ++axis)
             {
                 const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
@@ -625,6 +750,24 @@ void SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, dou
         }
     }
 
+    // Copy the smoothed single-precision error into the double-precision error.
+    if (d_use_single_precision_smoother)
+    {
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (d_bc_helper->patchTouchesDirichletBoundary(patch)) continue;
+            Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                copyToDoublePrecision(error_data->getArrayData(axis),
+                                      *d_patch_sp_error_data[level_num][patch_counter][axis]);
+            }
+        }
+        d_patch_sp_residual_idx[level_num] = performing_pre_sweeps ? residual_idx : -1;
+    }
+
     // Synchronize data along patch boundaries.
     xeqScheduleDataSynch(error_idx, level_num);
     IBTK_TIMER_STOP(t_smooth_error);
@@ -702,7 +845,9 @@ void SCPoissonPointRelaxationFACOperator::computeResidual(SAMRAIVectorReal<NDIM,
             transaction_comp, d_hierarchy, coarsest_level_num, finest_level_num);
     }
     d_level_bdry_fill_ops[finest_level_num]->setHomogeneousBc(true);
+    SolverTelemetryManager::startPhase(GHOST_FILL_PHASE);
     d_level_bdry_fill_ops[finest_level_num]->fillData(d_solution_time);
+    SolverTelemetryManager::stopPhase(GHOST_FILL_PHASE);
     InterpolationTransactionComponent default_transaction_comp(d_solution->getComponentDescriptorIndex(0),
                                                                DATA_REFINE_TYPE,
                                                                USE_CF_INTERPOLATION,
@@ -833,6 +978,43 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         }
     }
 
+    // Allocate single-precision smoother data and determine the patch boundary
+    // layers that must be exchanged with the double-precision data.
+    if (d_use_single_precision_smoother)
+    {
+        const int depth = solution_pdat_fac->getDefaultDepth();
+        d_patch_sp_error_data.resize(d_finest_ln + 1);
+        d_patch_sp_residual_data.resize(d_finest_ln + 1);
+        d_patch_sp_exchange_boxes.resize(d_finest_ln + 1);
+        d_patch_sp_residual_idx.resize(d_finest_ln + 1, -1);
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            d_patch_sp_residual_idx[ln] = -1;
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_sp_error_data[ln].resize(num_local_patches);
+            d_patch_sp_residual_data[ln].resize(num_local_patches);
+            d_patch_sp_exchange_boxes[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                    const Box<NDIM> side_ghost_box = Box<NDIM>::grow(side_box, d_gcw);
+                    d_patch_sp_error_data[ln][patch_counter][axis] = new ArrayData<NDIM, float>(side_ghost_box, depth);
+                    d_patch_sp_residual_data[ln][patch_counter][axis] =
+                        new ArrayData<NDIM, float>(side_ghost_box, depth);
+                    d_patch_sp_exchange_boxes[ln][patch_counter][axis] = BoxList<NDIM>(side_ghost_box);
+                    d_patch_sp_exchange_boxes[ln][patch_counter][axis].removeIntersections(
+                        Box<NDIM>::grow(side_box, -1));
+                }
+            }
+        }
+    }
+
     // Get overlap information for re-setting patch boundary conditions during
     // smoothing.
     d_patch_neighbor_overlap.resize(d_finest_ln + 1);
@@ -880,6 +1062,10 @@ void SCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(con
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_patch_sp_error_data.clear();
+        d_patch_sp_residual_data.clear();
+        d_patch_sp_exchange_boxes.clear();
+        d_patch_sp_residual_idx.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
@@ -32,9 +32,16 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <string>
+#include <vector>
+
+#include "SAMRAIVectorReal.h"
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/LinearOperator.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -42,9 +49,18 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Relative tolerance used to detect corrections that are (nearly) linearly
+// dependent upon the recycled subspace.
+static const double RECYCLED_SUBSPACE_DEPENDENCE_TOL = 1.0e-8;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-KrylovLinearSolver::KrylovLinearSolver() : d_A(NULL), d_pc_solver(NULL), d_x(NULL), d_b(NULL)
+KrylovLinearSolver::KrylovLinearSolver()
+    : d_A(NULL), d_pc_solver(NULL), d_x(NULL), d_b(NULL), d_recycled_subspace_size(0), d_recycled_U(),
+      d_recycled_C(), d_recycled_x0(NULL), d_recycled_r(NULL)
 {
     // intentionally blank
     return;
@@ -52,7 +68,7 @@ KrylovLinearSolver::KrylovLinearSolver() : d_A(NULL), d_pc_solver(NULL), d_x(NUL
 
 KrylovLinearSolver::~KrylovLinearSolver()
 {
-    // intentionally blank
+    resetRecycledSubspace();
     return;
 } // ~KrylovLinearSolver()
 
@@ -131,6 +147,133 @@ Pointer<LinearSolver> KrylovLinearSolver::getPreconditioner() const
     return d_pc_solver;
 } // getPreconditioner
 
+void KrylovLinearSolver::setRecycledSubspaceSize(const int recycled_subspace_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(recycled_subspace_size >= 0);
+#endif
+    d_recycled_subspace_size = recycled_subspace_size;
+    while (static_cast<int>(d_recycled_U.size()) > d_recycled_subspace_size)
+    {
+        d_recycled_U.front()->freeVectorComponents();
+        d_recycled_U.erase(d_recycled_U.begin());
+        d_recycled_C.front()->freeVectorComponents();
+        d_recycled_C.erase(d_recycled_C.begin());
+    }
+    return;
+} // setRecycledSubspaceSize
+
+int KrylovLinearSolver::getRecycledSubspaceSize() const
+{
+    return d_recycled_subspace_size;
+} // getRecycledSubspaceSize
+
+void KrylovLinearSolver::resetRecycledSubspace()
+{
+    for (unsigned int k = 0; k < d_recycled_U.size(); ++k)
+    {
+        d_recycled_U[k]->freeVectorComponents();
+        d_recycled_C[k]->freeVectorComponents();
+    }
+    d_recycled_U.clear();
+    d_recycled_C.clear();
+    if (d_recycled_x0)
+    {
+        d_recycled_x0->freeVectorComponents();
+        d_recycled_x0.setNull();
+    }
+    if (d_recycled_r)
+    {
+        d_recycled_r->freeVectorComponents();
+        d_recycled_r.setNull();
+    }
+    return;
+} // resetRecycledSubspace
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+bool KrylovLinearSolver::projectOntoRecycledSubspace(SAMRAIVectorReal<NDIM, double>& x,
+                                                     SAMRAIVectorReal<NDIM, double>& b)
+{
+    if (d_recycled_subspace_size <= 0) return false;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_A);
+#endif
+    if (!d_recycled_x0)
+    {
+        d_recycled_x0 = x.cloneVector(d_object_name + "::recycled_x0");
+        d_recycled_x0->allocateVectorData();
+        d_recycled_r = b.cloneVector(d_object_name + "::recycled_r");
+        d_recycled_r->allocateVectorData();
+    }
+
+    // Minimize the residual r = b - Ax over x + span(U).  Because the columns
+    // of C = AU are orthonormal, the minimizer is x + U C^T r.
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+    const bool modified_x = !d_recycled_U.empty();
+    if (modified_x)
+    {
+        d_A->apply(x, *d_recycled_r);
+        d_recycled_r->subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&b, false), d_recycled_r);
+        for (unsigned int k = 0; k < d_recycled_U.size(); ++k)
+        {
+            const double alpha = d_recycled_C[k]->dot(d_recycled_r);
+            x.axpy(alpha, d_recycled_U[k], x_ptr);
+            d_recycled_r->axpy(-alpha, d_recycled_C[k], d_recycled_r);
+        }
+    }
+    d_recycled_x0->copyVector(x_ptr);
+    return modified_x;
+} // projectOntoRecycledSubspace
+
+void KrylovLinearSolver::updateRecycledSubspace(SAMRAIVectorReal<NDIM, double>& x)
+{
+    if (d_recycled_subspace_size <= 0 || !d_recycled_x0) return;
+
+    // Reuse the storage of the oldest vectors when the subspace is full.
+    Pointer<SAMRAIVectorReal<NDIM, double> > u, c;
+    if (static_cast<int>(d_recycled_U.size()) == d_recycled_subspace_size)
+    {
+        u = d_recycled_U.front();
+        d_recycled_U.erase(d_recycled_U.begin());
+        c = d_recycled_C.front();
+        d_recycled_C.erase(d_recycled_C.begin());
+    }
+    else
+    {
+        u = x.cloneVector(d_object_name + "::recycled_U");
+        u->allocateVectorData();
+        c = d_recycled_r->cloneVector(d_object_name + "::recycled_C");
+        c->allocateVectorData();
+    }
+
+    // Compute the correction u = x - x0 and its image c = Au.
+    u->subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false), d_recycled_x0);
+    d_A->apply(*u, *c);
+
+    // Orthonormalize c against the retained images via modified Gram-Schmidt,
+    // applying the same transformation to u.
+    const double c_norm_initial = c->L2Norm();
+    for (unsigned int k = 0; k < d_recycled_C.size(); ++k)
+    {
+        const double beta = d_recycled_C[k]->dot(c);
+        c->axpy(-beta, d_recycled_C[k], c);
+        u->axpy(-beta, d_recycled_U[k], u);
+    }
+    const double c_norm = c->L2Norm();
+    if (c_norm <= RECYCLED_SUBSPACE_DEPENDENCE_TOL * c_norm_initial || c_norm_initial == 0.0)
+    {
+        u->freeVectorComponents();
+        c->freeVectorComponents();
+        return;
+    }
+    u->scale(1.0 / c_norm, u);
+    c->scale(1.0 / c_norm, c);
+    d_recycled_U.push_back(u);
+    d_recycled_C.push_back(c);
+    return;
+} // updateRecycledSubspace
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
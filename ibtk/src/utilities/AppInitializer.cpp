@@ -42,6 +42,8 @@
 #include "VisItDataWriter.h"
 #include "ibtk/AppInitializer.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/SolverTelemetryManager.h"
+#include "ibtk/TimerTreeManager.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -423,6 +425,18 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         }
         TimerManager::createManager(timer_manager_db);
     }
+
+    // Configure the hierarchical timer tree.
+    if (d_input_db->isDatabase("TimerTreeManager"))
+    {
+        TimerTreeManager::setFromDatabase(d_input_db->getDatabase("TimerTreeManager"));
+    }
+
+    // Configure solver telemetry.
+    if (d_input_db->isDatabase("SolverTelemetryManager"))
+    {
+        SolverTelemetryManager::setFromDatabase(d_input_db->getDatabase("SolverTelemetryManager"));
+    }
     return;
 } // AppInitializer
 
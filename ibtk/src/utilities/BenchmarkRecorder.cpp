@@ -0,0 +1,237 @@
+// Filename: BenchmarkRecorder.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/BenchmarkRecorder.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+BenchmarkRecorder::BenchmarkRecorder(const std::string& object_name, Pointer<Database> input_db)
+    : d_object_name(object_name), d_num_warmup_iterations(1), d_num_iterations(10),
+      d_results_filename("benchmark_results.jsonl"), d_tag(""), d_parameters(), d_num_completed_warmup_iterations(0),
+      d_iteration_times(), d_iteration_start_time(0.0)
+{
+    bool append_results = false;
+    if (input_db)
+    {
+        if (input_db->keyExists("num_warmup_iterations"))
+            d_num_warmup_iterations = input_db->getInteger("num_warmup_iterations");
+        if (input_db->keyExists("num_iterations")) d_num_iterations = input_db->getInteger("num_iterations");
+        if (input_db->keyExists("results_filename")) d_results_filename = input_db->getString("results_filename");
+        if (input_db->keyExists("append_results")) append_results = input_db->getBool("append_results");
+        if (input_db->keyExists("tag")) d_tag = input_db->getString("tag");
+    }
+    if (d_num_warmup_iterations < 0 || d_num_iterations < 1)
+    {
+        TBOX_ERROR(d_object_name << "::BenchmarkRecorder():\n"
+                                 << "  num_warmup_iterations must be nonnegative and num_iterations must be positive"
+                                 << std::endl);
+    }
+
+    // Truncate the results file unless we are appending to prior results.
+    if (SAMRAI_MPI::getRank() == 0 && !append_results)
+    {
+        std::ofstream os(d_results_filename.c_str(), std::ios::trunc);
+        if (!os.good())
+        {
+            TBOX_ERROR(d_object_name << "::BenchmarkRecorder():\n"
+                                     << "  unable to open file " << d_results_filename << std::endl);
+        }
+    }
+    return;
+} // BenchmarkRecorder
+
+BenchmarkRecorder::~BenchmarkRecorder()
+{
+    // intentionally blank
+    return;
+} // ~BenchmarkRecorder
+
+void BenchmarkRecorder::setParameter(const std::string& key, const std::string& value)
+{
+    setFormattedParameter(key, "\"" + escape_json(value) + "\"");
+    return;
+} // setParameter
+
+void BenchmarkRecorder::setParameter(const std::string& key, const char* const value)
+{
+    setParameter(key, std::string(value));
+    return;
+} // setParameter
+
+void BenchmarkRecorder::setParameter(const std::string& key, const int value)
+{
+    std::ostringstream stream;
+    stream << value;
+    setFormattedParameter(key, stream.str());
+    return;
+} // setParameter
+
+void BenchmarkRecorder::setParameter(const std::string& key, const double value)
+{
+    std::ostringstream stream;
+    stream << std::setprecision(16) << value;
+    setFormattedParameter(key, stream.str());
+    return;
+} // setParameter
+
+void BenchmarkRecorder::clearParameters()
+{
+    d_parameters.clear();
+    return;
+} // clearParameters
+
+bool BenchmarkRecorder::continueIterations() const
+{
+    return d_num_completed_warmup_iterations < d_num_warmup_iterations ||
+           static_cast<int>(d_iteration_times.size()) < d_num_iterations;
+} // continueIterations
+
+void BenchmarkRecorder::startIteration()
+{
+    SAMRAI_MPI::barrier();
+    d_iteration_start_time = MPI_Wtime();
+    return;
+} // startIteration
+
+void BenchmarkRecorder::stopIteration()
+{
+    const double iteration_time = SAMRAI_MPI::maxReduction(MPI_Wtime() - d_iteration_start_time);
+    if (d_num_completed_warmup_iterations < d_num_warmup_iterations)
+    {
+        ++d_num_completed_warmup_iterations;
+    }
+    else
+    {
+        d_iteration_times.push_back(iteration_time);
+    }
+    return;
+} // stopIteration
+
+void BenchmarkRecorder::recordBenchmark(const std::string& benchmark_name)
+{
+    if (d_iteration_times.empty())
+    {
+        TBOX_ERROR(d_object_name << "::recordBenchmark():\n"
+                                 << "  no timed iterations for benchmark " << benchmark_name << std::endl);
+    }
+
+    // Compute iteration time statistics.  Iteration times are identical on all
+    // MPI processes.
+    std::vector<double> times(d_iteration_times);
+    std::sort(times.begin(), times.end());
+    const int num_times = static_cast<int>(times.size());
+    const double min_time = times.front();
+    const double max_time = times.back();
+    const double median_time =
+        num_times % 2 == 1 ? times[num_times / 2] : 0.5 * (times[num_times / 2 - 1] + times[num_times / 2]);
+    const double mean_time = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(num_times);
+
+    std::ostringstream params;
+    for (std::vector<std::pair<std::string, std::string> >::const_iterator it = d_parameters.begin();
+         it != d_parameters.end();
+         ++it)
+    {
+        params << (it == d_parameters.begin() ? "" : ", ") << "\"" << escape_json(it->first) << "\": " << it->second;
+    }
+
+    pout << d_object_name << "::recordBenchmark(): " << benchmark_name << " {" << params.str() << "}\n"
+         << "  min = " << min_time << " s, median = " << median_time << " s, mean = " << mean_time
+         << " s, max = " << max_time << " s (" << num_times << " iterations)\n";
+
+    if (SAMRAI_MPI::getRank() == 0)
+    {
+        std::ofstream os(d_results_filename.c_str(), std::ios::app);
+        os << std::setprecision(9);
+        os << "{\"benchmark\": \"" << escape_json(benchmark_name) << "\", \"tag\": \"" << escape_json(d_tag)
+           << "\", \"num_ranks\": " << SAMRAI_MPI::getNodes() << ", \"params\": {" << params.str()
+           << "}, \"num_iterations\": " << num_times << ", \"min\": " << min_time << ", \"median\": " << median_time
+           << ", \"mean\": " << mean_time << ", \"max\": " << max_time << ", \"times\": [";
+        for (int k = 0; k < num_times; ++k)
+        {
+            os << (k == 0 ? "" : ", ") << d_iteration_times[k];
+        }
+        os << "]}\n";
+    }
+
+    d_num_completed_warmup_iterations = 0;
+    d_iteration_times.clear();
+    return;
+} // recordBenchmark
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void BenchmarkRecorder::setFormattedParameter(const std::string& key, const std::string& value)
+{
+    for (std::vector<std::pair<std::string, std::string> >::iterator it = d_parameters.begin();
+         it != d_parameters.end();
+         ++it)
+    {
+        if (it->first == key)
+        {
+            it->second = value;
+            return;
+        }
+    }
+    d_parameters.push_back(std::make_pair(key, value));
+    return;
+} // setFormattedParameter
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
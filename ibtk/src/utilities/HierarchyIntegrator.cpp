@@ -78,14 +78,18 @@
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/SolverTelemetryManager.h"
+#include "ibtk/TimerTreeManager.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -144,6 +148,11 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_max_integrator_steps = std::numeric_limits<int>::max();
     d_regrid_interval = 1;
     d_regrid_mode = STANDARD;
+    d_measure_regrid_costs = false;
+    d_regrid_wall_time = 0.0;
+    d_min_step_wall_time_since_regrid = std::numeric_limits<double>::max();
+    d_stale_grid_cost_since_regrid = 0.0;
+    d_num_steps_since_regrid = 0;
     d_enable_logging = false;
     d_bdry_extrap_type = "LINEAR";
     d_manage_hier_math_ops = true;
@@ -321,9 +330,26 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
         if (d_enable_logging)
             plog << d_object_name << "::advanceHierarchy(): regridding prior to timestep " << d_integrator_step << "\n";
         d_regridding_hierarchy = true;
+        const double regrid_start_time = MPI_Wtime();
         regridHierarchy();
+        if (d_measure_regrid_costs)
+        {
+            d_regrid_wall_time = SAMRAI_MPI::maxReduction(MPI_Wtime() - regrid_start_time);
+        }
         d_regridding_hierarchy = false;
         d_at_regrid_time_step = true;
+        d_min_step_wall_time_since_regrid = std::numeric_limits<double>::max();
+        d_stale_grid_cost_since_regrid = 0.0;
+        d_num_steps_since_regrid = 0;
+        if (d_enable_logging && d_measure_regrid_costs)
+            plog << d_object_name << "::advanceHierarchy(): regrid wall clock time = " << d_regrid_wall_time
+                 << "\n";
+    }
+    const double step_start_time = MPI_Wtime();
+    TimerTreeManager::setTimeStepNumber(d_integrator_step);
+    if (SolverTelemetryManager::isEnabled())
+    {
+        SolverTelemetryManager::getManager()->beginTimeStep(d_integrator_step, current_time);
     }
 
     // Determine the number of cycles and the time step size.
@@ -378,6 +404,21 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): resetting time dependent data\n";
     resetTimeDependentHierarchyData(new_time);
 
+    // Update the measured cost of advancing the solution on the current grid.
+    if (d_measure_regrid_costs)
+    {
+        const double step_wall_time = SAMRAI_MPI::maxReduction(MPI_Wtime() - step_start_time);
+        d_min_step_wall_time_since_regrid = std::min(d_min_step_wall_time_since_regrid, step_wall_time);
+        d_stale_grid_cost_since_regrid += step_wall_time - d_min_step_wall_time_since_regrid;
+    }
+    ++d_num_steps_since_regrid;
+
+    // Aggregate the solver telemetry recorded during the time step.
+    if (SolverTelemetryManager::isEnabled())
+    {
+        SolverTelemetryManager::getManager()->endTimeStep();
+    }
+
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
     return;
@@ -497,6 +538,30 @@ int HierarchyIntegrator::getIntegratorStep() const
     return d_integrator_step;
 } // getIntegratorStep
 
+void HierarchyIntegrator::getSolverTelemetry(std::vector<SolverTelemetryManager::TimeStepSummary>& summaries) const
+{
+    summaries.clear();
+    if (!SolverTelemetryManager::isEnabled()) return;
+    const std::vector<SolverTelemetryManager::TimeStepSummary>& all_summaries =
+        SolverTelemetryManager::getManager()->getTimeStepSummaries();
+    std::deque<const HierarchyIntegrator*> hier_integrators(1, this);
+    while (!hier_integrators.empty())
+    {
+        const HierarchyIntegrator* integrator = hier_integrators.front();
+        const std::string prefix = integrator->d_object_name + "::";
+        for (std::vector<SolverTelemetryManager::TimeStepSummary>::const_iterator it = all_summaries.begin();
+             it != all_summaries.end();
+             ++it)
+        {
+            if (it->solver_name.compare(0, prefix.size(), prefix) == 0) summaries.push_back(*it);
+        }
+        hier_integrators.pop_front();
+        hier_integrators.insert(
+            hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
+    }
+    return;
+} // getSolverTelemetry
+
 int HierarchyIntegrator::getMaxIntegratorSteps() const
 {
     return d_max_integrator_steps;
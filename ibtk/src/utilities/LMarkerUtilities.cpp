@@ -39,12 +39,14 @@
 #include <iosfwd>
 #include <istream>
 #include <limits>
+#include <map>
 #include <string>
 #include <vector>
 
 #include "BasePatchLevel.h"
 #include "Box.h"
 #include "BoxArray.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -58,6 +60,7 @@
 #include "PatchData.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "RefineAlgorithm.h"
 #include "RefineOperator.h"
 #include "RefineSchedule.h"
@@ -76,7 +79,9 @@
 #include "ibtk/LSetData.h"
 #include "ibtk/LSetDataIterator.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/SparseExchange.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Array.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/SAMRAI_MPI.h"
@@ -124,6 +129,14 @@ inline std::string discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Tag used for messages sent during marker redistribution.
+static const int MARKER_REDISTRIBUTION_TAG = 0x4c4d;
+
+// Number of doubles used to communicate a single marker: the destination level
+// number, the destination patch number, the marker index, the marker position,
+// and the marker velocity.
+static const int MARKER_RECORD_SIZE = 3 + 2 * NDIM;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -264,53 +277,40 @@ void LMarkerUtilities::eulerStep(const int mark_current_idx,
 {
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    std::vector<LMarker*> marks_current, marks_new;
+    std::vector<double> X_mark, U_mark;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            Pointer<PatchData<NDIM> > u_current_data = patch->getPatchData(u_current_idx);
-            Pointer<CellData<NDIM, double> > u_cc_current_data = u_current_data;
-            Pointer<SideData<NDIM, double> > u_sc_current_data = u_current_data;
-            const bool is_cc_data = u_cc_current_data;
-            const bool is_sc_data = u_sc_current_data;
-            Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
-            Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
-
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            collectMarkersOnPatch(marks_current, patch->getPatchData(mark_current_idx));
+            collectMarkersOnPatch(marks_new, patch->getPatchData(mark_new_idx));
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(marks_current.size() == marks_new.size());
 #endif
-            // Collect the local marker positions at time n.
-            std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
+            const unsigned int num_patch_marks = static_cast<unsigned int>(marks_current.size());
+            if (num_patch_marks == 0) continue;
 
             // Compute U_mark(n) = u(X_mark(n),n).
-            std::vector<double> U_mark_current(X_mark_current.size());
-            if (is_cc_data)
-                LEInteractor::interpolate(
-                    U_mark_current, NDIM, X_mark_current, NDIM, u_cc_current_data, patch, patch_box, weighting_fcn);
-            if (is_sc_data)
-                LEInteractor::interpolate(
-                    U_mark_current, NDIM, X_mark_current, NDIM, u_sc_current_data, patch, patch_box, weighting_fcn);
+            collectMarkerPositions(X_mark, marks_current);
+            interpolateMarkerVelocities(U_mark, X_mark, u_current_idx, patch, weighting_fcn);
 
             // Compute X_mark(n+1) = X_mark(n) + dt*U_mark(n).
-            std::vector<double> X_mark_new(X_mark_current.size());
             for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
             {
-                X_mark_new[k] = X_mark_current[k] + dt * U_mark_current[k];
+                X_mark[k] += dt * U_mark[k];
             }
 
             // Prevent markers from leaving the computational domain through
             // physical boundaries (but *not* through periodic boundaries).
-            preventMarkerEscape(X_mark_new, hierarchy->getGridGeometry());
+            preventMarkerEscape(X_mark, hierarchy->getGridGeometry());
 
             // Store the local marker velocities at at time n, and the marker
             // positions at time n+1.
-            resetMarkerVelocitiesOnPatch(U_mark_current, mark_current_data);
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            resetMarkerVelocities(U_mark, marks_current);
+            resetMarkerPositions(X_mark, marks_new);
         }
     }
     return;
@@ -327,60 +327,48 @@ void LMarkerUtilities::midpointStep(const int mark_current_idx,
 {
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    std::vector<LMarker*> marks_current, marks_new;
+    std::vector<double> X_mark_current, X_mark, U_mark;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            Pointer<PatchData<NDIM> > u_half_data = patch->getPatchData(u_half_idx);
-            Pointer<CellData<NDIM, double> > u_cc_half_data = u_half_data;
-            Pointer<SideData<NDIM, double> > u_sc_half_data = u_half_data;
-            const bool is_cc_data = u_cc_half_data;
-            const bool is_sc_data = u_sc_half_data;
-            Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
-            Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
-
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            collectMarkersOnPatch(marks_current, patch->getPatchData(mark_current_idx));
+            collectMarkersOnPatch(marks_new, patch->getPatchData(mark_new_idx));
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(marks_current.size() == marks_new.size());
 #endif
+            const unsigned int num_patch_marks = static_cast<unsigned int>(marks_current.size());
+            if (num_patch_marks == 0) continue;
+
             // Collect the local marker positions at time n and predicted marker
             // positions at time n+1.
-            std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
-            std::vector<double> X_mark_new;
-            collectMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            collectMarkerPositions(X_mark_current, marks_current);
+            collectMarkerPositions(X_mark, marks_new);
 
             // Set X(n+1/2) = 0.5*(X(n)+X(n+1)).
-            std::vector<double> X_mark_half(NDIM * num_patch_marks);
             for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
             {
-                X_mark_half[k] = 0.5 * (X_mark_current[k] + X_mark_new[k]);
+                X_mark[k] = 0.5 * (X_mark_current[k] + X_mark[k]);
             }
 
-            // Compute U_mark(n+1/) = u(X_mark(n+1/2),n+1/2).
-            std::vector<double> U_mark_half(X_mark_half.size());
-            if (is_cc_data)
-                LEInteractor::interpolate(
-                    U_mark_half, NDIM, X_mark_half, NDIM, u_cc_half_data, patch, patch_box, weighting_fcn);
-            if (is_sc_data)
-                LEInteractor::interpolate(
-                    U_mark_half, NDIM, X_mark_half, NDIM, u_sc_half_data, patch, patch_box, weighting_fcn);
+            // Compute U_mark(n+1/2) = u(X_mark(n+1/2),n+1/2).
+            interpolateMarkerVelocities(U_mark, X_mark, u_half_idx, patch, weighting_fcn);
 
             // Compute X_mark(n+1) = X_mark(n) + dt*U_mark(n+1/2).
             for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
             {
-                X_mark_new[k] = X_mark_current[k] + dt * U_mark_half[k];
+                X_mark[k] = X_mark_current[k] + dt * U_mark[k];
             }
 
             // Prevent markers from leaving the computational domain through
             // physical boundaries (but *not* through periodic boundaries).
-            preventMarkerEscape(X_mark_new, hierarchy->getGridGeometry());
+            preventMarkerEscape(X_mark, hierarchy->getGridGeometry());
 
             // Store the local marker positions at time n+1.
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            resetMarkerPositions(X_mark, marks_new);
         }
     }
     return;
@@ -397,70 +385,191 @@ void LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
 {
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    std::vector<LMarker*> marks_current, marks_new;
+    std::vector<double> X_mark_current, U_mark_current, X_mark, U_mark;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            Pointer<PatchData<NDIM> > u_new_data = patch->getPatchData(u_new_idx);
-            Pointer<CellData<NDIM, double> > u_cc_new_data = u_new_data;
-            Pointer<SideData<NDIM, double> > u_sc_new_data = u_new_data;
-            const bool is_cc_data = u_cc_new_data;
-            const bool is_sc_data = u_sc_new_data;
-            Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
-            Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
-
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            collectMarkersOnPatch(marks_current, patch->getPatchData(mark_current_idx));
+            collectMarkersOnPatch(marks_new, patch->getPatchData(mark_new_idx));
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(marks_current.size() == marks_new.size());
 #endif
-            // Collect the local marker positions at time n and predicted marker
+            const unsigned int num_patch_marks = static_cast<unsigned int>(marks_current.size());
+            if (num_patch_marks == 0) continue;
+
+            // Collect the local marker positions and velocities at time n and
+            // the predicted marker positions at time n+1.
+            collectMarkerPositions(X_mark_current, marks_current);
+            collectMarkerVelocities(U_mark_current, marks_current);
+            collectMarkerPositions(X_mark, marks_new);
+
+            // Compute U_mark(n+1) = u(X_mark(n+1),n+1).
+            interpolateMarkerVelocities(U_mark, X_mark, u_new_idx, patch, weighting_fcn);
+
+            // Compute X_mark(n+1) = X_mark(n) + 0.5*dt*(U_mark(n)+U_mark(n+1)).
+            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+            {
+                X_mark[k] = X_mark_current[k] + 0.5 * dt * (U_mark_current[k] + U_mark[k]);
+            }
+
+            // Prevent markers from leaving the computational domain through
+            // physical boundaries (but *not* through periodic boundaries).
+            preventMarkerEscape(X_mark, hierarchy->getGridGeometry());
+
+            // Store the local marker velocities at at time n+1, and the marker
             // positions at time n+1.
-            std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
-            std::vector<double> X_mark_new;
-            collectMarkerPositionsOnPatch(X_mark_new, mark_new_data);
-
-            // Collect the local marker velocities at time n.
-            std::vector<double> U_mark_current;
-            collectMarkerVelocitiesOnPatch(U_mark_current, mark_current_data);
-
-            // Compute U_mark(n+1/) = u(X_mark(n+1/2),n+1/2).
-            std::vector<double> U_mark_new(X_mark_new.size());
-            if (is_cc_data)
-                LEInteractor::interpolate(
-                    U_mark_new, NDIM, X_mark_new, NDIM, u_cc_new_data, patch, patch_box, weighting_fcn);
-            if (is_sc_data)
-                LEInteractor::interpolate(
-                    U_mark_new, NDIM, X_mark_new, NDIM, u_sc_new_data, patch, patch_box, weighting_fcn);
-
-            // Set U(n+1/2) = 0.5*(U(n)+U(n+1)).
-            std::vector<double> U_mark_half(NDIM * num_patch_marks);
+            resetMarkerVelocities(U_mark, marks_new);
+            resetMarkerPositions(X_mark, marks_new);
+        }
+    }
+    return;
+} // trapezoidalStep
+
+void LMarkerUtilities::ssprk3Step(const int mark_current_idx,
+                                  const int mark_new_idx,
+                                  const int u_current_idx,
+                                  const int u_half_idx,
+                                  const int u_new_idx,
+                                  const double dt,
+                                  const std::string& weighting_fcn,
+                                  Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                  const int coarsest_ln_in,
+                                  const int finest_ln_in)
+{
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    std::vector<LMarker*> marks_current, marks_new;
+    std::vector<double> X_mark_current, U_mark_current, X_mark, U_mark;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            collectMarkersOnPatch(marks_current, patch->getPatchData(mark_current_idx));
+            collectMarkersOnPatch(marks_new, patch->getPatchData(mark_new_idx));
+#if !defined(NDEBUG)
+            TBOX_ASSERT(marks_current.size() == marks_new.size());
+#endif
+            const unsigned int num_patch_marks = static_cast<unsigned int>(marks_current.size());
+            if (num_patch_marks == 0) continue;
+            collectMarkerPositions(X_mark_current, marks_current);
+
+            // Stage 1: X(1) = X(n) + dt*u(X(n),n).
+            interpolateMarkerVelocities(U_mark_current, X_mark_current, u_current_idx, patch, weighting_fcn);
+            X_mark.resize(X_mark_current.size());
             for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
             {
-                U_mark_half[k] = 0.5 * (U_mark_current[k] + U_mark_new[k]);
+                X_mark[k] = X_mark_current[k] + dt * U_mark_current[k];
             }
+            preventMarkerEscape(X_mark, grid_geom);
 
-            // Compute X_mark(n+1) = X_mark(n) + dt*U_mark(n+1/2).
+            // Stage 2: X(2) = 3/4*X(n) + 1/4*(X(1) + dt*u(X(1),n+1)).
+            interpolateMarkerVelocities(U_mark, X_mark, u_new_idx, patch, weighting_fcn);
             for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
             {
-                X_mark_new[k] = X_mark_current[k] + dt * U_mark_half[k];
+                X_mark[k] = 0.75 * X_mark_current[k] + 0.25 * (X_mark[k] + dt * U_mark[k]);
             }
+            preventMarkerEscape(X_mark, grid_geom);
 
-            // Prevent markers from leaving the computational domain through
-            // physical boundaries (but *not* through periodic boundaries).
-            preventMarkerEscape(X_mark_new, hierarchy->getGridGeometry());
+            // Stage 3: X(n+1) = 1/3*X(n) + 2/3*(X(2) + dt*u(X(2),n+1/2)).
+            interpolateMarkerVelocities(U_mark, X_mark, u_half_idx, patch, weighting_fcn);
+            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+            {
+                X_mark[k] = (X_mark_current[k] + 2.0 * (X_mark[k] + dt * U_mark[k])) / 3.0;
+            }
+            preventMarkerEscape(X_mark, grid_geom);
 
-            // Store the local marker velocities at at time n, and the marker
+            // Store the local marker velocities at time n, and the marker
             // positions at time n+1.
-            resetMarkerVelocitiesOnPatch(U_mark_new, mark_new_data);
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            resetMarkerVelocities(U_mark_current, marks_current);
+            resetMarkerPositions(X_mark, marks_new);
         }
     }
     return;
-} // trapezoidalStep
+} // ssprk3Step
+
+void LMarkerUtilities::rk4Step(const int mark_current_idx,
+                               const int mark_new_idx,
+                               const int u_current_idx,
+                               const int u_half_idx,
+                               const int u_new_idx,
+                               const double dt,
+                               const std::string& weighting_fcn,
+                               Pointer<PatchHierarchy<NDIM> > hierarchy,
+                               const int coarsest_ln_in,
+                               const int finest_ln_in)
+{
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    std::vector<LMarker*> marks_current, marks_new;
+    std::vector<double> X_mark_current, U_mark_current, X_mark, U_mark, X_mark_new;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            collectMarkersOnPatch(marks_current, patch->getPatchData(mark_current_idx));
+            collectMarkersOnPatch(marks_new, patch->getPatchData(mark_new_idx));
+#if !defined(NDEBUG)
+            TBOX_ASSERT(marks_current.size() == marks_new.size());
+#endif
+            const unsigned int num_patch_marks = static_cast<unsigned int>(marks_current.size());
+            if (num_patch_marks == 0) continue;
+            collectMarkerPositions(X_mark_current, marks_current);
+            X_mark.resize(X_mark_current.size());
+            X_mark_new.resize(X_mark_current.size());
+
+            // k1 = u(X(n),n).
+            interpolateMarkerVelocities(U_mark_current, X_mark_current, u_current_idx, patch, weighting_fcn);
+            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+            {
+                X_mark_new[k] = X_mark_current[k] + dt * U_mark_current[k] / 6.0;
+                X_mark[k] = X_mark_current[k] + 0.5 * dt * U_mark_current[k];
+            }
+            preventMarkerEscape(X_mark, grid_geom);
+
+            // k2 = u(X(n)+dt/2*k1,n+1/2).
+            interpolateMarkerVelocities(U_mark, X_mark, u_half_idx, patch, weighting_fcn);
+            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+            {
+                X_mark_new[k] += dt * U_mark[k] / 3.0;
+                X_mark[k] = X_mark_current[k] + 0.5 * dt * U_mark[k];
+            }
+            preventMarkerEscape(X_mark, grid_geom);
+
+            // k3 = u(X(n)+dt/2*k2,n+1/2).
+            interpolateMarkerVelocities(U_mark, X_mark, u_half_idx, patch, weighting_fcn);
+            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+            {
+                X_mark_new[k] += dt * U_mark[k] / 3.0;
+                X_mark[k] = X_mark_current[k] + dt * U_mark[k];
+            }
+            preventMarkerEscape(X_mark, grid_geom);
+
+            // k4 = u(X(n)+dt*k3,n+1).
+            interpolateMarkerVelocities(U_mark, X_mark, u_new_idx, patch, weighting_fcn);
+            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+            {
+                X_mark_new[k] += dt * U_mark[k] / 6.0;
+            }
+            preventMarkerEscape(X_mark_new, grid_geom);
+
+            // Store the local marker velocities at time n, and the marker
+            // positions at time n+1.
+            resetMarkerVelocities(U_mark_current, marks_current);
+            resetMarkerPositions(X_mark_new, marks_new);
+        }
+    }
+    return;
+} // rk4Step
 
 void LMarkerUtilities::collectMarkersOnPatchHierarchy(const int mark_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
@@ -620,6 +729,185 @@ void LMarkerUtilities::collectMarkersOnPatchHierarchy(const int mark_idx, Pointe
     return;
 } // collectMarkersOnPatchHierarchy
 
+void LMarkerUtilities::beginMarkerRedistribution(std::vector<int>& mark_idxs,
+                                                 std::vector<double>& X_mark,
+                                                 std::vector<double>& U_mark,
+                                                 const int mark_idx,
+                                                 Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    mark_idxs.clear();
+    X_mark.clear();
+    U_mark.clear();
+
+    // Extract the markers owned by the local patches and remove all marker data
+    // (including any data in ghost cell regions) from the patch hierarchy.
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
+            for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox());
+                 it != mark_data->data_end();
+                 ++it)
+            {
+                const LMarkerSet::value_type& mark = *it;
+                const Point& X = mark->getPosition();
+                const Vector& U = mark->getVelocity();
+                mark_idxs.push_back(mark->getIndex());
+                X_mark.insert(X_mark.end(), X.data(), X.data() + NDIM);
+                U_mark.insert(U_mark.end(), U.data(), U.data() + NDIM);
+            }
+            mark_data->removeAllItems();
+        }
+    }
+
+    // Map the marker positions back into the computational domain along
+    // periodic directions.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift();
+    if (periodic_shift.max() > 0)
+    {
+        const double* const x_lower = grid_geom->getXLower();
+        const double* const x_upper = grid_geom->getXUpper();
+        for (unsigned int k = 0; k < mark_idxs.size(); ++k)
+        {
+            double* const X = &X_mark[NDIM * k];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (periodic_shift[d] == 0) continue;
+                const double L = x_upper[d] - x_lower[d];
+                X[d] = x_lower[d] + fmod(X[d] - x_lower[d], L);
+                if (X[d] < x_lower[d]) X[d] += L;
+                if (X[d] >= x_upper[d]) X[d] = x_lower[d];
+            }
+        }
+    }
+    return;
+} // beginMarkerRedistribution
+
+void LMarkerUtilities::endMarkerRedistribution(std::vector<int>& mark_idxs,
+                                               std::vector<double>& X_mark,
+                                               std::vector<double>& U_mark,
+                                               const int mark_idx,
+                                               Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(X_mark.size() == NDIM * mark_idxs.size());
+    TBOX_ASSERT(U_mark.size() == NDIM * mark_idxs.size());
+#endif
+    const unsigned int num_local_marks = static_cast<unsigned int>(mark_idxs.size());
+    const unsigned int num_marks =
+        static_cast<unsigned int>(SAMRAI_MPI::sumReduction(static_cast<int>(num_local_marks)));
+
+    // Determine the destination level, patch, and processor of each marker.  The
+    // destination level is the finest level of the patch hierarchy that covers
+    // the marker.
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const dx0 = grid_geom->getDx();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
+    std::vector<std::vector<double> > send_bufs(SAMRAI_MPI::getNodes());
+    for (unsigned int k = 0; k < num_local_marks; ++k)
+    {
+        const double* const X = &X_mark[NDIM * k];
+        int dst_ln = -1, dst_patch_num = -1;
+        for (int ln = finest_ln; ln >= 0 && dst_ln == -1; --ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            const Box<NDIM>& domain_box = level->getPhysicalDomain()[0];
+            const IntVector<NDIM>& ratio = level->getRatio();
+            double dx[NDIM];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                dx[d] = dx0[d] / static_cast<double>(ratio(d));
+            }
+            const Index<NDIM> i = IndexUtilities::getCellIndex(
+                X, domain_x_lower, domain_x_upper, dx, domain_box.lower(), domain_box.upper());
+            Array<int> indices;
+            level->getBoxTree()->findOverlapIndices(indices, Box<NDIM>(i, i));
+            if (indices.getSize() > 0)
+            {
+                dst_ln = ln;
+                dst_patch_num = indices[0];
+            }
+        }
+        if (dst_ln == -1)
+        {
+            TBOX_ERROR("LMarkerUtilities::endMarkerRedistribution()\n"
+                       << "  marker " << mark_idxs[k] << " is not located within the patch hierarchy\n");
+        }
+        const int dst_proc =
+            hierarchy->getPatchLevel(dst_ln)->getProcessorMapping().getProcessorAssignment(dst_patch_num);
+        std::vector<double>& send_buf = send_bufs[dst_proc];
+        send_buf.push_back(static_cast<double>(dst_ln));
+        send_buf.push_back(static_cast<double>(dst_patch_num));
+        send_buf.push_back(static_cast<double>(mark_idxs[k]));
+        send_buf.insert(send_buf.end(), X, X + NDIM);
+        send_buf.insert(send_buf.end(), &U_mark[NDIM * k], &U_mark[NDIM * k] + NDIM);
+    }
+    std::vector<int>().swap(mark_idxs);
+    std::vector<double>().swap(X_mark);
+    std::vector<double>().swap(U_mark);
+
+    // Send the markers to their new owners.
+    std::map<int, std::vector<double> > recv_bufs;
+    SparseExchange::exchange(send_bufs, recv_bufs, MARKER_REDISTRIBUTION_TAG);
+    std::vector<std::vector<double> >().swap(send_bufs);
+    std::vector<double> recv_buf;
+    for (std::map<int, std::vector<double> >::const_iterator it = recv_bufs.begin(); it != recv_bufs.end(); ++it)
+    {
+        recv_buf.insert(recv_buf.end(), it->second.begin(), it->second.end());
+    }
+    std::map<int, std::vector<double> >().swap(recv_bufs);
+
+    // Insert the received markers into the patch hierarchy.
+    const size_t num_recv_marks = recv_buf.size() / MARKER_RECORD_SIZE;
+    for (size_t k = 0; k < num_recv_marks; ++k)
+    {
+        const double* const rec = &recv_buf[MARKER_RECORD_SIZE * k];
+        const int ln = static_cast<int>(rec[0]);
+        const int patch_num = static_cast<int>(rec[1]);
+        Point X;
+        Vector U;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = rec[3 + d];
+            U[d] = rec[3 + NDIM + d];
+        }
+        Pointer<Patch<NDIM> > patch = hierarchy->getPatchLevel(ln)->getPatch(patch_num);
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const Index<NDIM> i = IndexUtilities::getCellIndex(X,
+                                                           patch_geom->getXLower(),
+                                                           patch_geom->getXUpper(),
+                                                           patch_geom->getDx(),
+                                                           patch_box.lower(),
+                                                           patch_box.upper());
+        Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
+        if (!mark_data->isElement(i))
+        {
+            mark_data->appendItemPointer(i, new LMarkerSet());
+        }
+        LMarkerSet& mark_set = *(mark_data->getItem(i));
+        mark_set.push_back(new LMarker(static_cast<int>(rec[2]), X, U));
+    }
+
+    // Ensure that the total number of markers is correct.
+    const unsigned int num_marks_after_redistribution = countMarkers(mark_idx, hierarchy);
+    if (num_marks != num_marks_after_redistribution)
+    {
+        TBOX_ERROR("LMarkerUtilities::endMarkerRedistribution()\n"
+                   << "  number of marker particles changed during redistribution\n"
+                   << "  number of markers before redistribution = " << num_marks << "\n"
+                   << "  number of markers after  redistribution = " << num_marks_after_redistribution << "\n");
+    }
+    return;
+} // endMarkerRedistribution
+
 void LMarkerUtilities::initializeMarkersOnLevel(const int mark_idx,
                                                 const std::vector<Point>& mark_init_posns,
                                                 const Pointer<PatchHierarchy<NDIM> > hierarchy,
@@ -771,72 +1059,87 @@ unsigned int LMarkerUtilities::countMarkersOnPatch(Pointer<LMarkerSetData> mark_
     return num_marks;
 } // countMarkersOnPatch
 
-void LMarkerUtilities::collectMarkerPositionsOnPatch(std::vector<double>& X_mark, Pointer<LMarkerSetData> mark_data)
+void LMarkerUtilities::collectMarkersOnPatch(std::vector<LMarker*>& marks, Pointer<LMarkerSetData> mark_data)
 {
-    X_mark.resize(NDIM * countMarkersOnPatch(mark_data));
-    unsigned int k = 0;
+    marks.clear();
     for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
+         ++it)
     {
-        const LMarkerSet::value_type& mark = *it;
-        const Point& X = mark->getPosition();
+        marks.push_back((*it).getPointer());
+    }
+    return;
+} // collectMarkersOnPatch
+
+void LMarkerUtilities::collectMarkerPositions(std::vector<double>& X_mark, const std::vector<LMarker*>& marks)
+{
+    X_mark.resize(NDIM * marks.size());
+    for (unsigned int k = 0; k < marks.size(); ++k)
+    {
+        const Point& X = marks[k]->getPosition();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             X_mark[NDIM * k + d] = X[d];
         }
     }
     return;
-} // collectMarkerPositionsOnPatch
+} // collectMarkerPositions
 
-void LMarkerUtilities::resetMarkerPositionsOnPatch(const std::vector<double>& X_mark, Pointer<LMarkerSetData> mark_data)
+void LMarkerUtilities::resetMarkerPositions(const std::vector<double>& X_mark, const std::vector<LMarker*>& marks)
 {
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
+    for (unsigned int k = 0; k < marks.size(); ++k)
     {
-        const LMarkerSet::value_type& mark = *it;
-        Point& X = mark->getPosition();
+        Point& X = marks[k]->getPosition();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             X[d] = X_mark[NDIM * k + d];
         }
     }
     return;
-} // resetMarkerPositionsOnPatch
+} // resetMarkerPositions
 
-void LMarkerUtilities::collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark, Pointer<LMarkerSetData> mark_data)
+void LMarkerUtilities::collectMarkerVelocities(std::vector<double>& U_mark, const std::vector<LMarker*>& marks)
 {
-    U_mark.resize(NDIM * countMarkersOnPatch(mark_data));
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
+    U_mark.resize(NDIM * marks.size());
+    for (unsigned int k = 0; k < marks.size(); ++k)
     {
-        const LMarkerSet::value_type& mark = *it;
-        const Vector& U = mark->getVelocity();
+        const Vector& U = marks[k]->getVelocity();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             U_mark[NDIM * k + d] = U[d];
         }
     }
     return;
-} // collectMarkerVelocitiesOnPatch
+} // collectMarkerVelocities
 
-void LMarkerUtilities::resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark,
-                                                    Pointer<LMarkerSetData> mark_data)
+void LMarkerUtilities::resetMarkerVelocities(const std::vector<double>& U_mark, const std::vector<LMarker*>& marks)
 {
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
+    for (unsigned int k = 0; k < marks.size(); ++k)
     {
-        const LMarkerSet::value_type& mark = *it;
-        Vector& U = mark->getVelocity();
+        Vector& U = marks[k]->getVelocity();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             U[d] = U_mark[NDIM * k + d];
         }
     }
     return;
-} // resetMarkerVelocitiesOnPatch
+} // resetMarkerVelocities
+
+void LMarkerUtilities::interpolateMarkerVelocities(std::vector<double>& U_mark,
+                                                   const std::vector<double>& X_mark,
+                                                   const int u_idx,
+                                                   Pointer<Patch<NDIM> > patch,
+                                                   const std::string& weighting_fcn)
+{
+    U_mark.resize(X_mark.size());
+    Pointer<PatchData<NDIM> > u_data = patch->getPatchData(u_idx);
+    Pointer<CellData<NDIM, double> > u_cc_data = u_data;
+    Pointer<SideData<NDIM, double> > u_sc_data = u_data;
+    if (u_cc_data)
+        LEInteractor::interpolate(U_mark, NDIM, X_mark, NDIM, u_cc_data, patch, patch->getBox(), weighting_fcn);
+    if (u_sc_data)
+        LEInteractor::interpolate(U_mark, NDIM, X_mark, NDIM, u_sc_data, patch, patch->getBox(), weighting_fcn);
+    return;
+} // interpolateMarkerVelocities
 
 void LMarkerUtilities::preventMarkerEscape(std::vector<double>& X_mark, Pointer<CartesianGridGeometry<NDIM> > grid_geom)
 {
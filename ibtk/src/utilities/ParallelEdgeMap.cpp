@@ -39,6 +39,7 @@
 #include <vector>
 
 #include "ibtk/ParallelEdgeMap.h"
+#include "ibtk/SparseExchange.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
@@ -49,9 +50,35 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Tag used for messages sent when the edge map is stored in distributed form.
+static const int PARALLEL_EDGE_MAP_TAG = 0x5045;
+
+// Remove the specified link from the edge map.  Returns true if the link was
+// found.
+bool remove_link(std::multimap<int, std::pair<int, int> >& edge_map,
+                 const int mastr_idx,
+                 const std::pair<int, int>& link)
+{
+    typedef std::multimap<int, std::pair<int, int> >::iterator multimap_iterator;
+    std::pair<multimap_iterator, multimap_iterator> range = edge_map.equal_range(mastr_idx);
+    for (multimap_iterator it = range.first; it != range.second; ++it)
+    {
+        if (it->second == link)
+        {
+            edge_map.erase(it);
+            return true;
+        }
+    }
+    return false;
+} // remove_link
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-ParallelEdgeMap::ParallelEdgeMap() : d_edge_map(), d_pending_additions(), d_pending_removals()
+ParallelEdgeMap::ParallelEdgeMap(const bool use_distributed_storage)
+    : d_use_distributed_storage(use_distributed_storage), d_edge_map(), d_pending_additions(), d_pending_removals()
 {
     // intentionally blank
     return;
@@ -91,6 +118,12 @@ void ParallelEdgeMap::removeEdge(const std::pair<int, int>& link, int mastr_idx)
 
 void ParallelEdgeMap::communicateData()
 {
+    if (d_use_distributed_storage)
+    {
+        communicateDistributedData();
+        return;
+    }
+
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
 
@@ -132,6 +165,10 @@ void ParallelEdgeMap::communicateData()
     }
     SAMRAI_MPI::sumReduction(&transactions[0], SIZE * num_transactions);
 
+    // The pending transactions now include those registered on all processes,
+    // including the present process.
+    d_pending_additions.clear();
+    d_pending_removals.clear();
     offset = 0;
     for (int k = 0; k < size; ++k)
     {
@@ -153,53 +190,20 @@ void ParallelEdgeMap::communicateData()
         }
     }
 
-    typedef std::multimap<int, std::pair<int, int> >::iterator multimap_iterator;
     typedef std::multimap<int, std::pair<int, int> >::const_iterator multimap_const_iterator;
     for (multimap_const_iterator cit = d_pending_additions.begin(); cit != d_pending_additions.end(); ++cit)
     {
         d_edge_map.insert(std::make_pair(cit->first, cit->second));
     }
 
-    typedef std::multimap<int, std::pair<int, int> >::const_iterator multimap_const_iterator;
     for (multimap_const_iterator cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit)
     {
-        int mastr_idx = cit->first;
+        const int mastr_idx = cit->first;
         const std::pair<int, int>& link = cit->second;
-
-        bool found_link = false;
-
-        std::pair<multimap_iterator, multimap_iterator> range = d_edge_map.equal_range(mastr_idx);
-        for (multimap_iterator it = range.first; it != range.second && !found_link; ++it)
-        {
-            if (it->second == link)
-            {
-                found_link = true;
-                d_edge_map.erase(it);
-            }
-        }
-
-        if (!found_link)
+        if (!remove_link(d_edge_map, mastr_idx, link))
         {
-            const int idx1 = link.first;
-            const int idx2 = link.second;
-            if (mastr_idx == idx1)
-            {
-                mastr_idx = idx2;
-            }
-            else
-            {
-                mastr_idx = idx1;
-            }
-
-            std::pair<multimap_iterator, multimap_iterator> range = d_edge_map.equal_range(mastr_idx);
-            for (multimap_iterator it = range.first; it != range.second && !found_link; ++it)
-            {
-                if (it->second == link)
-                {
-                    found_link = true;
-                    d_edge_map.erase(it);
-                }
-            }
+            const int other_idx = (mastr_idx == link.first ? link.second : link.first);
+            remove_link(d_edge_map, other_idx, link);
         }
     }
 
@@ -213,8 +217,166 @@ const std::multimap<int, std::pair<int, int> >& ParallelEdgeMap::getEdgeMap() co
     return d_edge_map;
 } // getEdgeMap
 
+bool ParallelEdgeMap::usesDistributedStorage() const
+{
+    return d_use_distributed_storage;
+} // usesDistributedStorage
+
+int ParallelEdgeMap::getOwnerRank(const int mastr_idx) const
+{
+    // Use a multiplicative hash so that runs of consecutive indices are spread
+    // across all of the processes.
+    const unsigned int hash = static_cast<unsigned int>(mastr_idx) * 2654435761U;
+    return static_cast<int>(hash % static_cast<unsigned int>(SAMRAI_MPI::getNodes()));
+} // getOwnerRank
+
+void ParallelEdgeMap::findEdges(std::multimap<int, std::pair<int, int> >& edges,
+                                const std::vector<int>& mastr_idxs) const
+{
+    typedef std::multimap<int, std::pair<int, int> >::const_iterator multimap_const_iterator;
+    edges.clear();
+    if (!d_use_distributed_storage)
+    {
+        for (std::vector<int>::const_iterator cit = mastr_idxs.begin(); cit != mastr_idxs.end(); ++cit)
+        {
+            if (edges.count(*cit)) continue;
+            std::pair<multimap_const_iterator, multimap_const_iterator> range = d_edge_map.equal_range(*cit);
+            edges.insert(range.first, range.second);
+        }
+        return;
+    }
+
+    // Send the requested master indices to the owning processes.
+    const int size = SAMRAI_MPI::getNodes();
+    std::vector<std::vector<int> > request_bufs(size);
+    for (std::vector<int>::const_iterator cit = mastr_idxs.begin(); cit != mastr_idxs.end(); ++cit)
+    {
+        request_bufs[getOwnerRank(*cit)].push_back(*cit);
+    }
+    std::map<int, std::vector<int> > requests_received;
+    SparseExchange::exchange(request_bufs, requests_received, PARALLEL_EDGE_MAP_TAG);
+
+    // Reply with the links associated with the requested master indices.  Each
+    // link is communicated as its master index and its two vertex indices.
+    static const int SIZE = 3;
+    std::vector<std::vector<int> > reply_bufs(size);
+    for (std::map<int, std::vector<int> >::const_iterator cit = requests_received.begin();
+         cit != requests_received.end();
+         ++cit)
+    {
+        std::vector<int> request = cit->second;
+        std::sort(request.begin(), request.end());
+        request.erase(std::unique(request.begin(), request.end()), request.end());
+        std::vector<int>& reply_buf = reply_bufs[cit->first];
+        for (unsigned int k = 0; k < request.size(); ++k)
+        {
+            std::pair<multimap_const_iterator, multimap_const_iterator> range = d_edge_map.equal_range(request[k]);
+            for (multimap_const_iterator it = range.first; it != range.second; ++it)
+            {
+                reply_buf.push_back(it->first);
+                reply_buf.push_back(it->second.first);
+                reply_buf.push_back(it->second.second);
+            }
+        }
+    }
+    std::map<int, std::vector<int> > replies_received;
+    SparseExchange::exchange(reply_bufs, replies_received, PARALLEL_EDGE_MAP_TAG);
+    for (std::map<int, std::vector<int> >::const_iterator cit = replies_received.begin();
+         cit != replies_received.end();
+         ++cit)
+    {
+        const std::vector<int>& reply = cit->second;
+        for (unsigned int k = 0; k < reply.size(); k += SIZE)
+        {
+            edges.insert(std::make_pair(reply[k], std::make_pair(reply[k + 1], reply[k + 2])));
+        }
+    }
+    return;
+} // findEdges
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void ParallelEdgeMap::communicateDistributedData()
+{
+    const int size = SAMRAI_MPI::getNodes();
+
+    // Send each pending transaction to the process that owns the master index
+    // of the link.  Each transaction consists of the master index, the two
+    // vertex indices, and a flag indicating whether the link is to be added to
+    // or removed from the edge map.
+    static const int SIZE = 4;
+    std::vector<std::vector<int> > send_bufs(size);
+    for (std::multimap<int, std::pair<int, int> >::const_iterator cit = d_pending_additions.begin();
+         cit != d_pending_additions.end();
+         ++cit)
+    {
+        std::vector<int>& send_buf = send_bufs[getOwnerRank(cit->first)];
+        send_buf.push_back(cit->first);
+        send_buf.push_back(cit->second.first);
+        send_buf.push_back(cit->second.second);
+        send_buf.push_back(1);
+    }
+    for (std::multimap<int, std::pair<int, int> >::const_iterator cit = d_pending_removals.begin();
+         cit != d_pending_removals.end();
+         ++cit)
+    {
+        std::vector<int>& send_buf = send_bufs[getOwnerRank(cit->first)];
+        send_buf.push_back(cit->first);
+        send_buf.push_back(cit->second.first);
+        send_buf.push_back(cit->second.second);
+        send_buf.push_back(0);
+    }
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+    std::map<int, std::vector<int> > recv_bufs;
+    SparseExchange::exchange(send_bufs, recv_bufs, PARALLEL_EDGE_MAP_TAG);
+
+    // As in the replicated case, all additions are processed before any
+    // removals.
+    typedef std::map<int, std::vector<int> >::const_iterator recv_bufs_const_iterator;
+    for (recv_bufs_const_iterator cit = recv_bufs.begin(); cit != recv_bufs.end(); ++cit)
+    {
+        const std::vector<int>& recv_buf = cit->second;
+        for (unsigned int k = 0; k < recv_buf.size(); k += SIZE)
+        {
+            if (!recv_buf[k + 3]) continue;
+            d_edge_map.insert(std::make_pair(recv_buf[k], std::make_pair(recv_buf[k + 1], recv_buf[k + 2])));
+        }
+    }
+
+    // Links that are not found under the specified master index are looked up
+    // under the other vertex of the link, which may be owned by a different
+    // process.
+    std::vector<std::vector<int> > forward_bufs(size);
+    for (recv_bufs_const_iterator cit = recv_bufs.begin(); cit != recv_bufs.end(); ++cit)
+    {
+        const std::vector<int>& recv_buf = cit->second;
+        for (unsigned int k = 0; k < recv_buf.size(); k += SIZE)
+        {
+            if (recv_buf[k + 3]) continue;
+            const int mastr_idx = recv_buf[k];
+            const std::pair<int, int> link = std::make_pair(recv_buf[k + 1], recv_buf[k + 2]);
+            if (remove_link(d_edge_map, mastr_idx, link)) continue;
+            const int other_idx = (mastr_idx == link.first ? link.second : link.first);
+            std::vector<int>& forward_buf = forward_bufs[getOwnerRank(other_idx)];
+            forward_buf.push_back(other_idx);
+            forward_buf.push_back(link.first);
+            forward_buf.push_back(link.second);
+        }
+    }
+    std::map<int, std::vector<int> > forwarded_bufs;
+    SparseExchange::exchange(forward_bufs, forwarded_bufs, PARALLEL_EDGE_MAP_TAG);
+    for (recv_bufs_const_iterator cit = forwarded_bufs.begin(); cit != forwarded_bufs.end(); ++cit)
+    {
+        const std::vector<int>& forwarded_buf = cit->second;
+        for (unsigned int k = 0; k < forwarded_buf.size(); k += SIZE - 1)
+        {
+            remove_link(d_edge_map, forwarded_buf[k], std::make_pair(forwarded_buf[k + 1], forwarded_buf[k + 2]));
+        }
+    }
+    return;
+} // communicateDistributedData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
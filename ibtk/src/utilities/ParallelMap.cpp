@@ -42,6 +42,7 @@
 #include "ibtk/ParallelMap.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableManager.h"
+#include "ibtk/SparseExchange.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/AbstractStream.h"
 #include "tbox/Pointer.h"
@@ -54,16 +55,71 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Tag used for messages sent when the map is stored in distributed form.
+static const int PARALLEL_MAP_TAG = 0x504d;
+
+// Pack a collection of keys and data items to be added and keys to be removed
+// into a character buffer.
+void pack_transactions(std::vector<char>& buf,
+                       const std::vector<int>& added_keys,
+                       std::vector<tbox::Pointer<Streamable> >& added_items,
+                       const std::vector<int>& removed_keys)
+{
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+    const int num_added = static_cast<int>(added_keys.size());
+    const int num_removed = static_cast<int>(removed_keys.size());
+    const size_t data_sz = tbox::AbstractStream::sizeofInt() * (2 + num_added + num_removed) +
+                           streamable_manager->getDataStreamSize(added_items);
+    FixedSizedStream stream(static_cast<int>(data_sz));
+    stream.pack(&num_added, 1);
+    if (num_added > 0) stream.pack(&added_keys[0], num_added);
+    stream.pack(&num_removed, 1);
+    if (num_removed > 0) stream.pack(&removed_keys[0], num_removed);
+    streamable_manager->packStream(stream, added_items);
+    const char* const buf_start = static_cast<const char*>(stream.getBufferStart());
+    buf.assign(buf_start, buf_start + stream.getCurrentSize());
+    return;
+} // pack_transactions
+
+// Unpack a collection of keys and data items to be added and keys to be removed
+// from a character buffer.
+void unpack_transactions(const std::vector<char>& buf,
+                         std::vector<int>& added_keys,
+                         std::vector<tbox::Pointer<Streamable> >& added_items,
+                         std::vector<int>& removed_keys)
+{
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+    FixedSizedStream stream(&buf[0], static_cast<int>(buf.size()));
+    int num_added, num_removed;
+    stream.unpack(&num_added, 1);
+    added_keys.resize(num_added);
+    if (num_added > 0) stream.unpack(&added_keys[0], num_added);
+    stream.unpack(&num_removed, 1);
+    removed_keys.resize(num_removed);
+    if (num_removed > 0) stream.unpack(&removed_keys[0], num_removed);
+    hier::IntVector<NDIM> offset = 0;
+    streamable_manager->unpackStream(stream, offset, added_items);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(added_keys.size() == added_items.size());
+#endif
+    return;
+} // unpack_transactions
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-ParallelMap::ParallelMap() : d_map(), d_pending_additions(), d_pending_removals()
+ParallelMap::ParallelMap(const bool use_distributed_storage)
+    : d_use_distributed_storage(use_distributed_storage), d_map(), d_pending_additions(), d_pending_removals()
 {
     // intentionally blank
     return;
 } // ParallelMap
 
 ParallelMap::ParallelMap(const ParallelMap& from)
-    : d_map(from.d_map), d_pending_additions(from.d_pending_additions), d_pending_removals(from.d_pending_removals)
+    : d_use_distributed_storage(from.d_use_distributed_storage), d_map(from.d_map),
+      d_pending_additions(from.d_pending_additions), d_pending_removals(from.d_pending_removals)
 {
     // intentionally blank
     return;
@@ -79,6 +135,7 @@ ParallelMap& ParallelMap::operator=(const ParallelMap& that)
 {
     if (this != &that)
     {
+        d_use_distributed_storage = that.d_use_distributed_storage;
         d_map = that.d_map;
         d_pending_additions = that.d_pending_additions;
         d_pending_removals = that.d_pending_removals;
@@ -100,6 +157,12 @@ void ParallelMap::removeItem(const int key)
 
 void ParallelMap::communicateData()
 {
+    if (d_use_distributed_storage)
+    {
+        communicateDistributedData();
+        return;
+    }
+
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
 
@@ -230,8 +293,141 @@ const std::map<int, SAMRAI::tbox::Pointer<Streamable> >& ParallelMap::getMap() c
     return d_map;
 } // getMap
 
+bool ParallelMap::usesDistributedStorage() const
+{
+    return d_use_distributed_storage;
+} // usesDistributedStorage
+
+int ParallelMap::getOwnerRank(const int key) const
+{
+    // Use a multiplicative hash so that runs of consecutive keys are spread
+    // across all of the processes.
+    const unsigned int hash = static_cast<unsigned int>(key) * 2654435761U;
+    return static_cast<int>(hash % static_cast<unsigned int>(SAMRAI_MPI::getNodes()));
+} // getOwnerRank
+
+void ParallelMap::findItems(std::map<int, SAMRAI::tbox::Pointer<Streamable> >& items,
+                            const std::vector<int>& keys) const
+{
+    typedef std::map<int, tbox::Pointer<Streamable> >::const_iterator map_const_iterator;
+    items.clear();
+    if (!d_use_distributed_storage)
+    {
+        for (std::vector<int>::const_iterator cit = keys.begin(); cit != keys.end(); ++cit)
+        {
+            map_const_iterator map_cit = d_map.find(*cit);
+            if (map_cit != d_map.end()) items.insert(*map_cit);
+        }
+        return;
+    }
+
+    // Send the requested keys to the owning processes.
+    const int size = SAMRAI_MPI::getNodes();
+    const std::vector<int> no_keys;
+    std::vector<tbox::Pointer<Streamable> > no_items;
+    std::vector<std::vector<int> > requested_keys(size);
+    for (std::vector<int>::const_iterator cit = keys.begin(); cit != keys.end(); ++cit)
+    {
+        requested_keys[getOwnerRank(*cit)].push_back(*cit);
+    }
+    std::vector<std::vector<char> > request_bufs(size);
+    for (int k = 0; k < size; ++k)
+    {
+        if (!requested_keys[k].empty()) pack_transactions(request_bufs[k], requested_keys[k], no_items, no_keys);
+    }
+    std::map<int, std::vector<char> > requests_received;
+    SparseExchange::exchange(request_bufs, requests_received, PARALLEL_MAP_TAG);
+
+    // Reply with those requested items that are in the locally owned part of
+    // the map.
+    std::vector<std::vector<char> > reply_bufs(size);
+    std::vector<int> found_keys, unused_keys;
+    std::vector<tbox::Pointer<Streamable> > found_items, unused_items;
+    for (std::map<int, std::vector<char> >::const_iterator cit = requests_received.begin();
+         cit != requests_received.end();
+         ++cit)
+    {
+        std::vector<int> request;
+        unpack_transactions(cit->second, request, unused_items, unused_keys);
+        found_keys.clear();
+        found_items.clear();
+        for (unsigned int k = 0; k < request.size(); ++k)
+        {
+            map_const_iterator map_cit = d_map.find(request[k]);
+            if (map_cit == d_map.end()) continue;
+            found_keys.push_back(map_cit->first);
+            found_items.push_back(map_cit->second);
+        }
+        if (!found_keys.empty()) pack_transactions(reply_bufs[cit->first], found_keys, found_items, no_keys);
+    }
+    std::map<int, std::vector<char> > replies_received;
+    SparseExchange::exchange(reply_bufs, replies_received, PARALLEL_MAP_TAG);
+    for (std::map<int, std::vector<char> >::const_iterator cit = replies_received.begin();
+         cit != replies_received.end();
+         ++cit)
+    {
+        unpack_transactions(cit->second, found_keys, found_items, unused_keys);
+        for (unsigned int k = 0; k < found_keys.size(); ++k)
+        {
+            items[found_keys[k]] = found_items[k];
+        }
+    }
+    return;
+} // findItems
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void ParallelMap::communicateDistributedData()
+{
+    const int size = SAMRAI_MPI::getNodes();
+
+    // Send each pending transaction to the process that owns the corresponding
+    // key.
+    std::vector<std::vector<int> > added_keys(size), removed_keys(size);
+    std::vector<std::vector<tbox::Pointer<Streamable> > > added_items(size);
+    for (std::map<int, tbox::Pointer<Streamable> >::const_iterator cit = d_pending_additions.begin();
+         cit != d_pending_additions.end();
+         ++cit)
+    {
+        const int owner_rank = getOwnerRank(cit->first);
+        added_keys[owner_rank].push_back(cit->first);
+        added_items[owner_rank].push_back(cit->second);
+    }
+    for (std::vector<int>::const_iterator cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit)
+    {
+        removed_keys[getOwnerRank(*cit)].push_back(*cit);
+    }
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+    std::vector<std::vector<char> > send_bufs(size);
+    for (int k = 0; k < size; ++k)
+    {
+        if (added_keys[k].empty() && removed_keys[k].empty()) continue;
+        pack_transactions(send_bufs[k], added_keys[k], added_items[k], removed_keys[k]);
+    }
+    std::map<int, std::vector<char> > recv_bufs;
+    SparseExchange::exchange(send_bufs, recv_bufs, PARALLEL_MAP_TAG);
+
+    // As in the replicated case, the additions are processed in order of the
+    // sending process, and all additions are processed before any removals.
+    std::vector<int> keys, keys_to_remove, recv_removed_keys;
+    std::vector<tbox::Pointer<Streamable> > items;
+    for (std::map<int, std::vector<char> >::const_iterator cit = recv_bufs.begin(); cit != recv_bufs.end(); ++cit)
+    {
+        unpack_transactions(cit->second, keys, items, recv_removed_keys);
+        for (unsigned int k = 0; k < keys.size(); ++k)
+        {
+            d_map[keys[k]] = items[k];
+        }
+        keys_to_remove.insert(keys_to_remove.end(), recv_removed_keys.begin(), recv_removed_keys.end());
+    }
+    for (std::vector<int>::const_iterator cit = keys_to_remove.begin(); cit != keys_to_remove.end(); ++cit)
+    {
+        d_map.erase(*cit);
+    }
+    return;
+} // communicateDistributedData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -32,11 +32,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <ostream>
 #include <set>
 #include <vector>
 
 #include "ibtk/ParallelSet.h"
+#include "ibtk/SparseExchange.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
@@ -47,16 +49,24 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Tag used for messages sent when the set is stored in distributed form.
+static const int PARALLEL_SET_TAG = 0x5053;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-ParallelSet::ParallelSet() : d_set(), d_pending_additions(), d_pending_removals()
+ParallelSet::ParallelSet(const bool use_distributed_storage)
+    : d_use_distributed_storage(use_distributed_storage), d_set(), d_pending_additions(), d_pending_removals()
 {
     // intentionally blank
     return;
 } // ParallelSet
 
 ParallelSet::ParallelSet(const ParallelSet& from)
-    : d_set(from.d_set), d_pending_additions(from.d_pending_additions), d_pending_removals(from.d_pending_removals)
+    : d_use_distributed_storage(from.d_use_distributed_storage), d_set(from.d_set),
+      d_pending_additions(from.d_pending_additions), d_pending_removals(from.d_pending_removals)
 {
     // intentionally blank
     return;
@@ -72,6 +82,7 @@ ParallelSet& ParallelSet::operator=(const ParallelSet& that)
 {
     if (this != &that)
     {
+        d_use_distributed_storage = that.d_use_distributed_storage;
         d_set = that.d_set;
         d_pending_additions = that.d_pending_additions;
         d_pending_removals = that.d_pending_removals;
@@ -93,6 +104,12 @@ void ParallelSet::removeItem(const int key)
 
 void ParallelSet::communicateData()
 {
+    if (d_use_distributed_storage)
+    {
+        communicateDistributedData();
+        return;
+    }
+
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
 
@@ -187,8 +204,115 @@ const std::set<int>& ParallelSet::getSet() const
     return d_set;
 } // getSet
 
+bool ParallelSet::usesDistributedStorage() const
+{
+    return d_use_distributed_storage;
+} // usesDistributedStorage
+
+int ParallelSet::getOwnerRank(const int key) const
+{
+    // Use a multiplicative hash so that runs of consecutive keys are spread
+    // across all of the processes.
+    const unsigned int hash = static_cast<unsigned int>(key) * 2654435761U;
+    return static_cast<int>(hash % static_cast<unsigned int>(SAMRAI_MPI::getNodes()));
+} // getOwnerRank
+
+void ParallelSet::findItems(std::set<int>& found_keys, const std::vector<int>& keys) const
+{
+    found_keys.clear();
+    if (!d_use_distributed_storage)
+    {
+        for (std::vector<int>::const_iterator cit = keys.begin(); cit != keys.end(); ++cit)
+        {
+            if (d_set.count(*cit)) found_keys.insert(*cit);
+        }
+        return;
+    }
+
+    // Send the requested keys to the owning processes.
+    const int size = SAMRAI_MPI::getNodes();
+    std::vector<std::vector<int> > request_bufs(size);
+    for (std::vector<int>::const_iterator cit = keys.begin(); cit != keys.end(); ++cit)
+    {
+        request_bufs[getOwnerRank(*cit)].push_back(*cit);
+    }
+    std::map<int, std::vector<int> > requests_received;
+    SparseExchange::exchange(request_bufs, requests_received, PARALLEL_SET_TAG);
+
+    // Reply with those requested keys that are in the locally owned part of the
+    // set.
+    std::vector<std::vector<int> > reply_bufs(size);
+    for (std::map<int, std::vector<int> >::const_iterator cit = requests_received.begin();
+         cit != requests_received.end();
+         ++cit)
+    {
+        const std::vector<int>& requested_keys = cit->second;
+        for (unsigned int k = 0; k < requested_keys.size(); ++k)
+        {
+            if (d_set.count(requested_keys[k])) reply_bufs[cit->first].push_back(requested_keys[k]);
+        }
+    }
+    std::map<int, std::vector<int> > replies_received;
+    SparseExchange::exchange(reply_bufs, replies_received, PARALLEL_SET_TAG);
+    for (std::map<int, std::vector<int> >::const_iterator cit = replies_received.begin();
+         cit != replies_received.end();
+         ++cit)
+    {
+        found_keys.insert(cit->second.begin(), cit->second.end());
+    }
+    return;
+} // findItems
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void ParallelSet::communicateDistributedData()
+{
+    const int size = SAMRAI_MPI::getNodes();
+
+    // Send each pending transaction to the process that owns the corresponding
+    // key.  Each transaction consists of the key and a flag indicating whether
+    // the key is to be added to or removed from the set.
+    static const int SIZE = 2;
+    std::vector<std::vector<int> > send_bufs(size);
+    for (std::vector<int>::const_iterator cit = d_pending_additions.begin(); cit != d_pending_additions.end(); ++cit)
+    {
+        std::vector<int>& send_buf = send_bufs[getOwnerRank(*cit)];
+        send_buf.push_back(*cit);
+        send_buf.push_back(1);
+    }
+    for (std::vector<int>::const_iterator cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit)
+    {
+        std::vector<int>& send_buf = send_bufs[getOwnerRank(*cit)];
+        send_buf.push_back(*cit);
+        send_buf.push_back(0);
+    }
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+    std::map<int, std::vector<int> > recv_bufs;
+    SparseExchange::exchange(send_bufs, recv_bufs, PARALLEL_SET_TAG);
+
+    // As in the replicated case, all additions are processed before any
+    // removals.
+    typedef std::map<int, std::vector<int> >::const_iterator recv_bufs_const_iterator;
+    for (recv_bufs_const_iterator cit = recv_bufs.begin(); cit != recv_bufs.end(); ++cit)
+    {
+        const std::vector<int>& recv_buf = cit->second;
+        for (unsigned int k = 0; k < recv_buf.size(); k += SIZE)
+        {
+            if (recv_buf[k + 1]) d_set.insert(recv_buf[k]);
+        }
+    }
+    for (recv_bufs_const_iterator cit = recv_bufs.begin(); cit != recv_bufs.end(); ++cit)
+    {
+        const std::vector<int>& recv_buf = cit->second;
+        for (unsigned int k = 0; k < recv_buf.size(); k += SIZE)
+        {
+            if (!recv_buf[k + 1]) d_set.erase(recv_buf[k]);
+        }
+    }
+    return;
+} // communicateDistributedData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -0,0 +1,128 @@
+// Filename: PatchTaskList.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "Box.h"
+#include "Patch.h"
+#include "PatchLevel.h"
+#include "ibtk/PatchTaskList.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+struct PatchSizeComp : std::binary_function<Pointer<Patch<NDIM> >, Pointer<Patch<NDIM> >, bool>
+{
+    inline bool operator()(const Pointer<Patch<NDIM> >& lhs, const Pointer<Patch<NDIM> >& rhs) const
+    {
+        return lhs->getBox().size() > rhs->getBox().size();
+    }
+};
+}
+
+int PatchTaskList::s_num_threads = 0;
+int PatchTaskList::s_grain_size = 1;
+int PatchTaskList::s_min_num_cells = 0;
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PatchTaskList::PatchTaskList(Pointer<PatchLevel<NDIM> > level) : d_patches(), d_num_cells(0)
+{
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        d_patches.push_back(patch);
+        d_num_cells += patch->getBox().size();
+    }
+
+    // Process the largest patches first so that the smaller patches can be
+    // used to balance the load at the end of the loop.
+    std::stable_sort(d_patches.begin(), d_patches.end(), PatchSizeComp());
+    return;
+} // PatchTaskList
+
+PatchTaskList::~PatchTaskList()
+{
+    // intentionally blank
+    return;
+} // ~PatchTaskList
+
+void PatchTaskList::setNumberOfThreads(const int num_threads)
+{
+    s_num_threads = num_threads;
+    return;
+} // setNumberOfThreads
+
+int PatchTaskList::getNumberOfThreads()
+{
+#if defined(_OPENMP)
+    return s_num_threads > 0 ? s_num_threads : omp_get_max_threads();
+#else
+    return 1;
+#endif
+} // getNumberOfThreads
+
+void PatchTaskList::setGrainSize(const int grain_size)
+{
+    s_grain_size = std::max(grain_size, 1);
+    return;
+} // setGrainSize
+
+void PatchTaskList::setMinimumNumberOfCells(const int min_num_cells)
+{
+    s_min_num_cells = min_num_cells;
+    return;
+} // setMinimumNumberOfCells
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,168 @@
+// Filename: SolutionHistoryExtrapolator.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "SAMRAIVectorReal.h"
+#include "ibtk/SolutionHistoryExtrapolator.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/MathUtilities.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SolutionHistoryExtrapolator::SolutionHistoryExtrapolator(const std::string& object_name,
+                                                         const int extrapolation_order)
+    : d_object_name(object_name), d_extrapolation_order(0), d_solutions(), d_solution_times()
+{
+    setExtrapolationOrder(extrapolation_order);
+    return;
+} // SolutionHistoryExtrapolator
+
+SolutionHistoryExtrapolator::~SolutionHistoryExtrapolator()
+{
+    clearHistory();
+    return;
+} // ~SolutionHistoryExtrapolator
+
+void SolutionHistoryExtrapolator::setExtrapolationOrder(const int extrapolation_order)
+{
+    if (extrapolation_order < 0)
+    {
+        TBOX_ERROR(d_object_name << "::setExtrapolationOrder():\n"
+                                 << "  extrapolation order must be nonnegative" << std::endl);
+    }
+    d_extrapolation_order = extrapolation_order;
+    while (static_cast<int>(d_solutions.size()) > d_extrapolation_order + 1)
+    {
+        d_solutions.front()->freeVectorComponents();
+        d_solutions.erase(d_solutions.begin());
+        d_solution_times.erase(d_solution_times.begin());
+    }
+    return;
+} // setExtrapolationOrder
+
+int SolutionHistoryExtrapolator::getExtrapolationOrder() const
+{
+    return d_extrapolation_order;
+} // getExtrapolationOrder
+
+int SolutionHistoryExtrapolator::getNumberOfStoredSolutions() const
+{
+    return static_cast<int>(d_solutions.size());
+} // getNumberOfStoredSolutions
+
+void SolutionHistoryExtrapolator::storeSolution(SAMRAIVectorReal<NDIM, double>& x, const double time)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+
+    // Replace the most recent solution if it corresponds to the same time.
+    if (!d_solutions.empty() && MathUtilities<double>::equalEps(d_solution_times.back(), time))
+    {
+        d_solutions.back()->copyVector(x_ptr);
+        return;
+    }
+
+    // Reuse the storage of the oldest solution when the history is full.
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_stored;
+    if (static_cast<int>(d_solutions.size()) == d_extrapolation_order + 1)
+    {
+        x_stored = d_solutions.front();
+        d_solutions.erase(d_solutions.begin());
+        d_solution_times.erase(d_solution_times.begin());
+    }
+    else
+    {
+        x_stored = x.cloneVector(d_object_name + "::x_stored");
+        x_stored->allocateVectorData(time);
+    }
+    x_stored->copyVector(x_ptr);
+    d_solutions.push_back(x_stored);
+    d_solution_times.push_back(time);
+    return;
+} // storeSolution
+
+bool SolutionHistoryExtrapolator::computeInitialGuess(SAMRAIVectorReal<NDIM, double>& x, const double time) const
+{
+    const int num_solutions = static_cast<int>(d_solutions.size());
+    if (num_solutions == 0) return false;
+
+    // Evaluate the Lagrange interpolating polynomial through the stored
+    // solutions at the requested time.
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+    for (int k = 0; k < num_solutions; ++k)
+    {
+        double l_k = 1.0;
+        for (int j = 0; j < num_solutions; ++j)
+        {
+            if (j == k) continue;
+            l_k *= (time - d_solution_times[j]) / (d_solution_times[k] - d_solution_times[j]);
+        }
+        if (k == 0)
+        {
+            x.scale(l_k, d_solutions[k]);
+        }
+        else
+        {
+            x.axpy(l_k, d_solutions[k], x_ptr);
+        }
+    }
+    return true;
+} // computeInitialGuess
+
+void SolutionHistoryExtrapolator::clearHistory()
+{
+    for (unsigned int k = 0; k < d_solutions.size(); ++k)
+    {
+        d_solutions[k]->freeVectorComponents();
+    }
+    d_solutions.clear();
+    d_solution_times.clear();
+    return;
+} // clearHistory
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
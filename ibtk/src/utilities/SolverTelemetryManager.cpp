@@ -0,0 +1,472 @@
+// Filename: SolverTelemetryManager.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/SolverTelemetryManager.h"
+#include "ibtk/ibtk_enums.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/MathUtilities.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+std::string escape_csv(const std::string& str)
+{
+    std::string escaped_str = "\"";
+    for (std::string::const_iterator it = str.begin(); it != str.end(); ++it)
+    {
+        if (*it == '"') escaped_str += '"';
+        escaped_str += *it;
+    }
+    return escaped_str + "\"";
+} // escape_csv
+
+inline bool is_valid(const double val)
+{
+    return !MathUtilities<double>::isNaN(val);
+} // is_valid
+}
+
+SolverTelemetryManager* SolverTelemetryManager::s_instance = NULL;
+bool SolverTelemetryManager::s_registered_callback = false;
+unsigned char SolverTelemetryManager::s_shutdown_priority = 200;
+bool SolverTelemetryManager::s_enabled = false;
+
+SolverTelemetryManager* SolverTelemetryManager::getManager()
+{
+    if (!s_instance)
+    {
+        s_instance = new SolverTelemetryManager();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeManager, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_instance;
+} // getManager
+
+void SolverTelemetryManager::freeManager()
+{
+    delete s_instance;
+    s_instance = NULL;
+    return;
+} // freeManager
+
+void SolverTelemetryManager::setFromDatabase(Pointer<Database> input_db)
+{
+    if (!input_db) return;
+    SolverTelemetryManager* const manager = getManager();
+    if (input_db->keyExists("enabled")) s_enabled = input_db->getBool("enabled");
+    if (input_db->keyExists("record_residual_history"))
+        manager->d_record_residual_history = input_db->getBool("record_residual_history");
+    if (input_db->keyExists("log_summaries")) manager->d_log_summaries = input_db->getBool("log_summaries");
+    if (input_db->keyExists("stream_filename")) manager->d_stream_filename = input_db->getString("stream_filename");
+    if (input_db->keyExists("stream_format"))
+    {
+        const std::string stream_format = input_db->getString("stream_format");
+        if (stream_format == "CSV")
+        {
+            manager->d_stream_json = false;
+        }
+        else if (stream_format == "JSON")
+        {
+            manager->d_stream_json = true;
+        }
+        else
+        {
+            TBOX_ERROR("SolverTelemetryManager::setFromDatabase():\n"
+                       << "  unsupported stream_format: " << stream_format << "\n"
+                       << "  valid choices are: CSV, JSON" << std::endl);
+        }
+    }
+    if (input_db->keyExists("stream_solve_records"))
+        manager->d_stream_solve_records = input_db->getBool("stream_solve_records");
+    return;
+} // setFromDatabase
+
+void SolverTelemetryManager::setEnabled(const bool enabled)
+{
+    s_enabled = enabled;
+    return;
+} // setEnabled
+
+void SolverTelemetryManager::startPhase(const SolverPhaseType phase)
+{
+    if (!s_enabled || !s_instance || s_instance->d_active_solves.empty()) return;
+    ActiveSolve& active_solve = s_instance->d_active_solves.back();
+    if (active_solve.phase_depth[phase]++ == 0) active_solve.phase_start_time[phase] = MPI_Wtime();
+    return;
+} // startPhase
+
+void SolverTelemetryManager::stopPhase(const SolverPhaseType phase)
+{
+    if (!s_instance || s_instance->d_active_solves.empty()) return;
+    ActiveSolve& active_solve = s_instance->d_active_solves.back();
+    if (active_solve.phase_depth[phase] == 0) return;
+    if (--active_solve.phase_depth[phase] == 0)
+    {
+        active_solve.record.phase_times[phase] += MPI_Wtime() - active_solve.phase_start_time[phase];
+    }
+    return;
+} // stopPhase
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+bool SolverTelemetryManager::getRecordResidualHistory() const
+{
+    return d_record_residual_history;
+} // getRecordResidualHistory
+
+void SolverTelemetryManager::beginSolve(const std::string& solver_name)
+{
+    d_active_solves.push_back(ActiveSolve());
+    ActiveSolve& active_solve = d_active_solves.back();
+    SolveRecord& record = active_solve.record;
+    record.solver_name = solver_name;
+    record.time_step_number = d_time_step_number;
+    record.num_iterations = 0;
+    record.residual_norm = std::numeric_limits<double>::quiet_NaN();
+    record.converged = false;
+    record.solve_time = 0.0;
+    for (int k = 0; k < NUM_SOLVER_PHASE_TYPES; ++k)
+    {
+        record.phase_times[k] = 0.0;
+        active_solve.phase_depth[k] = 0;
+        active_solve.phase_start_time[k] = 0.0;
+    }
+    active_solve.start_time = MPI_Wtime();
+    return;
+} // beginSolve
+
+void SolverTelemetryManager::endSolve(const int num_iterations,
+                                      const double residual_norm,
+                                      const bool converged,
+                                      const std::vector<double>& residual_history)
+{
+    if (d_active_solves.empty()) return;
+    ActiveSolve& active_solve = d_active_solves.back();
+    SolveRecord& record = active_solve.record;
+    record.num_iterations = num_iterations;
+    record.residual_norm = residual_norm;
+    record.converged = converged;
+    record.solve_time = MPI_Wtime() - active_solve.start_time;
+    if (d_record_residual_history) record.residual_history = residual_history;
+
+    TimeStepSummary& summary = getCurrentSummary(record.solver_name);
+    summary.num_solves += 1;
+    summary.num_failed_solves += converged ? 0 : 1;
+    summary.total_iterations += num_iterations;
+    summary.max_iterations = std::max(summary.max_iterations, num_iterations);
+    summary.residual_norm = residual_norm;
+    summary.solve_time += record.solve_time;
+    for (int k = 0; k < NUM_SOLVER_PHASE_TYPES; ++k)
+    {
+        summary.phase_times[k] += record.phase_times[k];
+    }
+    d_current_solve_records.push_back(record);
+    d_active_solves.pop_back();
+    return;
+} // endSolve
+
+void SolverTelemetryManager::recordSetup(const std::string& solver_name, const double setup_time)
+{
+    TimeStepSummary& summary = getCurrentSummary(solver_name);
+    summary.num_setups += 1;
+    summary.setup_time += setup_time;
+    return;
+} // recordSetup
+
+void SolverTelemetryManager::beginTimeStep(const int time_step_number, const double time)
+{
+    d_time_step_number = time_step_number;
+    d_time = time;
+    return;
+} // beginTimeStep
+
+void SolverTelemetryManager::endTimeStep()
+{
+    // Aggregate the data recorded during the current time step.  All processes
+    // execute the same sequence of solves, so that the summaries are ordered
+    // consistently across processes.
+    d_time_step_summaries.clear();
+    for (std::map<std::string, TimeStepSummary>::iterator it = d_current_summaries.begin();
+         it != d_current_summaries.end();
+         ++it)
+    {
+        it->second.time_step_number = d_time_step_number;
+        d_time_step_summaries.push_back(it->second);
+    }
+    d_current_summaries.clear();
+    d_solve_records.swap(d_current_solve_records);
+    d_current_solve_records.clear();
+
+    // Reduce the times across all MPI processes.
+    const int num_summaries = static_cast<int>(d_time_step_summaries.size());
+    if (SAMRAI_MPI::minReduction(num_summaries) != SAMRAI_MPI::maxReduction(num_summaries))
+    {
+        TBOX_WARNING("SolverTelemetryManager::endTimeStep():\n"
+                     << "  inconsistent solver data on different MPI processes; times are not reduced" << std::endl);
+    }
+    else if (num_summaries > 0)
+    {
+        static const int STRIDE = NUM_SOLVER_PHASE_TYPES + 2;
+        std::vector<double> times(STRIDE * num_summaries);
+        for (int k = 0; k < num_summaries; ++k)
+        {
+            const TimeStepSummary& summary = d_time_step_summaries[k];
+            times[STRIDE * k] = summary.setup_time;
+            times[STRIDE * k + 1] = summary.solve_time;
+            std::copy(summary.phase_times, summary.phase_times + NUM_SOLVER_PHASE_TYPES, &times[STRIDE * k + 2]);
+        }
+        SAMRAI_MPI::maxReduction(&times[0], static_cast<int>(times.size()));
+        for (int k = 0; k < num_summaries; ++k)
+        {
+            TimeStepSummary& summary = d_time_step_summaries[k];
+            summary.setup_time = times[STRIDE * k];
+            summary.solve_time = times[STRIDE * k + 1];
+            std::copy(&times[STRIDE * k + 2], &times[STRIDE * k + 2] + NUM_SOLVER_PHASE_TYPES, summary.phase_times);
+        }
+    }
+
+    // Write the summaries to the log file.
+    if (d_log_summaries)
+    {
+        for (std::vector<TimeStepSummary>::const_iterator it = d_time_step_summaries.begin();
+             it != d_time_step_summaries.end();
+             ++it)
+        {
+            plog << "SolverTelemetryManager::endTimeStep(): time step " << d_time_step_number << ": "
+                 << it->solver_name << ": solves = " << it->num_solves << ", failed = " << it->num_failed_solves
+                 << ", iterations = " << it->total_iterations << " (max " << it->max_iterations
+                 << "), setup time = " << it->setup_time << ", solve time = " << it->solve_time << "\n";
+            for (int k = 0; k < NUM_SOLVER_PHASE_TYPES; ++k)
+            {
+                if (it->phase_times[k] <= 0.0) continue;
+                plog << "  " << enum_to_string<SolverPhaseType>(static_cast<SolverPhaseType>(k))
+                     << " time = " << it->phase_times[k] << "\n";
+            }
+        }
+    }
+
+    // Write the data to the output stream.
+    if (d_stream_filename.empty() || SAMRAI_MPI::getRank() != 0) return;
+    if (!d_stream.is_open())
+    {
+        d_stream.open(d_stream_filename.c_str());
+        if (!d_stream.good())
+        {
+            TBOX_WARNING("SolverTelemetryManager::endTimeStep():\n"
+                         << "  unable to open file " << d_stream_filename << std::endl);
+            d_stream_filename.clear();
+            return;
+        }
+        d_stream << std::setprecision(9);
+    }
+    if (d_stream_solve_records)
+    {
+        for (std::vector<SolveRecord>::const_iterator it = d_solve_records.begin(); it != d_solve_records.end(); ++it)
+        {
+            TimeStepSummary row;
+            row.solver_name = it->solver_name;
+            row.time_step_number = it->time_step_number;
+            row.num_solves = 1;
+            row.num_failed_solves = it->converged ? 0 : 1;
+            row.total_iterations = it->num_iterations;
+            row.max_iterations = it->num_iterations;
+            row.residual_norm = it->residual_norm;
+            row.num_setups = 0;
+            row.setup_time = 0.0;
+            row.solve_time = it->solve_time;
+            std::copy(it->phase_times, it->phase_times + NUM_SOLVER_PHASE_TYPES, row.phase_times);
+            writeStreamRow("solve", row, it->residual_history);
+        }
+    }
+    for (std::vector<TimeStepSummary>::const_iterator it = d_time_step_summaries.begin();
+         it != d_time_step_summaries.end();
+         ++it)
+    {
+        writeStreamRow("time_step", *it, std::vector<double>());
+    }
+    d_stream.flush();
+    return;
+} // endTimeStep
+
+const std::vector<SolverTelemetryManager::TimeStepSummary>& SolverTelemetryManager::getTimeStepSummaries() const
+{
+    return d_time_step_summaries;
+} // getTimeStepSummaries
+
+const std::vector<SolverTelemetryManager::SolveRecord>& SolverTelemetryManager::getSolveRecords() const
+{
+    return d_solve_records;
+} // getSolveRecords
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+SolverTelemetryManager::SolverTelemetryManager()
+    : d_record_residual_history(true), d_log_summaries(false), d_stream_filename(""), d_stream_json(false),
+      d_stream_solve_records(false), d_stream(), d_stream_header_written(false), d_time_step_number(0), d_time(0.0),
+      d_active_solves(), d_current_summaries(), d_current_solve_records(), d_time_step_summaries(), d_solve_records()
+{
+    // intentionally blank
+    return;
+} // SolverTelemetryManager
+
+SolverTelemetryManager::~SolverTelemetryManager()
+{
+    if (d_stream.is_open()) d_stream.close();
+    return;
+} // ~SolverTelemetryManager
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+SolverTelemetryManager::TimeStepSummary& SolverTelemetryManager::getCurrentSummary(const std::string& solver_name)
+{
+    std::map<std::string, TimeStepSummary>::iterator it = d_current_summaries.find(solver_name);
+    if (it != d_current_summaries.end()) return it->second;
+    TimeStepSummary& summary = d_current_summaries[solver_name];
+    summary.solver_name = solver_name;
+    summary.time_step_number = d_time_step_number;
+    summary.num_solves = 0;
+    summary.num_failed_solves = 0;
+    summary.total_iterations = 0;
+    summary.max_iterations = 0;
+    summary.residual_norm = std::numeric_limits<double>::quiet_NaN();
+    summary.num_setups = 0;
+    summary.setup_time = 0.0;
+    summary.solve_time = 0.0;
+    for (int k = 0; k < NUM_SOLVER_PHASE_TYPES; ++k)
+    {
+        summary.phase_times[k] = 0.0;
+    }
+    return summary;
+} // getCurrentSummary
+
+void SolverTelemetryManager::writeStreamRow(const std::string& record_type,
+                                            const TimeStepSummary& summary,
+                                            const std::vector<double>& residual_history)
+{
+    if (d_stream_json)
+    {
+        d_stream << "{\"record_type\": \"" << record_type << "\", \"time_step\": " << summary.time_step_number
+                 << ", \"time\": " << d_time << ", \"solver\": \"" << escape_json(summary.solver_name)
+                 << "\", \"num_solves\": " << summary.num_solves
+                 << ", \"num_failed_solves\": " << summary.num_failed_solves
+                 << ", \"num_iterations\": " << summary.total_iterations
+                 << ", \"max_iterations\": " << summary.max_iterations << ", \"residual_norm\": ";
+        if (is_valid(summary.residual_norm))
+            d_stream << summary.residual_norm;
+        else
+            d_stream << "null";
+        d_stream << ", \"num_setups\": " << summary.num_setups << ", \"setup_time\": " << summary.setup_time
+                 << ", \"solve_time\": " << summary.solve_time << ", \"phase_times\": {";
+        for (int k = 0; k < NUM_SOLVER_PHASE_TYPES; ++k)
+        {
+            d_stream << (k == 0 ? "\"" : ", \"") << enum_to_string<SolverPhaseType>(static_cast<SolverPhaseType>(k))
+                     << "\": " << summary.phase_times[k];
+        }
+        d_stream << "}";
+        if (!residual_history.empty())
+        {
+            d_stream << ", \"residual_history\": [";
+            for (unsigned int k = 0; k < residual_history.size(); ++k)
+            {
+                d_stream << (k == 0 ? "" : ", ") << residual_history[k];
+            }
+            d_stream << "]";
+        }
+        d_stream << "}\n";
+    }
+    else
+    {
+        if (!d_stream_header_written)
+        {
+            d_stream << "record_type,time_step,time,solver,num_solves,num_failed_solves,num_iterations,"
+                     << "max_iterations,residual_norm,num_setups,setup_time,solve_time";
+            for (int k = 0; k < NUM_SOLVER_PHASE_TYPES; ++k)
+            {
+                std::string phase_name = enum_to_string<SolverPhaseType>(static_cast<SolverPhaseType>(k));
+                std::transform(phase_name.begin(), phase_name.end(), phase_name.begin(), ::tolower);
+                d_stream << "," << phase_name << "_time";
+            }
+            d_stream << ",residual_history\n";
+            d_stream_header_written = true;
+        }
+        d_stream << record_type << "," << summary.time_step_number << "," << d_time << ","
+                 << escape_csv(summary.solver_name) << "," << summary.num_solves << "," << summary.num_failed_solves
+                 << "," << summary.total_iterations << "," << summary.max_iterations << ",";
+        if (is_valid(summary.residual_norm)) d_stream << summary.residual_norm;
+        d_stream << "," << summary.num_setups << "," << summary.setup_time << "," << summary.solve_time;
+        for (int k = 0; k < NUM_SOLVER_PHASE_TYPES; ++k)
+        {
+            d_stream << "," << summary.phase_times[k];
+        }
+        d_stream << ",";
+        for (unsigned int k = 0; k < residual_history.size(); ++k)
+        {
+            d_stream << (k == 0 ? "" : ";") << residual_history[k];
+        }
+        d_stream << "\n";
+    }
+    return;
+} // writeStreamRow
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
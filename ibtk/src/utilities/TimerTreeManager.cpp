@@ -0,0 +1,524 @@
+// Filename: TimerTreeManager.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/TimerTreeManager.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Timer.h"
+#include "tbox/Utilities.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Separators used to construct the unique paths that identify the nodes of the
+// timer tree.  These characters sort before all printable characters, so that
+// sorting the paths lexicographically yields a preorder traversal of the tree.
+static const char PATH_SEPARATOR = '\x01';
+static const char LEVEL_SEPARATOR = '\x02';
+
+// Data type used with MPI_MAXLOC reductions.
+struct DoubleInt
+{
+    double value;
+    int rank;
+};
+
+inline bool is_main_thread()
+{
+#if defined(_OPENMP)
+    for (int level = omp_get_level(); level > 0; --level)
+    {
+        if (omp_get_ancestor_thread_num(level) != 0) return false;
+    }
+#endif
+    return true;
+} // is_main_thread
+
+void split_paths(const std::vector<char>& buf, std::vector<std::string>& paths)
+{
+    std::string path;
+    for (std::vector<char>::const_iterator it = buf.begin(); it != buf.end(); ++it)
+    {
+        if (*it == '\n')
+        {
+            paths.push_back(path);
+            path.clear();
+        }
+        else
+        {
+            path += *it;
+        }
+    }
+    return;
+} // split_paths
+}
+
+TimerTreeManager* TimerTreeManager::s_instance = NULL;
+bool TimerTreeManager::s_registered_callback = false;
+unsigned char TimerTreeManager::s_shutdown_priority = 200;
+bool TimerTreeManager::s_enabled = true;
+
+TimerTreeManager* TimerTreeManager::getManager()
+{
+    if (!s_instance)
+    {
+        s_instance = new TimerTreeManager();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeManager, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_instance;
+} // getManager
+
+void TimerTreeManager::freeManager()
+{
+    if (s_instance) s_instance->writeOutputs();
+    delete s_instance;
+    s_instance = NULL;
+    return;
+} // freeManager
+
+void TimerTreeManager::setFromDatabase(Pointer<Database> input_db)
+{
+    if (!input_db) return;
+    TimerTreeManager* const manager = getManager();
+    if (input_db->keyExists("enabled")) s_enabled = input_db->getBool("enabled");
+    if (input_db->keyExists("print_summary")) manager->d_print_summary = input_db->getBool("print_summary");
+    if (input_db->keyExists("summary_json_filename"))
+        manager->d_summary_json_filename = input_db->getString("summary_json_filename");
+    if (input_db->keyExists("enable_trace")) manager->d_enable_trace = input_db->getBool("enable_trace");
+    if (input_db->keyExists("trace_filename")) manager->d_trace_filename = input_db->getString("trace_filename");
+    if (input_db->keyExists("max_num_trace_events"))
+    {
+        const int max_num_trace_events = input_db->getInteger("max_num_trace_events");
+        if (max_num_trace_events < 0)
+        {
+            TBOX_ERROR("TimerTreeManager::setFromDatabase():\n"
+                       << "  max_num_trace_events must be nonnegative" << std::endl);
+        }
+        manager->d_max_num_trace_events = static_cast<unsigned int>(max_num_trace_events);
+    }
+    return;
+} // setFromDatabase
+
+void TimerTreeManager::setEnabled(const bool enabled)
+{
+    s_enabled = enabled;
+    return;
+} // setEnabled
+
+void TimerTreeManager::startTimer(Timer* const timer, const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(timer);
+#endif
+    timer->start();
+    if (is_main_thread()) getManager()->pushScope(timer, level_number);
+    return;
+} // startTimer
+
+void TimerTreeManager::stopTimer(Timer* const timer)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(timer);
+#endif
+    // NOTE: Timers that were started while timers were disabled are not
+    // running and are not associated with an open scope.
+    if (s_instance && is_main_thread()) s_instance->popScope(timer);
+    if (timer->isRunning()) timer->stop();
+    return;
+} // stopTimer
+
+void TimerTreeManager::setTimeStepNumber(const int time_step_number)
+{
+    getManager()->d_time_step_number = time_step_number;
+    return;
+} // setTimeStepNumber
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void TimerTreeManager::printSummary(std::ostream& os)
+{
+    std::vector<NodeSummary> summary;
+    computeSummary(summary);
+    if (SAMRAI_MPI::getRank() != 0) return;
+
+    const std::ios_base::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os << "+------------------------------------------------------------------------------------------------------+\n";
+    os << "TimerTreeManager::printSummary(): timer tree summary over " << SAMRAI_MPI::getNodes() << " MPI processes\n";
+    os << "  times are inclusive wall clock times in seconds; imbalance = max/mean\n\n";
+    os << std::setw(10) << "calls" << std::setw(12) << "min" << std::setw(12) << "mean" << std::setw(12) << "max"
+       << std::setw(10) << "imbalance" << std::setw(8) << "rank"
+       << "  timer\n";
+    os << std::fixed << std::setprecision(4);
+    for (std::vector<NodeSummary>::const_iterator it = summary.begin(); it != summary.end(); ++it)
+    {
+        const double imbalance = it->mean_time > 0.0 ? it->max_time / it->mean_time : 1.0;
+        os << std::setw(10) << it->num_calls << std::setw(12) << it->min_time << std::setw(12) << it->mean_time
+           << std::setw(12) << it->max_time << std::setw(10) << std::setprecision(2) << imbalance << std::setw(8)
+           << it->max_rank << std::setprecision(4) << "  " << std::string(2 * it->depth, ' ') << it->name;
+        if (it->level_number >= 0) os << " [level " << it->level_number << "]";
+        os << "\n";
+    }
+    os << "+------------------------------------------------------------------------------------------------------+\n";
+    os.flags(flags);
+    os.precision(precision);
+    return;
+} // printSummary
+
+void TimerTreeManager::writeSummaryJSON(const std::string& filename)
+{
+    std::vector<NodeSummary> summary;
+    computeSummary(summary);
+    if (SAMRAI_MPI::getRank() != 0) return;
+
+    std::ofstream os(filename.c_str());
+    if (!os.good())
+    {
+        TBOX_WARNING("TimerTreeManager::writeSummaryJSON():\n"
+                     << "  unable to open file " << filename << std::endl);
+        return;
+    }
+    os << std::setprecision(9);
+    os << "{\n  \"num_ranks\": " << SAMRAI_MPI::getNodes() << ",\n  \"timers\": [";
+    for (std::vector<NodeSummary>::const_iterator it = summary.begin(); it != summary.end(); ++it)
+    {
+        std::string path = it->path;
+        std::replace(path.begin(), path.end(), PATH_SEPARATOR, '/');
+        std::replace(path.begin(), path.end(), LEVEL_SEPARATOR, '@');
+        const double imbalance = it->mean_time > 0.0 ? it->max_time / it->mean_time : 1.0;
+        os << (it == summary.begin() ? "\n" : ",\n") << "    {\"path\": \"" << escape_json(path) << "\", \"name\": \""
+           << escape_json(it->name) << "\", \"level\": " << it->level_number << ", \"depth\": " << it->depth
+           << ", \"calls\": " << it->num_calls << ", \"min\": " << it->min_time << ", \"mean\": " << it->mean_time
+           << ", \"max\": " << it->max_time << ", \"imbalance\": " << imbalance << ", \"max_rank\": " << it->max_rank
+           << "}";
+    }
+    os << "\n  ]\n}\n";
+    return;
+} // writeSummaryJSON
+
+void TimerTreeManager::writeChromeTrace(const std::string& filename) const
+{
+    const int rank = SAMRAI_MPI::getRank();
+    std::ostringstream file_name;
+    file_name << filename << "." << rank << ".json";
+    std::ofstream os(file_name.str().c_str());
+    if (!os.good())
+    {
+        TBOX_WARNING("TimerTreeManager::writeChromeTrace():\n"
+                     << "  unable to open file " << file_name.str() << std::endl);
+        return;
+    }
+    if (d_trace_overflow)
+    {
+        TBOX_WARNING("TimerTreeManager::writeChromeTrace():\n"
+                     << "  maximum number of trace events exceeded; trace is incomplete" << std::endl);
+    }
+
+    // Chrome trace event timestamps and durations are in microseconds.
+    os << std::fixed << std::setprecision(3);
+    os << "{\"traceEvents\": [";
+    for (std::vector<TraceEvent>::const_iterator it = d_trace_events.begin(); it != d_trace_events.end(); ++it)
+    {
+        const TimerNode& node = d_nodes[it->node];
+        os << (it == d_trace_events.begin() ? "\n" : ",\n") << "{\"name\": \"" << escape_json(node.name)
+           << "\", \"ph\": \"X\", \"ts\": " << 1.0e6 * (it->start_time - d_start_time)
+           << ", \"dur\": " << 1.0e6 * it->duration << ", \"pid\": " << rank
+           << ", \"tid\": 0, \"args\": {\"level\": " << node.level_number << ", \"step\": " << it->time_step_number
+           << "}}";
+    }
+    os << "\n]}\n";
+    return;
+} // writeChromeTrace
+
+void TimerTreeManager::resetTimings()
+{
+    for (std::vector<TimerNode>::iterator it = d_nodes.begin(); it != d_nodes.end(); ++it)
+    {
+        it->total_time = 0.0;
+        it->num_calls = 0;
+    }
+    d_trace_events.clear();
+    d_trace_overflow = false;
+    return;
+} // resetTimings
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+TimerTreeManager::TimerTreeManager()
+    : d_nodes(1), d_active_scopes(), d_trace_events(), d_enable_trace(false), d_max_num_trace_events(1000000),
+      d_trace_overflow(false), d_start_time(MPI_Wtime()), d_time_step_number(0), d_print_summary(false),
+      d_summary_json_filename(""), d_trace_filename("trace")
+{
+    TimerNode& root = d_nodes[0];
+    root.level_number = -1;
+    root.parent = -1;
+    root.total_time = 0.0;
+    root.num_calls = 0;
+    return;
+} // TimerTreeManager
+
+TimerTreeManager::~TimerTreeManager()
+{
+    d_nodes.clear();
+    d_active_scopes.clear();
+    d_trace_events.clear();
+    return;
+} // ~TimerTreeManager
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void TimerTreeManager::pushScope(Timer* const timer, const int level_number)
+{
+    const int parent = d_active_scopes.empty() ? 0 : d_active_scopes.back().node;
+    const std::pair<const Timer*, int> key(timer, level_number);
+    std::map<std::pair<const Timer*, int>, int>::const_iterator it = d_nodes[parent].children.find(key);
+    int node;
+    if (it != d_nodes[parent].children.end())
+    {
+        node = it->second;
+    }
+    else
+    {
+        node = static_cast<int>(d_nodes.size());
+        d_nodes[parent].children[key] = node;
+        d_nodes.push_back(TimerNode());
+        TimerNode& new_node = d_nodes.back();
+        new_node.name = timer->getName();
+        new_node.level_number = level_number;
+        new_node.parent = parent;
+        new_node.total_time = 0.0;
+        new_node.num_calls = 0;
+    }
+    ActiveScope scope;
+    scope.timer = timer;
+    scope.node = node;
+    scope.start_time = MPI_Wtime();
+    d_active_scopes.push_back(scope);
+    return;
+} // pushScope
+
+bool TimerTreeManager::popScope(Timer* const timer)
+{
+    int scope_idx = static_cast<int>(d_active_scopes.size()) - 1;
+    while (scope_idx >= 0 && d_active_scopes[scope_idx].timer != timer) --scope_idx;
+    if (scope_idx < 0) return false;
+
+    // Close the scope associated with the timer along with any improperly
+    // nested scopes that were opened after it.
+    const double stop_time = MPI_Wtime();
+    for (int k = static_cast<int>(d_active_scopes.size()) - 1; k >= scope_idx; --k)
+    {
+        const ActiveScope& scope = d_active_scopes[k];
+        const double duration = stop_time - scope.start_time;
+        TimerNode& node = d_nodes[scope.node];
+        node.total_time += duration;
+        node.num_calls += 1;
+        if (d_enable_trace)
+        {
+            if (d_trace_events.size() < d_max_num_trace_events)
+            {
+                TraceEvent event;
+                event.node = scope.node;
+                event.start_time = scope.start_time;
+                event.duration = duration;
+                event.time_step_number = d_time_step_number;
+                d_trace_events.push_back(event);
+            }
+            else
+            {
+                d_trace_overflow = true;
+            }
+        }
+    }
+    d_active_scopes.resize(scope_idx);
+    return true;
+} // popScope
+
+std::string TimerTreeManager::getNodePath(const int node) const
+{
+    const TimerNode& timer_node = d_nodes[node];
+    std::ostringstream component;
+    component << timer_node.name;
+    if (timer_node.level_number >= 0) component << LEVEL_SEPARATOR << timer_node.level_number;
+    if (timer_node.parent <= 0) return component.str();
+    return getNodePath(timer_node.parent) + PATH_SEPARATOR + component.str();
+} // getNodePath
+
+void TimerTreeManager::computeSummary(std::vector<NodeSummary>& summary)
+{
+    summary.clear();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+
+    // Collect the local nodes of the tree.  Different processes generally
+    // record different trees, so we first determine the union of the paths of
+    // all processes on process 0 and then broadcast the union to all processes.
+    std::map<std::string, int> local_nodes;
+    for (int k = 1; k < static_cast<int>(d_nodes.size()); ++k)
+    {
+        local_nodes[getNodePath(k)] = k;
+    }
+    std::vector<char> local_buf;
+    for (std::map<std::string, int>::const_iterator it = local_nodes.begin(); it != local_nodes.end(); ++it)
+    {
+        local_buf.insert(local_buf.end(), it->first.begin(), it->first.end());
+        local_buf.push_back('\n');
+    }
+    int local_buf_size = static_cast<int>(local_buf.size());
+    std::vector<int> buf_sizes(nodes, 0), buf_displs(nodes, 0);
+    MPI_Gather(&local_buf_size, 1, MPI_INT, &buf_sizes[0], 1, MPI_INT, 0, communicator);
+    for (int k = 1; k < nodes; ++k) buf_displs[k] = buf_displs[k - 1] + buf_sizes[k - 1];
+    std::vector<char> recv_buf(std::max(buf_displs[nodes - 1] + buf_sizes[nodes - 1], 1));
+    local_buf.push_back('\0');
+    MPI_Gatherv(&local_buf[0],
+                local_buf_size,
+                MPI_CHAR,
+                &recv_buf[0],
+                &buf_sizes[0],
+                &buf_displs[0],
+                MPI_CHAR,
+                0,
+                communicator);
+    std::vector<char> global_buf;
+    if (rank == 0)
+    {
+        recv_buf.resize(buf_displs[nodes - 1] + buf_sizes[nodes - 1]);
+        std::vector<std::string> all_paths;
+        split_paths(recv_buf, all_paths);
+        const std::set<std::string> global_paths(all_paths.begin(), all_paths.end());
+        for (std::set<std::string>::const_iterator it = global_paths.begin(); it != global_paths.end(); ++it)
+        {
+            global_buf.insert(global_buf.end(), it->begin(), it->end());
+            global_buf.push_back('\n');
+        }
+    }
+    int global_buf_size = static_cast<int>(global_buf.size());
+    MPI_Bcast(&global_buf_size, 1, MPI_INT, 0, communicator);
+    global_buf.resize(global_buf_size + 1);
+    MPI_Bcast(&global_buf[0], global_buf_size, MPI_CHAR, 0, communicator);
+    global_buf.resize(global_buf_size);
+    std::vector<std::string> paths;
+    split_paths(global_buf, paths);
+    const int num_paths = static_cast<int>(paths.size());
+    if (num_paths == 0) return;
+
+    // Reduce the timing data across all processes.
+    std::vector<double> local_times(num_paths, 0.0), min_times(num_paths, 0.0), sum_times(num_paths, 0.0);
+    std::vector<unsigned long> local_calls(num_paths, 0), sum_calls(num_paths, 0);
+    std::vector<DoubleInt> local_max(num_paths), global_max(num_paths);
+    for (int k = 0; k < num_paths; ++k)
+    {
+        std::map<std::string, int>::const_iterator it = local_nodes.find(paths[k]);
+        if (it != local_nodes.end())
+        {
+            local_times[k] = d_nodes[it->second].total_time;
+            local_calls[k] = d_nodes[it->second].num_calls;
+        }
+        local_max[k].value = local_times[k];
+        local_max[k].rank = rank;
+    }
+    MPI_Reduce(&local_times[0], &min_times[0], num_paths, MPI_DOUBLE, MPI_MIN, 0, communicator);
+    MPI_Reduce(&local_times[0], &sum_times[0], num_paths, MPI_DOUBLE, MPI_SUM, 0, communicator);
+    MPI_Reduce(&local_calls[0], &sum_calls[0], num_paths, MPI_UNSIGNED_LONG, MPI_SUM, 0, communicator);
+    MPI_Reduce(&local_max[0], &global_max[0], num_paths, MPI_DOUBLE_INT, MPI_MAXLOC, 0, communicator);
+    if (rank != 0) return;
+
+    summary.resize(num_paths);
+    for (int k = 0; k < num_paths; ++k)
+    {
+        NodeSummary& node_summary = summary[k];
+        node_summary.path = paths[k];
+        node_summary.depth = static_cast<int>(std::count(paths[k].begin(), paths[k].end(), PATH_SEPARATOR));
+        const std::string::size_type name_start = paths[k].rfind(PATH_SEPARATOR);
+        std::string component = name_start == std::string::npos ? paths[k] : paths[k].substr(name_start + 1);
+        const std::string::size_type level_start = component.find(LEVEL_SEPARATOR);
+        node_summary.level_number = -1;
+        if (level_start != std::string::npos)
+        {
+            std::istringstream(component.substr(level_start + 1)) >> node_summary.level_number;
+            component.erase(level_start);
+        }
+        node_summary.name = component;
+        node_summary.num_calls = sum_calls[k];
+        node_summary.min_time = min_times[k];
+        node_summary.mean_time = sum_times[k] / static_cast<double>(nodes);
+        node_summary.max_time = global_max[k].value;
+        node_summary.max_rank = global_max[k].rank;
+    }
+    return;
+} // computeSummary
+
+void TimerTreeManager::writeOutputs()
+{
+    if (d_print_summary) printSummary(pout);
+    if (!d_summary_json_filename.empty()) writeSummaryJSON(d_summary_json_filename);
+    if (d_enable_trace) writeChromeTrace(d_trace_filename);
+    return;
+} // writeOutputs
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -172,7 +172,8 @@ public:
     spreadForce(int f_data_idx,
                 IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
-                double data_time);
+                double data_time,
+                bool f_data_is_zero = false);
 
     /*!
      * Initialize Lagrangian data corresponding to the given AMR patch hierarchy
@@ -70,6 +70,26 @@ namespace IBAMR
 /*!
  * \brief Class IBExplicitHierarchyIntegrator is an implementation of a formally
  * second-order accurate, semi-implicit version of the immersed boundary method.
+ *
+ * The Lagrangian force may optionally be time-averaged over each time step.  In
+ * this mode, the Lagrangian force is evaluated at the midpoints of several
+ * substeps along the linear path connecting the current positions of the
+ * structure and the present prediction of its new positions, and the
+ * time-averaged force is spread to the Cartesian grid once per time step.  This
+ * mode is controlled by the following input database entries:
+ *
+ * - \p num_lagrangian_substeps (default 1): the (minimum) number of substeps
+ * - \p use_automatic_lagrangian_substeps (default FALSE): whether to determine
+ *   the number of substeps from the CFL number of the preceding time step
+ * - \p max_num_lagrangian_substeps (default 100): the maximum number of
+ *   automatically determined substeps
+ * - \p lagrangian_substep_cfl (default 0.25): the maximum CFL number of each
+ *   automatically determined substep (a nonpositive value disables this
+ *   restriction)
+ *
+ * \note The substep forces do not feed back into the positions of the
+ * structure, so time-averaging the force does not relax the time step size
+ * restriction imposed by stiff structures.
  */
 class IBExplicitHierarchyIntegrator : public IBHierarchyIntegrator
 {
@@ -158,11 +178,35 @@ private:
      */
     IBExplicitHierarchyIntegrator& operator=(const IBExplicitHierarchyIntegrator& that);
 
+    /*!
+     * Determine the number of substeps to use to time-average the Lagrangian
+     * force over a time step of the specified size.
+     */
+    int computeNumberOfLagrangianSubsteps(double dt);
+
+    /*!
+     * Read input values from a given database.
+     */
+    void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db, bool is_from_restart);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.
      */
     void getFromRestart();
+
+    /*
+     * Lagrangian force time-averaging parameters.
+     */
+    bool d_use_lagrangian_subcycling, d_use_automatic_lagrangian_substeps;
+    int d_num_lagrangian_substeps, d_max_num_lagrangian_substeps, d_current_num_lagrangian_substeps;
+    double d_lagrangian_substep_cfl;
+
+    /*
+     * The maximum fluid velocity divided by the grid spacing, as computed in
+     * the preceding time step.
+     */
+    double d_u_max_over_dx;
 };
 } // namespace IBAMR
 
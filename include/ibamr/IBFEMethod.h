@@ -47,6 +47,7 @@
 #include "PatchHierarchy.h"
 #include "ibamr/IBStrategy.h"
 #include "ibtk/FEDataManager.h"
+#include "ibtk/SpreadAccumulator.h"
 #include "ibtk/libmesh_utilities.h"
 #include "libmesh/enum_fe_family.h"
 #include "libmesh/enum_order.h"
@@ -464,7 +465,8 @@ public:
     spreadForce(int f_data_idx,
                 IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
-                double data_time);
+                double data_time,
+                bool f_data_is_zero = false);
 
     /*!
      * Initialize FE data.  This method must be called prior to calling
@@ -626,6 +628,11 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > d_gridding_alg;
     bool d_is_initialized;
 
+    /*
+     * Data used to accumulate values spread to the Cartesian grid.
+     */
+    IBTK::SpreadAccumulator d_spread_accumulator;
+
     /*
      * The current time step interval.
      */
@@ -663,6 +670,21 @@ protected:
     libMesh::Order d_quad_order;
     bool d_use_consistent_mass_matrix;
 
+    /*
+     * Whether consistent mass matrix L2 projections are computed one variable
+     * at a time using preconditioners that are built only once.
+     */
+    bool d_use_block_L2_projection_solver;
+
+    /*
+     * The number of threads used to compute the Lagrangian force densities.
+     *
+     * \note Values larger than one require IBAMR to be configured with
+     * --enable-openmp, and require that the user-supplied stress and force
+     * functions can safely be called concurrently.
+     */
+    int d_num_force_assembly_threads;
+
     /*
      * Data related to handling constrained body constraints.
      */
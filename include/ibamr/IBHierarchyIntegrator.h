@@ -234,6 +234,32 @@ protected:
      */
     void putToDatabaseSpecialized(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * Update the measured Lagrangian displacement statistics used by the
+     * adaptive regridding policy.
+     *
+     * \note This method should be called by subclasses once the Lagrangian
+     * data have been advanced to the end of the current time step.
+     */
+    void updateRegridDisplacementStatistics();
+
+    /*!
+     * Advance the Lagrangian markers (if any) from current_time to new_time
+     * using the current and new Eulerian velocity fields.
+     *
+     * The marker time stepping scheme is set by the input key
+     * marker_time_stepping_type (FORWARD_EULER, MIDPOINT_RULE,
+     * TRAPEZOIDAL_RULE, SSPRK3, or RK4).  When it is not specified, the
+     * markers use the same scheme as the IB equations.  The half-step velocity
+     * used by the midpoint and Runge-Kutta schemes is taken to be the average of
+     * the current and new velocities.  Marker velocities are interpolated using
+     * the kernel named by marker_kernel_fcn (default IB_4).
+     *
+     * \note This method should be called by subclasses once the new Eulerian
+     * velocity is available and before new state data are synchronized.
+     */
+    void advanceMarkers(double current_time, double new_time);
+
     /*
      * Boolean value that indicates whether the integrator has been initialized.
      */
@@ -266,6 +292,33 @@ protected:
      */
     double d_regrid_cfl_interval, d_regrid_cfl_estimate;
 
+    /*
+     * Parameters and data used by the adaptive regridding policy.  When this
+     * policy is enabled, the hierarchy is regridded when:
+     *
+     * - the measured maximum displacement of any Lagrangian point since the
+     *   last regrid exceeds d_adaptive_regrid_max_displacement meshwidths;
+     *
+     * - the fraction of Lagrangian points that are within
+     *   d_adaptive_regrid_edge_width cells of the boundary of the level on
+     *   which they are stored exceeds d_adaptive_regrid_max_edge_fraction
+     *   (by default 1.0, which disables this criterion); or
+     *
+     * - the measured extra cost of advancing the solution on the stale grid
+     *   exceeds the measured cost of the most recent regrid operation.
+     *
+     * Regridding is never performed more often than every
+     * d_adaptive_regrid_min_interval time steps, and is always performed at
+     * least every d_adaptive_regrid_max_interval time steps (if positive).
+     *
+     * NOTE: If the IB method implementation does not provide displacement
+     * statistics, the CFL-based estimate of the displacement is used instead.
+     */
+    bool d_use_adaptive_regrid_policy;
+    double d_adaptive_regrid_max_displacement, d_adaptive_regrid_max_edge_fraction;
+    int d_adaptive_regrid_edge_width, d_adaptive_regrid_min_interval, d_adaptive_regrid_max_interval;
+    double d_regrid_max_displacement, d_regrid_edge_fraction;
+
     /*
      * IB method implementation object.
      */
@@ -316,6 +369,9 @@ protected:
     int d_mark_current_idx, d_mark_new_idx, d_mark_scratch_idx;
     std::vector<IBTK::Point> d_mark_init_posns;
     std::string d_mark_file_name;
+    TimeSteppingType d_mark_time_stepping_type;
+    std::string d_mark_kernel_fcn;
+    int d_mark_u_current_idx, d_mark_u_half_idx;
 
     /*!
      * \brief A class to communicate the Eulerian body force computed by class
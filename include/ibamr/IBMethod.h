@@ -50,6 +50,7 @@
 #include "ibamr/IBMethodPostProcessStrategy.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -262,6 +263,14 @@ public:
      */
     void computeLagrangianForce(double data_time);
 
+    /*!
+     * Compute the time average of the Lagrangian force over the current time
+     * interval using the specified number of substeps, and store the result as
+     * the Lagrangian force at the specified time within the current time
+     * interval.
+     */
+    void computeSubcycledLagrangianForce(double current_time, double new_time, int num_substeps, double data_time);
+
     /*!
      * Compute the Lagrangian force of the linearized problem for the specified
      * configuration of the updated position vector.
@@ -276,7 +285,8 @@ public:
     spreadForce(int f_data_idx,
                 IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
-                double data_time);
+                double data_time,
+                bool f_data_is_zero = false);
 
     /*!
      * Spread the Lagrangian force of the linearized problem to the Cartesian
@@ -375,6 +385,14 @@ public:
     void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Compute the maximum displacement of the IB points since the last
+     * redistribution of the Lagrangian data, and the fraction of IB points
+     * that are within \a edge_width cells of the boundary of the level on
+     * which they are stored.
+     */
+    void computeRegridDisplacementStatistics(double& max_displacement, double& edge_fraction, int edge_width);
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
@@ -515,6 +533,17 @@ protected:
     std::string d_interp_kernel_fcn, d_spread_kernel_fcn;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
+    /*
+     * Settings for asynchronous checkpointing of the Lagrangian data.
+     */
+    bool d_use_async_lag_checkpointing;
+    std::string d_async_lag_checkpoint_dirname;
+
+    /*
+     * The ordering used for the local Lagrangian nodes.
+     */
+    IBTK::LNodeOrderingType d_lag_node_ordering;
+
     /*
      * Lagrangian variables.
      */
@@ -523,6 +552,17 @@ protected:
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_U_current_data, d_U_new_data, d_U_half_data, d_U_jac_data;
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_F_current_data, d_F_new_data, d_F_half_data, d_F_jac_data;
 
+    /*
+     * Lagrangian variables used to compute the time-averaged Lagrangian force.
+     */
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_substep_data, d_U_substep_data, d_F_substep_data;
+
+    /*
+     * The positions of the IB points at the time of the most recent
+     * redistribution of the Lagrangian data.
+     */
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_regrid_data;
+
     /*
      * List of local indices of local anchor points.
      *
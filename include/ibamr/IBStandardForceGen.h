@@ -201,6 +201,7 @@ private:
     //\{
     struct SpringData
     {
+        int num_local_springs; // springs [0,num_local_springs) involve only local nodes
         std::vector<int> lag_mastr_node_idxs, lag_slave_node_idxs;
         std::vector<int> petsc_mastr_node_idxs, petsc_slave_node_idxs;
         std::vector<SpringForceFcnPtr> force_fcns;
@@ -211,6 +212,7 @@ private:
 
     struct BeamData
     {
+        int num_local_beams; // beams [0,num_local_beams) involve only local nodes
         std::vector<int> petsc_mastr_node_idxs, petsc_next_node_idxs, petsc_prev_node_idxs;
         std::vector<const double*> rigidities;
         std::vector<const IBTK::Vector*> curvatures;
@@ -243,7 +245,9 @@ private:
                                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                       int level_number,
                                       double data_time,
-                                      IBTK::LDataManager* l_data_manager);
+                                      IBTK::LDataManager* l_data_manager,
+                                      int k_lower,
+                                      int k_upper);
 
     /*!
      * Beam force routines.
@@ -259,7 +263,9 @@ private:
                                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                     int level_number,
                                     double data_time,
-                                    IBTK::LDataManager* l_data_manager);
+                                    IBTK::LDataManager* l_data_manager,
+                                    int k_lower,
+                                    int k_upper);
 
     /*!
      * TargetPoint force routines.
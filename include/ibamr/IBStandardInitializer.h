@@ -641,6 +641,25 @@ private:
      */
     void readSourceFiles(const std::string& file_extension);
 
+    /*!
+     * \brief Convert the spring, crosslink spring, and rod data read from the
+     * input files into compressed sparse row (CSR) connectivity data, and free
+     * the tree-based data structures used while reading the input files.
+     */
+    void buildConnectivityData();
+
+    /*!
+     * \brief Reconstruct an edge map from CSR connectivity data.
+     *
+     * If structure_idx is nonnegative, only those edges that were read from the
+     * input file of the specified structure are included in the edge map.
+     */
+    struct EdgeCSRData;
+
+    void getEdgeMap(std::multimap<int, std::pair<int, int> >& edge_map,
+                    const EdgeCSRData& csr_data,
+                    int structure_idx = -1) const;
+
     /*!
      * \brief Determine the indices of any vertices initially located within the
      * specified patch.
@@ -793,6 +812,36 @@ private:
         }
     };
 
+    /*
+     * Compressed sparse row (CSR) connectivity data.
+     *
+     * The edges whose master index is idx_lower+k are stored in the half-open
+     * range [offsets[k],offsets[k+1]) of the packed per-edge arrays, and the
+     * material parameters of edge e are stored in the half-open range
+     * [param_offsets[e],param_offsets[e+1]) of params.  The structure indices
+     * are stored only for crosslink springs, which may connect vertices that
+     * belong to different structures.
+     *
+     * \note The tree-based edge maps and specification maps are used only while
+     * reading the input files.  They are cleared once the corresponding CSR data
+     * have been built.
+     */
+    struct EdgeCSRData
+    {
+        EdgeCSRData()
+            : idx_lower(0), offsets(), slave_idxs(), force_fcn_idxs(), param_offsets(), params(), structure_idxs()
+        {
+        }
+
+        int idx_lower;
+        std::vector<int> offsets;
+        std::vector<int> slave_idxs;
+        std::vector<int> force_fcn_idxs;
+        std::vector<int> param_offsets;
+        std::vector<double> params;
+        std::vector<int> structure_idxs;
+    };
+
     /*
      * Spring information.
      */
@@ -806,6 +855,7 @@ private:
         int force_fcn_idx;
     };
     std::vector<std::vector<std::map<Edge, SpringSpec, EdgeComp> > > d_spring_spec_data;
+    std::vector<std::vector<EdgeCSRData> > d_spring_csr_data;
 
     std::vector<std::vector<bool> > d_using_uniform_spring_stiffness;
     std::vector<std::vector<double> > d_uniform_spring_stiffness;
@@ -829,6 +879,7 @@ private:
         int force_fcn_idx;
     };
     std::vector<std::vector<std::map<Edge, XSpringSpec, EdgeComp> > > d_xspring_spec_data;
+    std::vector<EdgeCSRData> d_xspring_csr_data;
 
     std::vector<std::vector<bool> > d_using_uniform_xspring_stiffness;
     std::vector<std::vector<double> > d_uniform_xspring_stiffness;
@@ -870,6 +921,7 @@ private:
         boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> properties;
     };
     std::vector<std::vector<std::map<Edge, RodSpec, EdgeComp> > > d_rod_spec_data;
+    std::vector<std::vector<EdgeCSRData> > d_rod_csr_data;
 
     std::vector<std::vector<bool> > d_using_uniform_rod_properties;
     std::vector<std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> > > d_uniform_rod_properties;
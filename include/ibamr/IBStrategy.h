@@ -237,15 +237,39 @@ public:
      */
     virtual void computeLagrangianForce(double data_time) = 0;
 
+    /*!
+     * Compute the time average of the Lagrangian force over the current time
+     * interval using the specified number of substeps, and store the result as
+     * the Lagrangian force at the specified time within the current time
+     * interval.
+     *
+     * The force is evaluated along the linear path connecting the current
+     * positions of the structure and the present prediction of its new
+     * positions, i.e., with the Lagrangian velocity held fixed.  The substep
+     * forces do not feed back into the positions, so this is a quadrature of
+     * the force over the time interval, and it does not relax the time step
+     * size restriction imposed by stiff structures.
+     *
+     * A default implementation is provided that emits an unrecoverable
+     * exception.
+     */
+    virtual void
+    computeSubcycledLagrangianForce(double current_time, double new_time, int num_substeps, double data_time);
+
     /*!
      * Spread the Lagrangian force to the Cartesian grid at the specified time
      * within the current time interval.
+     *
+     * If \a f_data_is_zero is true, the caller guarantees that the Eulerian
+     * force is zero on entry, so that the spread values may be written
+     * directly into it.
      */
     virtual void
     spreadForce(int f_data_idx,
                 IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
-                double data_time) = 0;
+                double data_time,
+                bool f_data_is_zero = false) = 0;
 
     /*!
      * Indicate whether there are any internal fluid sources/sinks.
@@ -362,6 +386,22 @@ public:
     virtual void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                        SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Compute statistics that are used to determine whether the patch
+     * hierarchy should be regridded.  The maximum displacement of any
+     * Lagrangian point since the last call to endDataRedistribution() is
+     * returned in units of the grid spacing of the level on which the point is
+     * stored.  The fraction of Lagrangian points whose interaction stencils,
+     * grown by \a edge_width cells, are not covered by the level on which the
+     * points are stored is also returned.
+     *
+     * A default implementation is provided that sets both values to -1.0,
+     * indicating that these statistics are not available.
+     */
+    virtual void computeRegridDisplacementStatistics(double& max_displacement,
+                                                     double& edge_fraction,
+                                                     int edge_width);
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
@@ -194,6 +194,14 @@ public:
      */
     void computeLagrangianForce(double data_time);
 
+    /*!
+     * Compute the time average of the Lagrangian force over the current time
+     * interval using the specified number of substeps, and store the result as
+     * the Lagrangian force at the specified time within the current time
+     * interval.
+     */
+    void computeSubcycledLagrangianForce(double current_time, double new_time, int num_substeps, double data_time);
+
     /*!
      * Spread the Lagrangian force to the Cartesian grid at the specified time
      * within the current time interval.
@@ -202,7 +210,8 @@ public:
     spreadForce(int f_data_idx,
                 IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
-                double data_time);
+                double data_time,
+                bool f_data_is_zero = false);
 
     /*!
      * Indicate whether there are any internal fluid sources/sinks.
@@ -295,6 +304,13 @@ public:
     void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Compute statistics that are used to determine whether the patch
+     * hierarchy should be regridded.  The returned values are the maximum
+     * values reported by the individual strategy objects.
+     */
+    void computeRegridDisplacementStatistics(double& max_displacement, double& edge_fraction, int edge_width);
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
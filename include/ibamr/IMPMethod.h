@@ -47,6 +47,7 @@
 #include "ibamr/IBStrategy.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/SpreadAccumulator.h"
 #include "libmesh/id_types.h"
 #include "tbox/Pointer.h"
 
@@ -218,7 +219,8 @@ public:
     spreadForce(int f_data_idx,
                 IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
-                double data_time);
+                double data_time,
+                bool f_data_is_zero = false);
 
     /*!
      * Initialize Lagrangian data corresponding to the given AMR patch hierarchy
@@ -347,6 +349,11 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > d_gridding_alg;
 
+    /*
+     * Data used to accumulate values spread to the Cartesian grid.
+     */
+    IBTK::SpreadAccumulator d_spread_accumulator;
+
     /*
      * The current time step interval.
      */
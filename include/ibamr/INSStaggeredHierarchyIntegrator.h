@@ -51,6 +51,7 @@
 #include "ibamr/StaggeredStokesSolver.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibtk/SideDataSynchronization.h"
+#include "ibtk/SolutionHistoryExtrapolator.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -352,6 +353,13 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*
+     * Extrapolation of initial guesses for the Stokes solver from the
+     * solutions computed during previous time steps.
+     */
+    int d_stokes_initial_guess_extrapolation_order;
+    SAMRAI::tbox::Pointer<IBTK::SolutionHistoryExtrapolator> d_stokes_solution_history;
+
     /*!
      * Fluid solver variables.
      */
@@ -77,6 +77,25 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * By default, the boxes are single grid cells.  When smoother_type is set to
+ * "PATCH_SCHWARZ", the boxes are instead the local patches of each level, so
+ * that the smoother is a non-overlapping Schwarz method with patch subdomains.
+ * Each patch operator is factored once when the operator state is initialized,
+ * and the factorization is reused until the operator state is deallocated,
+ * e.g. on regrid.
+ *
+ * \note Overlapping patch subdomains are not supported by this smoother,
+ * because the residual is not available in the ghost cell region of each
+ * patch.  Overlapping Schwarz methods are instead provided by the PETSc level
+ * solvers (see IBTK::PETScLevelSolver), which may be used as coarse level
+ * solvers.
+ *
+ * \note Unlike the Poisson point relaxation FAC operators (see
+ * IBTK::PoissonFACPreconditionerStrategy::setUseSinglePrecisionSmoother()),
+ * this class does not provide a single-precision smoother.  The box and patch
+ * operators are assembled and solved using double-precision PETSc matrices and
+ * vectors.
 */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -170,6 +189,14 @@ private:
     std::vector<Vec> d_box_e, d_box_r;
     std::vector<KSP> d_box_ksp;
 
+    /*
+     * Patch operator data, used when smoother_type is "PATCH_SCHWARZ".
+     */
+    bool d_use_patch_schwarz_smoother;
+    std::vector<std::vector<Mat> > d_patch_op;
+    std::vector<std::vector<Vec> > d_patch_e, d_patch_r;
+    std::vector<std::vector<KSP> > d_patch_ksp;
+
     /*
      * Mappings from patch indices to patch operators.
      */
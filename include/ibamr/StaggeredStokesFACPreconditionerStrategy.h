@@ -105,7 +105,14 @@ namespace IBAMR
  coarse_solver_db = { ... }                     // SAMRAI::tbox::Database for initializing
  coarse
  level solver
+ coarse_solver_agglomeration_num_procs = 0      // gather the coarsest level onto this many processes
+ coarse_solver_agglomeration_pc_type = "lu"     // solver used on the gathered coarsest level
  \endverbatim
+ *
+ * When coarse_solver_agglomeration_num_procs is positive and the coarse level
+ * solver is a PETSc level solver, the coarsest level system is gathered onto
+ * subcommunicators of the specified number of processes and solved there.
+ * \see IBTK::PETScLevelSolver
 */
 class StaggeredStokesFACPreconditionerStrategy : public IBTK::FACPreconditionerStrategy
 {
@@ -349,6 +356,12 @@ protected:
      */
     virtual void deallocateOperatorStateSpecialized(int coarsest_reset_ln, int finest_reset_ln) = 0;
 
+    /*!
+     * \brief Add the coarsest level agglomeration settings to the database
+     * used to initialize the coarse level solver.
+     */
+    void setCoarseSolverAgglomerationOptions();
+
     /*!
      * \name Methods for executing, caching, and resetting communication
      * schedules.
@@ -463,6 +476,8 @@ protected:
     int d_coarse_solver_max_iterations;
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_coarse_solver;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_coarse_solver_db;
+    int d_coarse_solver_agglomeration_num_procs;
+    std::string d_coarse_solver_agglomeration_pc_type;
 
     //\}
 
@@ -138,6 +138,12 @@ protected:
                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b,
                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 
+    /*!
+     * \brief Generate the locally owned DOF indices of each local patch, which
+     * are used as the Schwarz subdomains.
+     */
+    void generateSchwarzSubdomains(std::vector<std::vector<int> >& subdomain_dofs);
+
 private:
     /*!
      * \brief Default constructor.
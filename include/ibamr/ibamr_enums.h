@@ -157,6 +157,8 @@ enum TimeSteppingType
     FORWARD_EULER,
     MIDPOINT_RULE,
     TRAPEZOIDAL_RULE,
+    SSPRK3,
+    RK4,
     UNKNOWN_TIME_STEPPING_TYPE = -1
 };
 
@@ -169,6 +171,8 @@ inline TimeSteppingType string_to_enum<TimeSteppingType>(const std::string& val)
     if (strcasecmp(val.c_str(), "MIDPOINT_RULE") == 0) return MIDPOINT_RULE;
     if (strcasecmp(val.c_str(), "TRAPEZOIDAL_RULE") == 0) return TRAPEZOIDAL_RULE;
     if (strcasecmp(val.c_str(), "CRANK_NICOLSON") == 0) return TRAPEZOIDAL_RULE;
+    if (strcasecmp(val.c_str(), "SSPRK3") == 0) return SSPRK3;
+    if (strcasecmp(val.c_str(), "RK4") == 0) return RK4;
     return UNKNOWN_TIME_STEPPING_TYPE;
 } // string_to_enum
 
@@ -180,6 +184,8 @@ inline std::string enum_to_string<TimeSteppingType>(TimeSteppingType val)
     if (val == FORWARD_EULER) return "FORWARD_EULER";
     if (val == MIDPOINT_RULE) return "MIDPOINT_RULE";
     if (val == TRAPEZOIDAL_RULE) return "TRAPEZOIDAL_RULE";
+    if (val == SSPRK3) return "SSPRK3";
+    if (val == RK4) return "RK4";
     return "UNKNOWN_TIME_STEPPING_TYPE";
 } // enum_to_string
 
@@ -193,6 +199,8 @@ inline bool is_multistep_time_stepping_type(TimeSteppingType val)
     case FORWARD_EULER:
     case MIDPOINT_RULE:
     case TRAPEZOIDAL_RULE:
+    case SSPRK3:
+    case RK4:
         return false;
     default:
         TBOX_ERROR("is_multistep_time_stepping_type(): unknown time stepping type\n");
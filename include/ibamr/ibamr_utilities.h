@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/TimerTreeManager.h" // IWYU pragma: export
 #include "tbox/PIO.h"
 
 /////////////////////////////// MACRO DEFINITIONS ////////////////////////////
@@ -89,13 +90,20 @@ static const bool ENABLE_TIMERS = true;
 #define IBAMR_TIMER_START(timer)                                                                                       \
     do                                                                                                                 \
     {                                                                                                                  \
-        if (IBAMR::ENABLE_TIMERS) timer->start();                                                                      \
+        if (IBAMR::ENABLE_TIMERS && IBTK::TimerTreeManager::isEnabled()) IBTK::TimerTreeManager::startTimer(timer);    \
+    } while (0);
+
+#define IBAMR_TIMER_START_LEVEL(timer, level_number)                                                                   \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (IBAMR::ENABLE_TIMERS && IBTK::TimerTreeManager::isEnabled())                                               \
+            IBTK::TimerTreeManager::startTimer(timer, level_number);                                                   \
     } while (0);
 
 #define IBAMR_TIMER_STOP(timer)                                                                                        \
     do                                                                                                                 \
     {                                                                                                                  \
-        if (IBAMR::ENABLE_TIMERS) timer->stop();                                                                       \
+        if (IBAMR::ENABLE_TIMERS) IBTK::TimerTreeManager::stopTimer(timer);                                            \
     } while (0);
 
 /////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
@@ -0,0 +1,28 @@
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CONFIGURE_OPENMP],[
+echo
+echo "==================================="
+echo "Configuring optional OpenMP support"
+echo "==================================="
+
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING(--enable-openmp,enable OpenMP threading within each MPI process @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  OPENMP_ENABLED=yes ;;
+                    no)   OPENMP_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-openmp=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[OPENMP_ENABLED=no])
+
+if test "$OPENMP_ENABLED" = yes; then
+  AC_OPENMP
+  if test "$ac_cv_prog_cxx_openmp" = unsupported ; then
+    AC_MSG_ERROR([--enable-openmp is specified, but the C++ compiler does not support OpenMP])
+  fi
+  CXXFLAGS="$CXXFLAGS $OPENMP_CXXFLAGS"
+  AC_MSG_NOTICE([Optional OpenMP support is ENABLED])
+else
+  AC_MSG_NOTICE([Optional OpenMP support is DISABLED])
+fi
+
+])
@@ -507,9 +507,10 @@ void GeneralizedIBMethod::computeLagrangianForce(const double data_time)
 void GeneralizedIBMethod::spreadForce(const int f_data_idx,
                                       RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                                       const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
-                                      const double data_time)
+                                      const double data_time,
+                                      const bool f_data_is_zero)
 {
-    IBMethod::spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time);
+    IBMethod::spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time, f_data_is_zero);
 
     std::vector<Pointer<LData> >* N_data = NULL;
     bool* N_needs_ghost_fill = NULL;
@@ -542,7 +543,10 @@ void GeneralizedIBMethod::spreadForce(const int f_data_idx,
                              std::vector<Pointer<RefineSchedule<NDIM> > >(),
                              data_time,
                              *N_needs_ghost_fill,
-                             *X_LE_needs_ghost_fill);
+                             *X_LE_needs_ghost_fill,
+                             /*coarsest_ln*/ -1,
+                             /*finest_ln*/ -1,
+                             /*f_data_is_zero*/ true);
     *N_needs_ghost_fill = false;
     *X_LE_needs_ghost_fill = false;
     const int coarsest_ln = 0;
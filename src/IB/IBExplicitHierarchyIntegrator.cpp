@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <algorithm>
+#include <cmath>
 #include <deque>
 #include <ostream>
 #include <string>
@@ -87,7 +88,7 @@ namespace IBAMR
 namespace
 {
 // Version of IBExplicitHierarchyIntegrator restart file data.
-static const int IB_EXPLICIT_HIERARCHY_INTEGRATOR_VERSION = 2;
+static const int IB_EXPLICIT_HIERARCHY_INTEGRATOR_VERSION = 3;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -97,11 +98,15 @@ IBExplicitHierarchyIntegrator::IBExplicitHierarchyIntegrator(const std::string&
                                                              Pointer<IBStrategy> ib_method_ops,
                                                              Pointer<INSHierarchyIntegrator> ins_hier_integrator,
                                                              bool register_for_restart)
-    : IBHierarchyIntegrator(object_name, input_db, ib_method_ops, ins_hier_integrator, register_for_restart)
+    : IBHierarchyIntegrator(object_name, input_db, ib_method_ops, ins_hier_integrator, register_for_restart),
+      d_use_lagrangian_subcycling(false), d_use_automatic_lagrangian_substeps(false), d_num_lagrangian_substeps(1),
+      d_max_num_lagrangian_substeps(100), d_current_num_lagrangian_substeps(1),
+      d_lagrangian_substep_cfl(0.25), d_u_max_over_dx(0.0)
 {
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
+    if (input_db) getFromInput(input_db, from_restart);
     return;
 } // IBExplicitHierarchyIntegrator
 
@@ -161,6 +166,16 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
     // Initialize IB data.
     d_ib_method_ops->preprocessIntegrateData(current_time, new_time, num_cycles);
 
+    // Determine the number of substeps to use to time-average the Lagrangian
+    // force.
+    if (d_use_lagrangian_subcycling)
+    {
+        d_current_num_lagrangian_substeps = computeNumberOfLagrangianSubsteps(dt);
+        if (d_enable_logging)
+            plog << d_object_name << "::preprocessIntegrateHierarchy(): number of Lagrangian force substeps = "
+                 << d_current_num_lagrangian_substeps << "\n";
+    }
+
     // Initialize the fluid solver.
     const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
     if (ins_num_cycles != d_current_num_cycles && d_current_num_cycles != 1)
@@ -173,6 +188,7 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
                                     "use the same number of cycles,\n"
                                  << "  or that the IB solver use only a single cycle.\n");
     }
+
     d_ins_hier_integrator->preprocessIntegrateHierarchy(current_time, new_time, ins_num_cycles);
 
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
@@ -180,6 +196,9 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
     {
     case FORWARD_EULER:
     case TRAPEZOIDAL_RULE:
+        // NOTE: When the Lagrangian force is time-averaged, the averaged
+        // force is computed in integrateHierarchy().
+        if (d_use_lagrangian_subcycling) break;
         if (d_enable_logging) plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
         d_ib_method_ops->computeLagrangianForce(current_time);
         if (d_enable_logging)
@@ -188,7 +207,8 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
         d_ib_method_ops->spreadForce(
-            d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), current_time);
+            d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), current_time,
+            /*f_data_is_zero*/ true);
         d_hier_velocity_data_ops->copyData(d_f_current_idx, d_f_idx);
         break;
     case MIDPOINT_RULE:
@@ -249,54 +269,85 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                                                                d_ins_hier_integrator->getNewContext());
 
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
-    switch (d_time_stepping_type)
+    if (d_use_lagrangian_subcycling)
     {
-    case FORWARD_EULER:
-        if (cycle_num > 0)
+        // NOTE: The substeps follow the present prediction of the updated
+        // positions of the Lagrangian structure, which has not yet been
+        // computed when multiple cycles are used.
+        if (d_current_num_cycles > 1 && cycle_num == 0)
         {
-            IBAMR_DO_ONCE(
-                {
-                    pout << "IBExplicitHierarchyIntegrator::integrateHierarchy():\n"
-                         << "  WARNING: time_stepping_type = " << enum_to_string<TimeSteppingType>(d_time_stepping_type)
-                         << " but num_cycles = " << d_current_num_cycles << " > 1.\n";
-                });
+            if (d_enable_logging)
+                plog << d_object_name << "::integrateHierarchy(): performing Lagrangian forward Euler step\n";
+            d_ib_method_ops->eulerStep(current_time, new_time);
         }
-        break;
-    case MIDPOINT_RULE:
-        if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
-        d_ib_method_ops->computeLagrangianForce(half_time);
+        if (d_enable_logging)
+            plog << d_object_name << "::integrateHierarchy(): computing time-averaged Lagrangian force using "
+                 << d_current_num_lagrangian_substeps << " substeps\n";
+        d_ib_method_ops->computeSubcycledLagrangianForce(
+            current_time, new_time, d_current_num_lagrangian_substeps, half_time);
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
         d_ib_method_ops->spreadForce(
-            d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
-        break;
-    case TRAPEZOIDAL_RULE:
-        if (d_current_num_cycles == 1 || cycle_num > 0)
+            d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time,
+            /*f_data_is_zero*/ true);
+    }
+    else
+    {
+        switch (d_time_stepping_type)
         {
-            // NOTE: If (current_num_cycles > 1 && cycle_num == 0), the
-            // force computed here would be the same as that computed above
-            // in preprocessIntegrateHierarchy(), so we don't bother to
-            // recompute it.
+        case FORWARD_EULER:
+            if (cycle_num > 0)
+            {
+                IBAMR_DO_ONCE(
+                    {
+                        pout << "IBExplicitHierarchyIntegrator::integrateHierarchy():\n"
+                             << "  WARNING: time_stepping_type = "
+                             << enum_to_string<TimeSteppingType>(d_time_stepping_type)
+                             << " but num_cycles = " << d_current_num_cycles << " > 1.\n";
+                    });
+            }
+            break;
+        case MIDPOINT_RULE:
             if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
-            d_ib_method_ops->computeLagrangianForce(new_time);
+            d_ib_method_ops->computeLagrangianForce(half_time);
             if (d_enable_logging)
-                plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force "
-                                         "to the Eulerian grid\n";
+                plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
             d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
             d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
             d_ib_method_ops->spreadForce(
-                d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), new_time);
-            d_hier_velocity_data_ops->linearSum(d_f_idx, 0.5, d_f_current_idx, 0.5, d_f_idx);
+                d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time,
+                /*f_data_is_zero*/ true);
+            break;
+        case TRAPEZOIDAL_RULE:
+            if (d_current_num_cycles == 1 || cycle_num > 0)
+            {
+                // NOTE: If (current_num_cycles > 1 && cycle_num == 0), the
+                // force computed here would be the same as that computed above
+                // in preprocessIntegrateHierarchy(), so we don't bother to
+                // recompute it.
+                if (d_enable_logging)
+                    plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+                d_ib_method_ops->computeLagrangianForce(new_time);
+                if (d_enable_logging)
+                    plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force "
+                                             "to the Eulerian grid\n";
+                d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
+                d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+                d_ib_method_ops->spreadForce(
+                    d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), new_time,
+                    /*f_data_is_zero*/ true);
+                d_hier_velocity_data_ops->linearSum(d_f_idx, 0.5, d_f_current_idx, 0.5, d_f_idx);
+            }
+            break;
+        default:
+            TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
+                                     << "  unsupported time stepping type: "
+                                     << enum_to_string<TimeSteppingType>(d_time_stepping_type) << "\n"
+                                     << "  supported time stepping types are: FORWARD_EULER, "
+                                        "MIDPOINT_RULE, TRAPEZOIDAL_RULE\n");
         }
-        break;
-    default:
-        TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
-                                 << "  unsupported time stepping type: "
-                                 << enum_to_string<TimeSteppingType>(d_time_stepping_type) << "\n"
-                                 << "  supported time stepping types are: FORWARD_EULER, "
-                                    "MIDPOINT_RULE, TRAPEZOIDAL_RULE\n");
     }
 
     // Compute the Lagrangian source/sink strengths and spread them to the
@@ -450,6 +501,9 @@ void IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double c
                                          getGhostfillRefineSchedules(d_object_name + "::u"),
                                          new_time);
 
+    // Advance the Lagrangian markers.
+    advanceMarkers(current_time, new_time);
+
     // Synchronize new state data.
     if (!skip_synchronize_new_state_data)
     {
@@ -482,6 +536,7 @@ void IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double c
     }
     cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
     d_regrid_cfl_estimate += cfl_max;
+    d_u_max_over_dx = cfl_max / dt;
     if (d_enable_logging)
         plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
     if (d_enable_logging)
@@ -496,6 +551,10 @@ void IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double c
     // Deallocate IB data.
     d_ib_method_ops->postprocessIntegrateData(current_time, new_time, num_cycles);
 
+    // Update the Lagrangian displacement statistics used to determine when to
+    // regrid.
+    updateRegridDisplacementStatistics();
+
     // Deallocate Eulerian scratch data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -537,11 +596,55 @@ void IBExplicitHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> d
 {
     IBHierarchyIntegrator::putToDatabaseSpecialized(db);
     db->putInteger("IB_EXPLICIT_HIERARCHY_INTEGRATOR_VERSION", IB_EXPLICIT_HIERARCHY_INTEGRATOR_VERSION);
+    db->putDouble("d_u_max_over_dx", d_u_max_over_dx);
     return;
 } // putToDatabaseSpecialized
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+int IBExplicitHierarchyIntegrator::computeNumberOfLagrangianSubsteps(const double dt)
+{
+    if (!d_use_automatic_lagrangian_substeps) return d_num_lagrangian_substeps;
+    int num_substeps = d_num_lagrangian_substeps;
+
+    // Restrict the substep size so that the structure moves no more than the
+    // specified fraction of a meshwidth during each substep, using the fluid
+    // velocity from the preceding time step.
+    if (d_lagrangian_substep_cfl > 0.0)
+    {
+        const double cfl_estimate = d_u_max_over_dx * dt;
+        num_substeps = std::max(num_substeps, static_cast<int>(std::ceil(cfl_estimate / d_lagrangian_substep_cfl)));
+    }
+    return std::min(num_substeps, d_max_num_lagrangian_substeps);
+} // computeNumberOfLagrangianSubsteps
+
+void IBExplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
+{
+    if (db->keyExists("num_lagrangian_substeps"))
+        d_num_lagrangian_substeps = db->getInteger("num_lagrangian_substeps");
+    if (db->keyExists("use_automatic_lagrangian_substeps"))
+        d_use_automatic_lagrangian_substeps = db->getBool("use_automatic_lagrangian_substeps");
+    if (db->keyExists("max_num_lagrangian_substeps"))
+        d_max_num_lagrangian_substeps = db->getInteger("max_num_lagrangian_substeps");
+    if (db->keyExists("lagrangian_substep_cfl")) d_lagrangian_substep_cfl = db->getDouble("lagrangian_substep_cfl");
+    if (d_num_lagrangian_substeps < 1 || d_max_num_lagrangian_substeps < d_num_lagrangian_substeps)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  invalid Lagrangian substep parameters: num_lagrangian_substeps = "
+                                 << d_num_lagrangian_substeps
+                                 << ", max_num_lagrangian_substeps = " << d_max_num_lagrangian_substeps << "\n");
+    }
+    d_use_lagrangian_subcycling = d_num_lagrangian_substeps > 1 || d_use_automatic_lagrangian_substeps;
+    d_current_num_lagrangian_substeps = d_num_lagrangian_substeps;
+    if (d_use_lagrangian_subcycling && d_time_stepping_type == FORWARD_EULER)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  Lagrangian force time-averaging is not supported for time_stepping_type = "
+                                 << enum_to_string<TimeSteppingType>(d_time_stepping_type) << "\n");
+    }
+    return;
+} // getFromInput
+
 void IBExplicitHierarchyIntegrator::getFromRestart()
 {
     Pointer<Database> restart_db = RestartManager::getManager()->getRootDatabase();
@@ -560,6 +663,7 @@ void IBExplicitHierarchyIntegrator::getFromRestart()
     {
         TBOX_ERROR(d_object_name << ":  Restart file version different than class version." << std::endl);
     }
+    d_u_max_over_dx = db->getDouble("d_u_max_over_dx");
     return;
 } // getFromRestart
 
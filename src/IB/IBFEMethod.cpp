@@ -49,8 +49,6 @@
 #include "CartesianPatchGeometry.h"
 #include "CellIndex.h"
 #include "GriddingAlgorithm.h"
-#include "HierarchyDataOpsManager.h"
-#include "HierarchyDataOpsReal.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -61,7 +59,6 @@
 #include "SideData.h"
 #include "SideIndex.h"
 #include "Variable.h"
-#include "VariableDatabase.h"
 #include "boost/multi_array.hpp"
 #include "ibamr/IBFEMethod.h"
 #include "ibamr/INSHierarchyIntegrator.h"
@@ -111,6 +108,10 @@
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 namespace SAMRAI
 {
 namespace xfer
@@ -190,6 +191,57 @@ inline bool has_physical_bdry(const Elem* elem,
     }
     return has_physical_bdry;
 }
+
+// Return the number of the calling thread within the enclosing force assembly
+// parallel region.
+inline int get_thread_num()
+{
+#if defined(_OPENMP)
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+// Determine the range of elements [elem_begin,elem_end) to be handled by the
+// calling thread when num_elems elements are partitioned into contiguous blocks
+// among the threads of the enclosing force assembly parallel region.
+inline void get_thread_elem_range(size_t& elem_begin, size_t& elem_end, const size_t num_elems)
+{
+#if defined(_OPENMP)
+    const size_t thread_num = omp_get_thread_num();
+    const size_t num_threads = omp_get_num_threads();
+#else
+    const size_t thread_num = 0;
+    const size_t num_threads = 1;
+#endif
+    elem_begin = (num_elems * thread_num) / num_threads;
+    elem_end = (num_elems * (thread_num + 1)) / num_threads;
+    return;
+}
+
+// Apply constraints to the elemental right-hand-side vectors and add them to
+// the global right-hand-side vector.  The elemental vectors are added in element
+// order, so that the result does not depend on the number of threads that were
+// used to compute them.
+inline void add_element_vectors(NumericVector<double>& G_rhs_vec,
+                                std::vector<DenseVector<double> >& G_rhs_elems,
+                                const std::vector<Elem*>& elems,
+                                const DofMap& dof_map)
+{
+    std::vector<unsigned int> dof_indices;
+    for (size_t e_idx = 0; e_idx < elems.size(); ++e_idx)
+    {
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            DenseVector<double>& G_rhs_e = G_rhs_elems[NDIM * e_idx + i];
+            dof_map.dof_indices(elems[e_idx], dof_indices, i);
+            dof_map.constrain_element_vector(G_rhs_e, dof_indices);
+            G_rhs_vec.add_vector(G_rhs_e, dof_indices);
+        }
+    }
+    return;
+}
 }
 
 const std::string IBFEMethod::COORDS_SYSTEM_NAME = "IB coordinates system";
@@ -704,7 +756,8 @@ void IBFEMethod::computeLagrangianForce(const double data_time)
 void IBFEMethod::spreadForce(const int f_data_idx,
                              RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                              const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
-                             const double data_time)
+                             const double data_time,
+                             const bool f_data_is_zero)
 {
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
     for (unsigned int part = 0; part < d_num_parts; ++part)
@@ -717,8 +770,10 @@ void IBFEMethod::spreadForce(const int f_data_idx,
         F_vec->localize(*F_ghost_vec);
         if (d_use_IB_spread_operator)
         {
+            // Only the first spread operation writes into data that are known
+            // to be zero.
             d_fe_data_managers[part]->spread(f_data_idx, *F_ghost_vec, *X_ghost_vec, FORCE_SYSTEM_NAME, f_phys_bdry_op,
-                                             data_time);
+                                             data_time, f_data_is_zero && part == 0);
         }
         else
         {
@@ -1051,9 +1106,20 @@ void IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
         lag_surface_force_fcn_data.push_back(system.current_local_solution.get());
     }
 
-    // Setup global and elemental right-hand-side vectors.
+    // Setup global and elemental right-hand-side vectors.  The elemental
+    // right-hand-side vectors are computed for all of the local elements before
+    // any of them are added to the global vector, so that they may be computed
+    // concurrently by the force assembly threads.
     AutoPtr<NumericVector<double> > G_rhs_vec = G_vec.zero_clone();
-    DenseVector<double> G_rhs_e[NDIM];
+    std::vector<Elem*> local_elems;
+    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        local_elems.push_back(*el_it);
+    }
+    const size_t num_local_elems = local_elems.size();
+    std::vector<DenseVector<double> > G_rhs_elems(NDIM * num_local_elems);
 
     // Extract the underlying solution data.
     PetscVector<double>* X_petsc_vec = dynamic_cast<PetscVector<double>*>(&X_vec);
@@ -1063,46 +1129,26 @@ void IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     double* X_local_soln;
     VecGetArray(X_local_vec, &X_local_soln);
 
+    // Extract the FE systems and DOF maps.
+    System& system = equation_systems->get_system(FORCE_SYSTEM_NAME);
+    const DofMap& dof_map = system.get_dof_map();
+    FEType fe_type = dof_map.variable_type(0);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        TBOX_ASSERT(dof_map.variable_type(d) == fe_type);
+    }
+    System& X_system = equation_systems->get_system(COORDS_SYSTEM_NAME);
+    const DofMap& X_dof_map = X_system.get_dof_map();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        TBOX_ASSERT(X_dof_map.variable_type(d) == fe_type);
+    }
+
     // First handle the stress contributions.
     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
     {
         if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
 
-        AutoPtr<QBase> qrule =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
-        AutoPtr<QBase> qrule_face =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim - 1, d_PK1_stress_fcn_data[part][k].quad_order);
-
-        // Extract the FE systems and DOF maps, and setup the FE objects.
-        System& system = equation_systems->get_system(FORCE_SYSTEM_NAME);
-        const DofMap& dof_map = system.get_dof_map();
-        std::vector<std::vector<unsigned int> > dof_indices(NDIM);
-        FEType fe_type = dof_map.variable_type(0);
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            TBOX_ASSERT(dof_map.variable_type(d) == fe_type);
-        }
-        AutoPtr<FEBase> fe(FEBase::build(dim, fe_type));
-        fe->attach_quadrature_rule(qrule.get());
-        const std::vector<libMesh::Point>& q_point = fe->get_xyz();
-        const std::vector<double>& JxW = fe->get_JxW();
-        const std::vector<std::vector<double> >& phi = fe->get_phi();
-        const std::vector<std::vector<VectorValue<double> > >& dphi = fe->get_dphi();
-        AutoPtr<FEBase> fe_face(FEBase::build(dim, fe_type));
-        fe_face->attach_quadrature_rule(qrule_face.get());
-        const std::vector<libMesh::Point>& q_point_face = fe_face->get_xyz();
-        const std::vector<double>& JxW_face = fe_face->get_JxW();
-        const std::vector<libMesh::Point>& normal_face = fe_face->get_normals();
-        const std::vector<std::vector<double> >& phi_face = fe_face->get_phi();
-        const std::vector<std::vector<VectorValue<double> > >& dphi_face = fe_face->get_dphi();
-
-        System& X_system = equation_systems->get_system(COORDS_SYSTEM_NAME);
-        const DofMap& X_dof_map = X_system.get_dof_map();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            TBOX_ASSERT(X_dof_map.variable_type(d) == fe_type);
-        }
-
         // Loop over the elements to compute the right-hand side vector.  This
         // is computed via
         //
@@ -1110,270 +1156,289 @@ void IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
         //
         // This right-hand side vector is used to solve for the nodal values of
         // the interior elastic force density.
-        TensorValue<double> PP, FF, FF_inv_trans;
-        VectorValue<double> F, F_qp, n;
-        libMesh::Point X_qp;
-        boost::multi_array<double, 2> X_node;
-        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+        //
+        // Each force assembly thread uses its own FE objects and work arrays
+        // and computes the elemental right-hand-side vectors for a contiguous
+        // block of the local elements.
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(d_num_force_assembly_threads)
+#endif
         {
-            Elem* const elem = *el_it;
-            fe->reinit(elem);
-            for (unsigned int d = 0; d < NDIM; ++d)
+            AutoPtr<QBase> qrule = QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim,
+                                                d_PK1_stress_fcn_data[part][k].quad_order);
+            AutoPtr<QBase> qrule_face = QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim - 1,
+                                                     d_PK1_stress_fcn_data[part][k].quad_order);
+
+            // Setup the FE objects.
+            std::vector<std::vector<unsigned int> > dof_indices(NDIM);
+            AutoPtr<FEBase> fe(FEBase::build(dim, fe_type));
+            fe->attach_quadrature_rule(qrule.get());
+            const std::vector<libMesh::Point>& q_point = fe->get_xyz();
+            const std::vector<double>& JxW = fe->get_JxW();
+            const std::vector<std::vector<double> >& phi = fe->get_phi();
+            const std::vector<std::vector<VectorValue<double> > >& dphi = fe->get_dphi();
+            AutoPtr<FEBase> fe_face(FEBase::build(dim, fe_type));
+            fe_face->attach_quadrature_rule(qrule_face.get());
+            const std::vector<libMesh::Point>& q_point_face = fe_face->get_xyz();
+            const std::vector<double>& JxW_face = fe_face->get_JxW();
+            const std::vector<libMesh::Point>& normal_face = fe_face->get_normals();
+            const std::vector<std::vector<double> >& phi_face = fe_face->get_phi();
+            const std::vector<std::vector<VectorValue<double> > >& dphi_face = fe_face->get_dphi();
+
+            TensorValue<double> PP, FF, FF_inv_trans;
+            VectorValue<double> F, F_qp, n;
+            libMesh::Point X_qp;
+            boost::multi_array<double, 2> X_node;
+            size_t elem_begin, elem_end;
+            get_thread_elem_range(elem_begin, elem_end, num_local_elems);
+            for (size_t e_idx = elem_begin; e_idx < elem_end; ++e_idx)
             {
-                dof_map.dof_indices(elem, dof_indices[d], d);
-                G_rhs_e[d].resize(static_cast<int>(dof_indices[d].size()));
-            }
-            const unsigned int n_qp = qrule->n_points();
-            const size_t n_basis = dof_indices[0].size();
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
-            {
-                const libMesh::Point& s_qp = q_point[qp];
-                interpolate(X_qp, qp, X_node, phi);
-                jacobian(FF, qp, X_node, dphi);
-
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                d_PK1_stress_fcn_data[part][k].fcn(PP, FF, X_qp, s_qp, elem, PK1_stress_fcn_data[k], data_time,
-                                                   d_PK1_stress_fcn_data[part][k].ctx);
-                for (unsigned int k = 0; k < n_basis; ++k)
+                Elem* const elem = local_elems[e_idx];
+                DenseVector<double>* const G_rhs_e = &G_rhs_elems[NDIM * e_idx];
+                fe->reinit(elem);
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    F_qp = -PP * dphi[k][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        G_rhs_e[i](k) += F_qp(i);
-                    }
+                    dof_map.dof_indices(elem, dof_indices[d], d);
+                    G_rhs_e[d].resize(static_cast<int>(dof_indices[d].size()));
                 }
-            }
-
-            // Loop over the element boundaries.
-            for (unsigned short int side = 0; side < elem->n_sides(); ++side)
-            {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
-
-                // Determine if we need to compute surface forces along this
-                // part of the physical boundary; if not, skip the present side.
-                const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, dof_map);
-                const bool compute_transmission_force =
-                    (d_split_forces && !at_dirichlet_bdry) || (!d_split_forces && at_dirichlet_bdry);
-                if (!compute_transmission_force) continue;
-
-                fe_face->reinit(elem, side);
-                const unsigned int n_qp = qrule_face->n_points();
+                const unsigned int n_qp = qrule->n_points();
                 const size_t n_basis = dof_indices[0].size();
                 get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    const libMesh::Point& s_qp = q_point_face[qp];
-                    interpolate(X_qp, qp, X_node, phi_face);
-                    jacobian(FF, qp, X_node, dphi_face);
-                    F.zero();
+                    const libMesh::Point& s_qp = q_point[qp];
+                    interpolate(X_qp, qp, X_node, phi);
+                    jacobian(FF, qp, X_node, dphi);
 
                     // Compute the value of the first Piola-Kirchhoff stress
                     // tensor at the quadrature point and add the corresponding
-                    // force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
-                    {
-                        d_PK1_stress_fcn_data[part][k].fcn(PP, FF, X_qp, s_qp, elem, PK1_stress_fcn_data[k], data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
-                    }
-
-                    // If we are imposing jump conditions, then we keep only the
-                    // normal part of the force.  This has the effect of
-                    // projecting the tangential part of the surface force (but
-                    // not the normal part) onto the interior force density.
-                    if (d_use_jump_conditions && d_split_forces && !at_dirichlet_bdry)
-                    {
-                        tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-                        n = (FF_inv_trans * normal_face[qp]).unit();
-                        F = (F * n) * n;
-                    }
-
-                    // Add the boundary forces to the right-hand-side vector.
+                    // forces to the right-hand-side vector.
+                    d_PK1_stress_fcn_data[part][k].fcn(PP, FF, X_qp, s_qp, elem, PK1_stress_fcn_data[k], data_time,
+                                                       d_PK1_stress_fcn_data[part][k].ctx);
                     for (unsigned int k = 0; k < n_basis; ++k)
                     {
-                        F_qp = phi_face[k][qp] * JxW_face[qp] * F;
+                        F_qp = -PP * dphi[k][qp] * JxW[qp];
                         for (unsigned int i = 0; i < NDIM; ++i)
                         {
                             G_rhs_e[i](k) += F_qp(i);
                         }
                     }
                 }
-            }
 
-            // Apply constraints (e.g., enforce periodic boundary conditions)
-            // and add the elemental contributions to the global vector.
-            for (unsigned int i = 0; i < NDIM; ++i)
-            {
-                dof_map.constrain_element_vector(G_rhs_e[i], dof_indices[i]);
-                G_rhs_vec->add_vector(G_rhs_e[i], dof_indices[i]);
+                // Loop over the element boundaries.
+                for (unsigned short int side = 0; side < elem->n_sides(); ++side)
+                {
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
+
+                    // Determine if we need to compute surface forces along this
+                    // part of the physical boundary; if not, skip the present
+                    // side.
+                    const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, dof_map);
+                    const bool compute_transmission_force =
+                        (d_split_forces && !at_dirichlet_bdry) || (!d_split_forces && at_dirichlet_bdry);
+                    if (!compute_transmission_force) continue;
+
+                    fe_face->reinit(elem, side);
+                    const unsigned int n_qp = qrule_face->n_points();
+                    const size_t n_basis = dof_indices[0].size();
+                    get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        const libMesh::Point& s_qp = q_point_face[qp];
+                        interpolate(X_qp, qp, X_node, phi_face);
+                        jacobian(FF, qp, X_node, dphi_face);
+                        F.zero();
+
+                        // Compute the value of the first Piola-Kirchhoff stress
+                        // tensor at the quadrature point and add the
+                        // corresponding force to the right-hand-side vector.
+                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        {
+                            d_PK1_stress_fcn_data[part][k].fcn(PP, FF, X_qp, s_qp, elem, PK1_stress_fcn_data[k],
+                                                               data_time, d_PK1_stress_fcn_data[part][k].ctx);
+                            F += PP * normal_face[qp];
+                        }
+
+                        // If we are imposing jump conditions, then we keep only
+                        // the normal part of the force.  This has the effect of
+                        // projecting the tangential part of the surface force
+                        // (but not the normal part) onto the interior force
+                        // density.
+                        if (d_use_jump_conditions && d_split_forces && !at_dirichlet_bdry)
+                        {
+                            tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                            n = (FF_inv_trans * normal_face[qp]).unit();
+                            F = (F * n) * n;
+                        }
+
+                        // Add the boundary forces to the right-hand-side vector.
+                        for (unsigned int k = 0; k < n_basis; ++k)
+                        {
+                            F_qp = phi_face[k][qp] * JxW_face[qp] * F;
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                G_rhs_e[i](k) += F_qp(i);
+                            }
+                        }
+                    }
+                }
             }
         }
+
+        // Apply constraints (e.g., enforce periodic boundary conditions) and
+        // add the elemental contributions to the global vector.
+        add_element_vectors(*G_rhs_vec, G_rhs_elems, local_elems, dof_map);
     }
 
     // Now account for any body or surface force contributions.
     if (d_lag_body_force_fcn_data[part].fcn || d_lag_surface_pressure_fcn_data[part].fcn ||
         d_lag_surface_force_fcn_data[part].fcn)
     {
-        AutoPtr<QBase> qrule = QBase::build(d_quad_type, dim, d_quad_order);
-        AutoPtr<QBase> qrule_face = QBase::build(d_quad_type, dim - 1, d_quad_order);
-
-        // Extract the FE systems and DOF maps, and setup the FE objects.
-        System& system = equation_systems->get_system(FORCE_SYSTEM_NAME);
-        const DofMap& dof_map = system.get_dof_map();
-        std::vector<std::vector<unsigned int> > dof_indices(NDIM);
-        FEType fe_type = dof_map.variable_type(0);
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            TBOX_ASSERT(dof_map.variable_type(d) == fe_type);
-        }
-        AutoPtr<FEBase> fe(FEBase::build(dim, fe_type));
-        fe->attach_quadrature_rule(qrule.get());
-        const std::vector<libMesh::Point>& q_point = fe->get_xyz();
-        const std::vector<double>& JxW = fe->get_JxW();
-        const std::vector<std::vector<double> >& phi = fe->get_phi();
-        const std::vector<std::vector<VectorValue<double> > >& dphi = fe->get_dphi();
-        AutoPtr<FEBase> fe_face(FEBase::build(dim, fe_type));
-        fe_face->attach_quadrature_rule(qrule_face.get());
-        const std::vector<libMesh::Point>& q_point_face = fe_face->get_xyz();
-        const std::vector<double>& JxW_face = fe_face->get_JxW();
-        const std::vector<libMesh::Point>& normal_face = fe_face->get_normals();
-        const std::vector<std::vector<double> >& phi_face = fe_face->get_phi();
-        const std::vector<std::vector<VectorValue<double> > >& dphi_face = fe_face->get_dphi();
-
-        System& X_system = equation_systems->get_system(COORDS_SYSTEM_NAME);
-        const DofMap& X_dof_map = X_system.get_dof_map();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            TBOX_ASSERT(X_dof_map.variable_type(d) == fe_type);
-        }
-
         // Loop over the elements to compute the right-hand side vector.
-        TensorValue<double> FF, FF_inv_trans;
-        VectorValue<double> F, F_b, F_s, F_qp, n;
-        libMesh::Point X_qp;
-        double P;
-        boost::multi_array<double, 2> X_node;
-        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(d_num_force_assembly_threads)
+#endif
         {
-            Elem* const elem = *el_it;
-            fe->reinit(elem);
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                dof_map.dof_indices(elem, dof_indices[d], d);
-                G_rhs_e[d].resize(static_cast<int>(dof_indices[d].size()));
-            }
-            const unsigned int n_qp = qrule->n_points();
-            const size_t n_basis = dof_indices[0].size();
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            AutoPtr<QBase> qrule = QBase::build(d_quad_type, dim, d_quad_order);
+            AutoPtr<QBase> qrule_face = QBase::build(d_quad_type, dim - 1, d_quad_order);
+
+            // Setup the FE objects.
+            std::vector<std::vector<unsigned int> > dof_indices(NDIM);
+            AutoPtr<FEBase> fe(FEBase::build(dim, fe_type));
+            fe->attach_quadrature_rule(qrule.get());
+            const std::vector<libMesh::Point>& q_point = fe->get_xyz();
+            const std::vector<double>& JxW = fe->get_JxW();
+            const std::vector<std::vector<double> >& phi = fe->get_phi();
+            const std::vector<std::vector<VectorValue<double> > >& dphi = fe->get_dphi();
+            AutoPtr<FEBase> fe_face(FEBase::build(dim, fe_type));
+            fe_face->attach_quadrature_rule(qrule_face.get());
+            const std::vector<libMesh::Point>& q_point_face = fe_face->get_xyz();
+            const std::vector<double>& JxW_face = fe_face->get_JxW();
+            const std::vector<libMesh::Point>& normal_face = fe_face->get_normals();
+            const std::vector<std::vector<double> >& phi_face = fe_face->get_phi();
+            const std::vector<std::vector<VectorValue<double> > >& dphi_face = fe_face->get_dphi();
+
+            TensorValue<double> FF, FF_inv_trans;
+            VectorValue<double> F, F_b, F_s, F_qp, n;
+            libMesh::Point X_qp;
+            double P;
+            boost::multi_array<double, 2> X_node;
+            size_t elem_begin, elem_end;
+            get_thread_elem_range(elem_begin, elem_end, num_local_elems);
+            for (size_t e_idx = elem_begin; e_idx < elem_end; ++e_idx)
             {
-                const libMesh::Point& s_qp = q_point[qp];
-                interpolate(X_qp, qp, X_node, phi);
-                jacobian(FF, qp, X_node, dphi);
-
-                if (d_lag_body_force_fcn_data[part].fcn)
+                Elem* const elem = local_elems[e_idx];
+                DenseVector<double>* const G_rhs_e = &G_rhs_elems[NDIM * e_idx];
+                fe->reinit(elem);
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    // Compute the value of the body force at the quadrature
-                    // point and add the corresponding forces to the
-                    // right-hand-side vector.
-                    d_lag_body_force_fcn_data[part].fcn(F_b, FF, X_qp, s_qp, elem, lag_body_force_fcn_data, data_time,
-                                                        d_lag_body_force_fcn_data[part].ctx);
-                    for (unsigned int k = 0; k < n_basis; ++k)
-                    {
-                        F_qp = phi[k][qp] * JxW[qp] * F_b;
-                        for (unsigned int i = 0; i < NDIM; ++i)
-                        {
-                            G_rhs_e[i](k) += F_qp(i);
-                        }
-                    }
+                    dof_map.dof_indices(elem, dof_indices[d], d);
+                    G_rhs_e[d].resize(static_cast<int>(dof_indices[d].size()));
                 }
-            }
-
-            // Loop over the element boundaries.
-            for (unsigned short int side = 0; side < elem->n_sides(); ++side)
-            {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
-
-                // Determine if we need to compute surface forces along this
-                // part of the physical boundary; if not, skip the present side.
-                const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, dof_map);
-                const bool compute_transmission_force = (!d_split_forces && !at_dirichlet_bdry);
-                if (!compute_transmission_force) continue;
-
-                fe_face->reinit(elem, side);
-                const unsigned int n_qp = qrule_face->n_points();
+                const unsigned int n_qp = qrule->n_points();
                 const size_t n_basis = dof_indices[0].size();
                 get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    const libMesh::Point& s_qp = q_point_face[qp];
-                    interpolate(X_qp, qp, X_node, phi_face);
-                    jacobian(FF, qp, X_node, dphi_face);
-                    const double J = std::abs(FF.det());
-                    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-                    F.zero();
+                    const libMesh::Point& s_qp = q_point[qp];
+                    interpolate(X_qp, qp, X_node, phi);
+                    jacobian(FF, qp, X_node, dphi);
 
-                    if (d_lag_surface_pressure_fcn_data[part].fcn)
+                    if (d_lag_body_force_fcn_data[part].fcn)
                     {
-                        // Compute the value of the pressure at the quadrature
-                        // point and add the corresponding force to the
+                        // Compute the value of the body force at the quadrature
+                        // point and add the corresponding forces to the
                         // right-hand-side vector.
-                        d_lag_surface_pressure_fcn_data[part].fcn(P, FF, X_qp, s_qp, elem, side,
-                                                                  lag_surface_pressure_fcn_data, data_time,
-                                                                  d_lag_surface_pressure_fcn_data[part].ctx);
-                        F -= P * J * FF_inv_trans * normal_face[qp];
+                        d_lag_body_force_fcn_data[part].fcn(F_b, FF, X_qp, s_qp, elem, lag_body_force_fcn_data,
+                                                            data_time, d_lag_body_force_fcn_data[part].ctx);
+                        for (unsigned int k = 0; k < n_basis; ++k)
+                        {
+                            F_qp = phi[k][qp] * JxW[qp] * F_b;
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                G_rhs_e[i](k) += F_qp(i);
+                            }
+                        }
                     }
+                }
 
-                    if (d_lag_surface_force_fcn_data[part].fcn)
+                // Loop over the element boundaries.
+                for (unsigned short int side = 0; side < elem->n_sides(); ++side)
+                {
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
+
+                    // Determine if we need to compute surface forces along this
+                    // part of the physical boundary; if not, skip the present
+                    // side.
+                    const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, dof_map);
+                    const bool compute_transmission_force = (!d_split_forces && !at_dirichlet_bdry);
+                    if (!compute_transmission_force) continue;
+
+                    fe_face->reinit(elem, side);
+                    const unsigned int n_qp = qrule_face->n_points();
+                    const size_t n_basis = dof_indices[0].size();
+                    get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
                     {
-                        // Compute the value of the surface force at the
-                        // quadrature point and add the corresponding force to
-                        // the right-hand-side vector.
-                        d_lag_surface_force_fcn_data[part].fcn(F_s, FF, X_qp, s_qp, elem, side,
-                                                               lag_surface_force_fcn_data, data_time,
-                                                               d_lag_surface_force_fcn_data[part].ctx);
-                        F += F_s;
-                    }
+                        const libMesh::Point& s_qp = q_point_face[qp];
+                        interpolate(X_qp, qp, X_node, phi_face);
+                        jacobian(FF, qp, X_node, dphi_face);
+                        const double J = std::abs(FF.det());
+                        tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                        F.zero();
 
-                    // If we are imposing jump conditions, then we keep only the
-                    // normal part of the force.  This has the effect of
-                    // projecting the tangential part of the surface force (but
-                    // not the normal part) onto the interior force density.
-                    if (d_use_jump_conditions && d_split_forces && !at_dirichlet_bdry)
-                    {
-                        n = (FF_inv_trans * normal_face[qp]).unit();
-                        F = (F * n) * n;
-                    }
+                        if (d_lag_surface_pressure_fcn_data[part].fcn)
+                        {
+                            // Compute the value of the pressure at the
+                            // quadrature point and add the corresponding force
+                            // to the right-hand-side vector.
+                            d_lag_surface_pressure_fcn_data[part].fcn(P, FF, X_qp, s_qp, elem, side,
+                                                                      lag_surface_pressure_fcn_data, data_time,
+                                                                      d_lag_surface_pressure_fcn_data[part].ctx);
+                            F -= P * J * FF_inv_trans * normal_face[qp];
+                        }
 
-                    // Add the boundary forces to the right-hand-side vector.
-                    for (unsigned int k = 0; k < n_basis; ++k)
-                    {
-                        F_qp = phi_face[k][qp] * JxW_face[qp] * F;
-                        for (unsigned int i = 0; i < NDIM; ++i)
+                        if (d_lag_surface_force_fcn_data[part].fcn)
                         {
-                            G_rhs_e[i](k) += F_qp(i);
+                            // Compute the value of the surface force at the
+                            // quadrature point and add the corresponding force
+                            // to the right-hand-side vector.
+                            d_lag_surface_force_fcn_data[part].fcn(F_s, FF, X_qp, s_qp, elem, side,
+                                                                   lag_surface_force_fcn_data, data_time,
+                                                                   d_lag_surface_force_fcn_data[part].ctx);
+                            F += F_s;
+                        }
+
+                        // If we are imposing jump conditions, then we keep only
+                        // the normal part of the force.  This has the effect of
+                        // projecting the tangential part of the surface force
+                        // (but not the normal part) onto the interior force
+                        // density.
+                        if (d_use_jump_conditions && d_split_forces && !at_dirichlet_bdry)
+                        {
+                            n = (FF_inv_trans * normal_face[qp]).unit();
+                            F = (F * n) * n;
+                        }
+
+                        // Add the boundary forces to the right-hand-side vector.
+                        for (unsigned int k = 0; k < n_basis; ++k)
+                        {
+                            F_qp = phi_face[k][qp] * JxW_face[qp] * F;
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                G_rhs_e[i](k) += F_qp(i);
+                            }
                         }
                     }
                 }
             }
-
-            // Apply constraints (e.g., enforce periodic boundary conditions)
-            // and add the elemental contributions to the global vector.
-            for (unsigned int i = 0; i < NDIM; ++i)
-            {
-                dof_map.constrain_element_vector(G_rhs_e[i], dof_indices[i]);
-                G_rhs_vec->add_vector(G_rhs_e[i], dof_indices[i]);
-            }
         }
+
+        // Apply constraints (e.g., enforce periodic boundary conditions) and
+        // add the elemental contributions to the global vector.
+        add_element_vectors(*G_rhs_vec, G_rhs_elems, local_elems, dof_map);
     }
 
     VecRestoreArray(X_local_vec, &X_local_soln);
@@ -1394,45 +1459,27 @@ void IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
-    // Make a copy of the Eulerian data.
-    Pointer<hier::Variable<NDIM> > f_var;
-    var_db->mapIndexToVariable(f_data_idx, f_var);
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
-    }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
-        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
+    // Prepare the Eulerian data to accumulate spread values.  The physical
+    // boundary operator overwrites values on the physical boundary, and so in
+    // that case the existing values are stored in scratch data.
+    const bool preserve_data = f_phys_bdry_op != NULL;
+    d_spread_accumulator.beginAccumulation(f_data_idx, d_hierarchy, coarsest_ln, finest_ln, preserve_data);
 
     // Extract the mesh.
     EquationSystems* equation_systems = d_fe_data_managers[part]->getEquationSystems();
     const MeshBase& mesh = equation_systems->get_mesh();
     const BoundaryInfo& boundary_info = *mesh.boundary_info;
     const unsigned int dim = mesh.mesh_dimension();
-    AutoPtr<QBase> qrule_face;
 
-    // Extract the FE systems and DOF maps, and setup the FE object.
+    // Extract the FE systems and DOF maps.
     System& system = equation_systems->get_system(FORCE_SYSTEM_NAME);
     const DofMap& dof_map = system.get_dof_map();
-    std::vector<std::vector<unsigned int> > dof_indices(NDIM);
-    std::vector<std::vector<unsigned int> > side_dof_indices(NDIM);
     FEType fe_type = dof_map.variable_type(0);
     for (unsigned int d = 0; d < NDIM; ++d)
     {
         TBOX_ASSERT(dof_map.variable_type(d) == fe_type);
     }
-    AutoPtr<FEBase> fe_face(FEBase::build(dim, fe_type));
-    const std::vector<libMesh::Point>& q_point_face = fe_face->get_xyz();
-    const std::vector<double>& JxW_face = fe_face->get_JxW();
-    const std::vector<libMesh::Point>& normal_face = fe_face->get_normals();
-    const std::vector<std::vector<double> >& phi_face = fe_face->get_phi();
-    const std::vector<std::vector<VectorValue<double> > >& dphi_face = fe_face->get_dphi();
 
     System& X_system = equation_systems->get_system(COORDS_SYSTEM_NAME);
     const DofMap& X_dof_map = X_system.get_dof_map();
@@ -1502,11 +1549,6 @@ void IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
     const std::vector<std::vector<Elem*> >& active_patch_element_map =
         d_fe_data_managers[part]->getActivePatchElementMap();
     const int level_num = d_fe_data_managers[part]->getLevelNumber();
-    TensorValue<double> PP, FF, FF_inv_trans;
-    VectorValue<double> F, F_s;
-    libMesh::Point X_qp;
-    double P;
-    boost::multi_array<double, 2> X_node, X_node_side;
     std::vector<double> T_bdry, X_bdry;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     int local_patch_num = 0;
@@ -1523,104 +1565,144 @@ void IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
         const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
         // Loop over the elements and compute the values to be spread and the
-        // positions of the quadrature points.
-        T_bdry.clear();
-        X_bdry.clear();
-        int qp_offset = 0;
-        for (size_t e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+        // positions of the quadrature points.  Each force assembly thread uses
+        // its own FE objects and work arrays, handles a contiguous block of the
+        // patch elements, and stores the computed values in its own buffers.
+        // The buffers are concatenated in thread order, so that the values are
+        // spread in the same order as they are when only one thread is used.
+        std::vector<std::vector<double> > T_bdry_thread(d_num_force_assembly_threads);
+        std::vector<std::vector<double> > X_bdry_thread(d_num_force_assembly_threads);
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(d_num_force_assembly_threads)
+#endif
         {
-            Elem* const elem = patch_elems[e_idx];
-            const bool touches_physical_bdry = has_physical_bdry(elem, boundary_info, dof_map);
-            if (!touches_physical_bdry) continue;
-
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                dof_map.dof_indices(elem, dof_indices[d], d);
-            }
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
-
-            // Loop over the element boundaries.
-            for (unsigned short int side = 0; side < elem->n_sides(); ++side)
+            std::vector<double>& T_bdry_local = T_bdry_thread[get_thread_num()];
+            std::vector<double>& X_bdry_local = X_bdry_thread[get_thread_num()];
+            std::vector<std::vector<unsigned int> > dof_indices(NDIM);
+            std::vector<std::vector<unsigned int> > side_dof_indices(NDIM);
+            AutoPtr<QBase> qrule_face;
+            AutoPtr<FEBase> fe_face(FEBase::build(dim, fe_type));
+            const std::vector<libMesh::Point>& q_point_face = fe_face->get_xyz();
+            const std::vector<double>& JxW_face = fe_face->get_JxW();
+            const std::vector<libMesh::Point>& normal_face = fe_face->get_normals();
+            const std::vector<std::vector<double> >& phi_face = fe_face->get_phi();
+            const std::vector<std::vector<VectorValue<double> > >& dphi_face = fe_face->get_dphi();
+            TensorValue<double> PP, FF, FF_inv_trans;
+            VectorValue<double> F, F_s;
+            libMesh::Point X_qp;
+            double P;
+            boost::multi_array<double, 2> X_node, X_node_side;
+            size_t elem_begin, elem_end;
+            get_thread_elem_range(elem_begin, elem_end, num_active_patch_elems);
+            int qp_offset = 0;
+            for (size_t e_idx = elem_begin; e_idx < elem_end; ++e_idx)
             {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
-
-                // Skip Dirichlet boundaries.
-                if (is_dirichlet_bdry(elem, side, boundary_info, dof_map)) continue;
+                Elem* const elem = patch_elems[e_idx];
+                const bool touches_physical_bdry = has_physical_bdry(elem, boundary_info, dof_map);
+                if (!touches_physical_bdry) continue;
 
-                // Construct a side element.
-                AutoPtr<Elem> side_elem = elem->build_side(side);
                 for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    dof_map.dof_indices(side_elem.get(), side_dof_indices[d], d);
-                }
-                get_values_for_interpolation(X_node_side, *X_petsc_vec, X_local_soln, side_dof_indices);
-                const bool qrule_needs_reinit = d_fe_data_managers[part]->updateSpreadQuadratureRule(
-                    qrule_face, d_spread_spec, side_elem.get(), X_node, patch_dx_min);
-                if (qrule_needs_reinit)
-                {
-                    fe_face->attach_quadrature_rule(qrule_face.get());
+                    dof_map.dof_indices(elem, dof_indices[d], d);
                 }
-                fe_face->reinit(elem, side);
-                const unsigned int n_qp = qrule_face->n_points();
-                T_bdry.resize(T_bdry.size() + NDIM * n_qp);
-                X_bdry.resize(X_bdry.size() + NDIM * n_qp);
-                for (unsigned int qp = 0; qp < n_qp; ++qp, ++qp_offset)
-                {
-                    const libMesh::Point& s_qp = q_point_face[qp];
-                    interpolate(X_qp, qp, X_node, phi_face);
-                    jacobian(FF, qp, X_node, dphi_face);
-                    const double J = std::abs(FF.det());
-                    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-                    F.zero();
+                get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
 
-                    for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
-                    {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
-                        {
-                            // Compute the value of the first Piola-Kirchhoff stress
-                            // tensor at the quadrature point and compute the
-                            // corresponding force.
-                            d_PK1_stress_fcn_data[part][k].fcn(PP, FF, X_qp, s_qp, elem, PK1_stress_fcn_data[k],
-                                                               data_time, d_PK1_stress_fcn_data[part][k].ctx);
-                            F -= PP * normal_face[qp] * JxW_face[qp];
-                        }
-                    }
+                // Loop over the element boundaries.
+                for (unsigned short int side = 0; side < elem->n_sides(); ++side)
+                {
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
 
-                    if (d_lag_surface_pressure_fcn_data[part].fcn)
-                    {
-                        // Compute the value of the pressure at the quadrature
-                        // point and compute the corresponding force.
-                        d_lag_surface_pressure_fcn_data[part].fcn(P, FF, X_qp, s_qp, elem, side,
-                                                                  lag_surface_pressure_fcn_data, data_time,
-                                                                  d_lag_surface_pressure_fcn_data[part].ctx);
-                        F -= P * J * FF_inv_trans * normal_face[qp] * JxW_face[qp];
-                    }
+                    // Skip Dirichlet boundaries.
+                    if (is_dirichlet_bdry(elem, side, boundary_info, dof_map)) continue;
 
-                    if (d_lag_surface_force_fcn_data[part].fcn)
+                    // Construct a side element.
+                    AutoPtr<Elem> side_elem = elem->build_side(side);
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        // Compute the value of the surface force at the
-                        // quadrature point and compute the corresponding force.
-                        d_lag_surface_force_fcn_data[part].fcn(F_s, FF, X_qp, s_qp, elem, side,
-                                                               lag_surface_force_fcn_data, data_time,
-                                                               d_lag_surface_force_fcn_data[part].ctx);
-                        F += F_s * JxW_face[qp];
+                        dof_map.dof_indices(side_elem.get(), side_dof_indices[d], d);
                     }
-
-                    const int idx = NDIM * qp_offset;
-                    for (unsigned int i = 0; i < NDIM; ++i)
+                    get_values_for_interpolation(X_node_side, *X_petsc_vec, X_local_soln, side_dof_indices);
+
+                    // NOTE: The side element shares its nodes with the mesh,
+                    // and so selecting the quadrature rule must not modify the
+                    // nodal positions when several threads are used.
+                    const bool qrule_needs_reinit = d_fe_data_managers[part]->updateSpreadQuadratureRule(
+                        qrule_face, d_spread_spec, side_elem.get(), X_node_side, patch_dx_min);
+                    if (qrule_needs_reinit)
                     {
-                        T_bdry[idx + i] = F(i);
+                        fe_face->attach_quadrature_rule(qrule_face.get());
                     }
-                    for (unsigned int i = 0; i < NDIM; ++i)
+                    fe_face->reinit(elem, side);
+                    const unsigned int n_qp = qrule_face->n_points();
+                    T_bdry_local.resize(T_bdry_local.size() + NDIM * n_qp);
+                    X_bdry_local.resize(X_bdry_local.size() + NDIM * n_qp);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp, ++qp_offset)
                     {
-                        X_bdry[idx + i] = X_qp(i);
+                        const libMesh::Point& s_qp = q_point_face[qp];
+                        interpolate(X_qp, qp, X_node, phi_face);
+                        jacobian(FF, qp, X_node, dphi_face);
+                        const double J = std::abs(FF.det());
+                        tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                        F.zero();
+
+                        for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
+                        {
+                            if (d_PK1_stress_fcn_data[part][k].fcn)
+                            {
+                                // Compute the value of the first Piola-Kirchhoff
+                                // stress tensor at the quadrature point and
+                                // compute the corresponding force.
+                                d_PK1_stress_fcn_data[part][k].fcn(PP, FF, X_qp, s_qp, elem, PK1_stress_fcn_data[k],
+                                                                   data_time, d_PK1_stress_fcn_data[part][k].ctx);
+                                F -= PP * normal_face[qp] * JxW_face[qp];
+                            }
+                        }
+
+                        if (d_lag_surface_pressure_fcn_data[part].fcn)
+                        {
+                            // Compute the value of the pressure at the
+                            // quadrature point and compute the corresponding
+                            // force.
+                            d_lag_surface_pressure_fcn_data[part].fcn(P, FF, X_qp, s_qp, elem, side,
+                                                                      lag_surface_pressure_fcn_data, data_time,
+                                                                      d_lag_surface_pressure_fcn_data[part].ctx);
+                            F -= P * J * FF_inv_trans * normal_face[qp] * JxW_face[qp];
+                        }
+
+                        if (d_lag_surface_force_fcn_data[part].fcn)
+                        {
+                            // Compute the value of the surface force at the
+                            // quadrature point and compute the corresponding
+                            // force.
+                            d_lag_surface_force_fcn_data[part].fcn(F_s, FF, X_qp, s_qp, elem, side,
+                                                                   lag_surface_force_fcn_data, data_time,
+                                                                   d_lag_surface_force_fcn_data[part].ctx);
+                            F += F_s * JxW_face[qp];
+                        }
+
+                        const int idx = NDIM * qp_offset;
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            T_bdry_local[idx + i] = F(i);
+                        }
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            X_bdry_local[idx + i] = X_qp(i);
+                        }
                     }
                 }
             }
         }
+        T_bdry.clear();
+        X_bdry.clear();
+        for (int thread_num = 0; thread_num < d_num_force_assembly_threads; ++thread_num)
+        {
+            T_bdry.insert(T_bdry.end(), T_bdry_thread[thread_num].begin(), T_bdry_thread[thread_num].end());
+            X_bdry.insert(X_bdry.end(), X_bdry_thread[thread_num].begin(), X_bdry_thread[thread_num].end());
+        }
 
-        if (qp_offset == 0) continue;
+        if (T_bdry.empty()) continue;
 
         // Spread the boundary forces to the grid.
         const std::string& spread_kernel_fcn = d_spread_spec.kernel_fcn;
@@ -1636,14 +1718,7 @@ void IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
     }
 
     // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
-    }
-    var_db->removePatchDataIndex(f_copy_data_idx);
+    d_spread_accumulator.endAccumulation();
 
     VecRestoreArray(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
@@ -2118,6 +2193,8 @@ void IBFEMethod::commonConstructor(const std::string& object_name,
     d_quad_type = QGAUSS;
     d_quad_order = INVALID_ORDER;
     d_use_consistent_mass_matrix = true;
+    d_use_block_L2_projection_solver = false;
+    d_num_force_assembly_threads = 1;
     d_do_log = false;
 
     // Indicate that all of the parts are unconstrained by default and set some
@@ -2206,6 +2283,7 @@ void IBFEMethod::commonConstructor(const std::string& object_name,
         manager_stream << "IBFEMethod FEDataManager::" << part;
         const std::string& manager_name = manager_stream.str();
         d_fe_data_managers[part] = FEDataManager::getManager(manager_name, d_interp_spec, d_spread_spec);
+        d_fe_data_managers[part]->setUseBlockL2ProjectionSolver(d_use_block_L2_projection_solver);
         d_ghosts = IntVector<NDIM>::max(d_ghosts, d_fe_data_managers[part]->getGhostCellWidth());
 
         // Create FE equation systems objects and corresponding variables.
@@ -2342,6 +2420,27 @@ void IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     if (db->isString("quad_order")) d_quad_order = Utility::string_to_enum<Order>(db->getString("quad_order"));
     if (db->isBool("use_consistent_mass_matrix"))
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
+    if (db->isBool("use_block_L2_projection_solver"))
+        d_use_block_L2_projection_solver = db->getBool("use_block_L2_projection_solver");
+    if (db->isInteger("num_force_assembly_threads"))
+    {
+        d_num_force_assembly_threads = db->getInteger("num_force_assembly_threads");
+        if (d_num_force_assembly_threads < 1)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  num_force_assembly_threads must be positive" << std::endl);
+        }
+#if !defined(_OPENMP)
+        if (d_num_force_assembly_threads > 1)
+        {
+            TBOX_WARNING(d_object_name << "::getFromInput():\n"
+                                       << "  IBAMR was not configured with --enable-openmp; the Lagrangian forces "
+                                          "will be computed using a single thread"
+                                       << std::endl);
+            d_num_force_assembly_threads = 1;
+        }
+#endif
+    }
 
     // Other settings.
     if (db->isInteger("min_ghost_cell_width"))
@@ -35,7 +35,9 @@
 #include <stddef.h>
 #include <algorithm>
 #include <ostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
@@ -43,6 +45,7 @@
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenOperator.h"
+#include "CoarsenSchedule.h"
 #include "ComponentSelector.h"
 #include "Geometry.h"
 #include "GriddingAlgorithm.h"
@@ -52,10 +55,12 @@
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "RefineAlgorithm.h"
 #include "RefineOperator.h"
+#include "RefineSchedule.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -71,6 +76,7 @@
 #include "ibtk/CartGridFunctionSet.h"
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/HierarchyIntegrator.h"
+#include "ibtk/LMarkerSetData.h"
 #include "ibtk/LMarkerSetVariable.h"
 #include "ibtk/LMarkerUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
@@ -102,6 +108,26 @@ namespace
 {
 // Version of IBHierarchyIntegrator restart file data.
 static const int IB_HIERARCHY_INTEGRATOR_VERSION = 2;
+
+void fill_ghost_cell_values(const std::vector<Pointer<CoarsenSchedule<NDIM> > >& synch_scheds,
+                            const std::vector<Pointer<RefineSchedule<NDIM> > >& ghost_fill_scheds,
+                            const int coarsest_ln,
+                            const int finest_ln,
+                            const double fill_data_time)
+{
+    for (int ln = finest_ln; ln > coarsest_ln; --ln)
+    {
+        if (ln < static_cast<int>(synch_scheds.size()) && synch_scheds[ln]) synch_scheds[ln]->coarsenData();
+    }
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (ln < static_cast<int>(ghost_fill_scheds.size()) && ghost_fill_scheds[ln])
+        {
+            ghost_fill_scheds[ln]->fillData(fill_data_time);
+        }
+    }
+    return;
+} // fill_ghost_cell_values
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -227,6 +253,8 @@ void IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy
     {
         d_mark_var = new LMarkerSetVariable(d_object_name + "::markers");
         registerVariable(d_mark_current_idx, d_mark_new_idx, d_mark_scratch_idx, d_mark_var, ghosts);
+        d_mark_u_current_idx = var_db->registerClonedPatchDataIndex(d_u_var, d_u_idx);
+        d_mark_u_half_idx = var_db->registerClonedPatchDataIndex(d_u_var, d_u_idx);
     }
 
     // Initialize the fluid solver.
@@ -348,6 +376,24 @@ void IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy
     }
     d_ib_method_ops->setupTagBuffer(d_tag_buffer, d_gridding_alg);
 
+    // Setup default parameters for the adaptive regridding policy.  By default,
+    // we regrid once the interaction stencil of any IB point extends beyond
+    // the boundary of the level on which that point is stored, or once any IB
+    // point has moved farther than the tag buffer.
+    if (d_adaptive_regrid_edge_width < 0) d_adaptive_regrid_edge_width = ib_ghosts.max();
+    if (d_adaptive_regrid_max_displacement < 0.0)
+    {
+        d_adaptive_regrid_max_displacement = ib_ghosts.max();
+        for (int i = 0; i < d_tag_buffer.size(); ++i)
+        {
+            if (i == 0 || d_tag_buffer[i] < d_adaptive_regrid_max_displacement)
+            {
+                d_adaptive_regrid_max_displacement = d_tag_buffer[i];
+            }
+        }
+        d_adaptive_regrid_max_displacement = std::max(d_adaptive_regrid_max_displacement, 0.5);
+    }
+
     // Indicate that the integrator has been initialized.
     d_integrator_is_initialized = true;
     return;
@@ -411,10 +457,13 @@ void IBHierarchyIntegrator::regridHierarchy()
         d_ib_method_ops->updateWorkloadEstimates(d_hierarchy, d_workload_idx);
     }
 
-    // Collect the marker particles to level 0 of the patch hierarchy.
+    // Remove the marker particles from the patch hierarchy.  The markers are
+    // sent directly to their new owners after regridding.
+    std::vector<int> mark_idxs;
+    std::vector<double> X_mark, U_mark;
     if (d_mark_var)
     {
-        LMarkerUtilities::collectMarkersOnPatchHierarchy(d_mark_current_idx, d_hierarchy);
+        LMarkerUtilities::beginMarkerRedistribution(mark_idxs, X_mark, U_mark, d_mark_current_idx, d_hierarchy);
     }
 
     // Before regridding, begin Lagrangian data movement.
@@ -429,15 +478,16 @@ void IBHierarchyIntegrator::regridHierarchy()
     if (d_enable_logging) plog << d_object_name << "::regridHierarchy(): finishing Lagrangian data movement\n";
     d_ib_method_ops->endDataRedistribution(d_hierarchy, d_gridding_alg);
 
-    // Prune any duplicated markers located in the "invalid" regions of coarser
-    // levels of the patch hierarchy.
+    // Redistribute the marker particles on the new patch hierarchy.
     if (d_mark_var)
     {
-        LMarkerUtilities::pruneInvalidMarkers(d_mark_current_idx, d_hierarchy);
+        LMarkerUtilities::endMarkerRedistribution(mark_idxs, X_mark, U_mark, d_mark_current_idx, d_hierarchy);
     }
 
-    // Reset the regrid CFL estimate.
+    // Reset the regrid CFL estimate and the measured displacement statistics.
     d_regrid_cfl_estimate = 0.0;
+    d_regrid_max_displacement = 0.0;
+    d_regrid_edge_fraction = 0.0;
     return;
 } // regridHierarchy
 
@@ -478,8 +528,20 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(const std::string& object_name,
     d_time_stepping_type = MIDPOINT_RULE;
     d_regrid_cfl_interval = 0.0;
     d_regrid_cfl_estimate = 0.0;
+    d_use_adaptive_regrid_policy = false;
+    d_adaptive_regrid_max_displacement = -1.0;
+    d_adaptive_regrid_max_edge_fraction = 1.0;
+    d_adaptive_regrid_edge_width = -1;
+    d_adaptive_regrid_min_interval = 1;
+    d_adaptive_regrid_max_interval = 0;
+    d_regrid_max_displacement = 0.0;
+    d_regrid_edge_fraction = 0.0;
     d_error_on_dt_change = true;
     d_warn_on_dt_change = false;
+    d_mark_time_stepping_type = UNKNOWN_TIME_STEPPING_TYPE;
+    d_mark_kernel_fcn = "IB_4";
+    d_mark_u_current_idx = -1;
+    d_mark_u_half_idx = -1;
 
     // Do not allocate a workload variable by default.
     d_workload_var.setNull();
@@ -489,6 +551,7 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(const std::string& object_name,
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
     if (input_db) getFromInput(input_db, from_restart);
+    d_measure_regrid_costs = d_use_adaptive_regrid_policy;
     return;
 } // IBHierarchyIntegrator
 
@@ -496,6 +559,40 @@ bool IBHierarchyIntegrator::atRegridPointSpecialized() const
 {
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
     if (initial_time) return true;
+    if (d_use_adaptive_regrid_policy)
+    {
+        if (d_num_steps_since_regrid < d_adaptive_regrid_min_interval) return false;
+        const double max_displacement =
+            d_regrid_max_displacement >= 0.0 ? d_regrid_max_displacement : d_regrid_cfl_estimate;
+        std::ostringstream reason;
+        if (d_adaptive_regrid_max_interval > 0 && d_num_steps_since_regrid >= d_adaptive_regrid_max_interval)
+        {
+            reason << "maximum regrid interval of " << d_adaptive_regrid_max_interval << " time steps reached";
+        }
+        else if (max_displacement >= d_adaptive_regrid_max_displacement)
+        {
+            reason << "maximum IB point displacement = " << max_displacement
+                   << " meshwidths >= " << d_adaptive_regrid_max_displacement;
+        }
+        else if (d_regrid_edge_fraction > d_adaptive_regrid_max_edge_fraction)
+        {
+            reason << "fraction of IB points within " << d_adaptive_regrid_edge_width
+                   << " cells of the level boundary = " << d_regrid_edge_fraction << " > "
+                   << d_adaptive_regrid_max_edge_fraction;
+        }
+        else if (d_regrid_wall_time > 0.0 && d_stale_grid_cost_since_regrid >= d_regrid_wall_time)
+        {
+            reason << "stale grid cost = " << d_stale_grid_cost_since_regrid
+                   << " s >= regrid cost = " << d_regrid_wall_time << " s";
+        }
+        else
+        {
+            return false;
+        }
+        plog << d_object_name << "::atRegridPointSpecialized(): regridding after " << d_num_steps_since_regrid
+             << " time steps: " << reason.str() << "\n";
+        return true;
+    }
     if (d_regrid_cfl_interval > 0.0)
     {
         return (d_regrid_cfl_estimate >= d_regrid_cfl_interval);
@@ -600,11 +697,160 @@ void IBHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
     return;
 } // putToDatabaseSpecialized
 
+void IBHierarchyIntegrator::updateRegridDisplacementStatistics()
+{
+    if (!d_use_adaptive_regrid_policy) return;
+    d_ib_method_ops->computeRegridDisplacementStatistics(
+        d_regrid_max_displacement, d_regrid_edge_fraction, d_adaptive_regrid_edge_width);
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::updateRegridDisplacementStatistics(): maximum IB point displacement since "
+                                 "last regrid = " << d_regrid_max_displacement << "\n";
+        plog << d_object_name << "::updateRegridDisplacementStatistics(): fraction of IB points near level "
+                                 "boundaries = " << d_regrid_edge_fraction << "\n";
+        plog << d_object_name << "::updateRegridDisplacementStatistics(): stale grid cost since last regrid = "
+             << d_stale_grid_cost_since_regrid << " s, last regrid cost = " << d_regrid_wall_time << " s\n";
+    }
+    return;
+} // updateRegridDisplacementStatistics
+
+void IBHierarchyIntegrator::advanceMarkers(const double current_time, const double new_time)
+{
+    if (!d_mark_var) return;
+
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const double dt = new_time - current_time;
+    const double half_time = current_time + 0.5 * dt;
+    const TimeSteppingType mark_time_stepping_type =
+        (d_mark_time_stepping_type != UNKNOWN_TIME_STEPPING_TYPE ? d_mark_time_stepping_type : d_time_stepping_type);
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int u_current_idx = var_db->mapVariableAndContextToIndex(d_u_var, getCurrentContext());
+    const int u_new_idx = var_db->mapVariableAndContextToIndex(d_u_var, getNewContext());
+
+    // Initialize the new marker data from the current marker data; the
+    // time-stepping routines below only update the marker positions.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(d_mark_current_idx);
+            Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(d_mark_new_idx);
+            mark_new_data->copy(*mark_current_data);
+        }
+    }
+
+    // Setup the velocity fields with ghost cell values.  The current and
+    // half-step velocities are stored in separate scratch data, and the new
+    // velocity is stored in d_u_idx.
+    const bool use_u_half =
+        mark_time_stepping_type == MIDPOINT_RULE || mark_time_stepping_type == SSPRK3 || mark_time_stepping_type == RK4;
+    const bool use_u_new = mark_time_stepping_type != FORWARD_EULER && mark_time_stepping_type != MIDPOINT_RULE;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_mark_u_current_idx, current_time);
+        if (use_u_half) level->allocatePatchData(d_mark_u_half_idx, half_time);
+    }
+    const std::vector<Pointer<CoarsenSchedule<NDIM> > >& u_synch_scheds =
+        getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN");
+    const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds =
+        getGhostfillRefineSchedules(d_object_name + "::u");
+    d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+    d_hier_velocity_data_ops->copyData(d_u_idx, u_current_idx);
+    fill_ghost_cell_values(u_synch_scheds, u_ghost_fill_scheds, coarsest_ln, finest_ln, current_time);
+    d_hier_velocity_data_ops->copyData(d_mark_u_current_idx, d_u_idx, /*interior_only*/ false);
+    if (use_u_half)
+    {
+        d_hier_velocity_data_ops->linearSum(d_u_idx, 0.5, u_current_idx, 0.5, u_new_idx);
+        fill_ghost_cell_values(u_synch_scheds, u_ghost_fill_scheds, coarsest_ln, finest_ln, half_time);
+        d_hier_velocity_data_ops->copyData(d_mark_u_half_idx, d_u_idx, /*interior_only*/ false);
+    }
+    if (use_u_new)
+    {
+        d_hier_velocity_data_ops->copyData(d_u_idx, u_new_idx);
+        fill_ghost_cell_values(u_synch_scheds, u_ghost_fill_scheds, coarsest_ln, finest_ln, new_time);
+    }
+
+    // Advance the marker positions.
+    if (d_enable_logging)
+        plog << d_object_name << "::advanceMarkers(): advancing Lagrangian markers using time_stepping_type = "
+             << enum_to_string<TimeSteppingType>(mark_time_stepping_type) << "\n";
+    switch (mark_time_stepping_type)
+    {
+    case FORWARD_EULER:
+        LMarkerUtilities::eulerStep(
+            d_mark_current_idx, d_mark_new_idx, d_mark_u_current_idx, dt, d_mark_kernel_fcn, d_hierarchy);
+        break;
+    case MIDPOINT_RULE:
+        LMarkerUtilities::eulerStep(
+            d_mark_current_idx, d_mark_new_idx, d_mark_u_current_idx, dt, d_mark_kernel_fcn, d_hierarchy);
+        LMarkerUtilities::midpointStep(
+            d_mark_current_idx, d_mark_new_idx, d_mark_u_half_idx, dt, d_mark_kernel_fcn, d_hierarchy);
+        break;
+    case TRAPEZOIDAL_RULE:
+        LMarkerUtilities::eulerStep(
+            d_mark_current_idx, d_mark_new_idx, d_mark_u_current_idx, dt, d_mark_kernel_fcn, d_hierarchy);
+        LMarkerUtilities::trapezoidalStep(
+            d_mark_current_idx, d_mark_new_idx, d_u_idx, dt, d_mark_kernel_fcn, d_hierarchy);
+        break;
+    case SSPRK3:
+        LMarkerUtilities::ssprk3Step(d_mark_current_idx,
+                                     d_mark_new_idx,
+                                     d_mark_u_current_idx,
+                                     d_mark_u_half_idx,
+                                     d_u_idx,
+                                     dt,
+                                     d_mark_kernel_fcn,
+                                     d_hierarchy);
+        break;
+    case RK4:
+        LMarkerUtilities::rk4Step(d_mark_current_idx,
+                                  d_mark_new_idx,
+                                  d_mark_u_current_idx,
+                                  d_mark_u_half_idx,
+                                  d_u_idx,
+                                  dt,
+                                  d_mark_kernel_fcn,
+                                  d_hierarchy);
+        break;
+    default:
+        TBOX_ERROR(d_object_name << "::advanceMarkers():\n"
+                                 << "  unsupported marker time stepping type: "
+                                 << enum_to_string<TimeSteppingType>(mark_time_stepping_type) << " \n"
+                                 << "  valid choices are: FORWARD_EULER, MIDPOINT_RULE, TRAPEZOIDAL_RULE, "
+                                    "SSPRK3, RK4\n");
+    }
+
+    // Deallocate scratch data.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(d_mark_u_current_idx);
+        if (use_u_half) level->deallocatePatchData(d_mark_u_half_idx);
+    }
+    return;
+} // advanceMarkers
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
     if (db->keyExists("regrid_cfl_interval")) d_regrid_cfl_interval = db->getDouble("regrid_cfl_interval");
+    if (db->keyExists("use_adaptive_regrid_policy"))
+        d_use_adaptive_regrid_policy = db->getBool("use_adaptive_regrid_policy");
+    if (db->keyExists("adaptive_regrid_max_displacement"))
+        d_adaptive_regrid_max_displacement = db->getDouble("adaptive_regrid_max_displacement");
+    if (db->keyExists("adaptive_regrid_max_edge_fraction"))
+        d_adaptive_regrid_max_edge_fraction = db->getDouble("adaptive_regrid_max_edge_fraction");
+    if (db->keyExists("adaptive_regrid_edge_width"))
+        d_adaptive_regrid_edge_width = db->getInteger("adaptive_regrid_edge_width");
+    if (db->keyExists("adaptive_regrid_min_interval"))
+        d_adaptive_regrid_min_interval = db->getInteger("adaptive_regrid_min_interval");
+    if (db->keyExists("adaptive_regrid_max_interval"))
+        d_adaptive_regrid_max_interval = db->getInteger("adaptive_regrid_max_interval");
     if (db->keyExists("error_on_dt_change"))
         d_error_on_dt_change = db->getBool("error_on_dt_change");
     else if (db->keyExists("error_on_timestep_change"))
@@ -622,6 +868,26 @@ void IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_re
     else if (db->keyExists("timestepping_type"))
         d_time_stepping_type = string_to_enum<TimeSteppingType>(db->getString("timestepping_type"));
     if (db->keyExists("marker_file_name")) d_mark_file_name = db->getString("marker_file_name");
+    if (db->keyExists("marker_time_stepping_type"))
+    {
+        d_mark_time_stepping_type = string_to_enum<TimeSteppingType>(db->getString("marker_time_stepping_type"));
+        switch (d_mark_time_stepping_type)
+        {
+        case FORWARD_EULER:
+        case MIDPOINT_RULE:
+        case TRAPEZOIDAL_RULE:
+        case SSPRK3:
+        case RK4:
+            break;
+        default:
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  unsupported marker time stepping type: "
+                                     << db->getString("marker_time_stepping_type") << " \n"
+                                     << "  valid choices are: FORWARD_EULER, MIDPOINT_RULE, TRAPEZOIDAL_RULE, "
+                                        "SSPRK3, RK4\n");
+        }
+    }
+    if (db->keyExists("marker_kernel_fcn")) d_mark_kernel_fcn = db->getString("marker_kernel_fcn");
     return;
 } // getFromInput
 
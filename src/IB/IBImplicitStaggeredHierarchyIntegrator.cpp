@@ -410,6 +410,9 @@ void IBImplicitStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const
                                            getGhostfillRefineSchedules(d_object_name + "::u"),
                                            new_time);
 
+    // Advance the Lagrangian markers.
+    advanceMarkers(current_time, new_time);
+
     // Synchronize new state data.
     if (!skip_synchronize_new_state_data)
     {
@@ -456,6 +459,10 @@ void IBImplicitStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const
     // Deallocate IB data.
     d_ib_implicit_ops->postprocessIntegrateData(current_time, new_time, num_cycles);
 
+    // Update the Lagrangian displacement statistics used to determine when to
+    // regrid.
+    updateRegridDisplacementStatistics();
+
     // Deallocate Eulerian scratch data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -565,7 +572,8 @@ PetscErrorCode IBImplicitStaggeredHierarchyIntegrator::compositeIBFunction(SNES
     d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
     d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
     d_ib_implicit_ops->spreadForce(
-        d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
+        d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time,
+        /*f_data_is_zero*/ true);
     d_hier_velocity_data_ops->subtract(f_u_idx, f_u_idx, d_f_idx);
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(component_rhs_vecs[0]));
     CHKERRQ(ierr);
@@ -85,6 +85,7 @@
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/LNodeSetData.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
@@ -166,6 +167,9 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_do_log = false;
+    d_use_async_lag_checkpointing = false;
+    d_async_lag_checkpoint_dirname = "";
+    d_lag_node_ordering = PATCH_ORDERING;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -186,6 +190,11 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_l_data_manager = LDataManager::getManager(
         d_object_name + "::LDataManager", d_interp_kernel_fcn, d_spread_kernel_fcn, d_ghosts, d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    if (d_use_async_lag_checkpointing)
+    {
+        d_l_data_manager->setAsynchronousCheckpointing(true, d_async_lag_checkpoint_dirname);
+    }
+    d_l_data_manager->setNodeOrdering(d_lag_node_ordering);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -365,6 +374,9 @@ void IBMethod::preprocessIntegrateData(double current_time, double new_time, int
     d_F_new_data.resize(finest_ln + 1);
     d_F_half_data.resize(finest_ln + 1);
     d_F_jac_data.resize(finest_ln + 1);
+    d_X_substep_data.resize(finest_ln + 1);
+    d_U_substep_data.resize(finest_ln + 1);
+    d_F_substep_data.resize(finest_ln + 1);
     if (d_use_fixed_coupling_ops)
     {
         d_X_LE_new_data.resize(finest_ln + 1);
@@ -468,6 +480,9 @@ void IBMethod::postprocessIntegrateData(double current_time, double new_time, in
     d_F_new_data.clear();
     d_F_half_data.clear();
     d_F_jac_data.clear();
+    d_X_substep_data.clear();
+    d_U_substep_data.clear();
+    d_F_substep_data.clear();
 
     // Reset the current time step interval.
     d_current_time = std::numeric_limits<double>::quiet_NaN();
@@ -707,6 +722,66 @@ void IBMethod::computeLagrangianForce(const double data_time)
     return;
 } // computeLagrangianForce
 
+void IBMethod::computeSubcycledLagrangianForce(const double current_time,
+                                               const double new_time,
+                                               const int num_substeps,
+                                               const double data_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_substeps >= 1);
+#endif
+    int ierr;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const double dt = new_time - current_time;
+    const double dt_substep = dt / static_cast<double>(num_substeps);
+    std::vector<Pointer<LData> >* F_data;
+    bool* F_needs_ghost_fill;
+    getForceData(&F_data, &F_needs_ghost_fill, data_time);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        ierr = VecSet((*F_data)[ln]->getVec(), 0.0);
+        IBTK_CHKERRQ(ierr);
+        if (!d_ib_force_fcn) continue;
+
+        // The force is evaluated along the linear path connecting X^{n} and the
+        // present prediction of X^{n+1}, i.e., with the fixed velocity
+        // U = (X^{n+1} - X^{n})/dt.
+        if (!d_X_substep_data[ln])
+        {
+            d_X_substep_data[ln] = d_l_data_manager->createLData("X_substep", ln, NDIM);
+            d_U_substep_data[ln] = d_l_data_manager->createLData("U_substep", ln, NDIM);
+            d_F_substep_data[ln] = d_l_data_manager->createLData("F_substep", ln, NDIM);
+        }
+        Pointer<LData> X_substep_data = d_X_substep_data[ln];
+        Pointer<LData> U_substep_data = d_U_substep_data[ln];
+        Pointer<LData> F_substep_data = d_F_substep_data[ln];
+        Vec X_current_vec = d_X_current_data[ln]->getVec();
+        ierr = VecWAXPY(U_substep_data->getVec(), -1.0, X_current_vec, d_X_new_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScale(U_substep_data->getVec(), 1.0 / dt);
+        IBTK_CHKERRQ(ierr);
+        for (int k = 0; k < num_substeps; ++k)
+        {
+            // Evaluate the force at the midpoint of each substep and accumulate
+            // its contribution to the time-averaged force.
+            const double substep_time = current_time + (static_cast<double>(k) + 0.5) * dt_substep;
+            ierr = VecWAXPY(
+                X_substep_data->getVec(), substep_time - current_time, U_substep_data->getVec(), X_current_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecSet(F_substep_data->getVec(), 0.0);
+            IBTK_CHKERRQ(ierr);
+            d_ib_force_fcn->computeLagrangianForce(
+                F_substep_data, X_substep_data, U_substep_data, d_hierarchy, ln, substep_time, d_l_data_manager);
+            ierr = VecAXPY((*F_data)[ln]->getVec(), 1.0 / static_cast<double>(num_substeps), F_substep_data->getVec());
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    *F_needs_ghost_fill = true;
+    return;
+} // computeSubcycledLagrangianForce
+
 void IBMethod::computeLinearizedLagrangianForce(Vec& X_vec, const double /*data_time*/)
 {
     PetscErrorCode ierr;
@@ -725,7 +800,8 @@ void IBMethod::computeLinearizedLagrangianForce(Vec& X_vec, const double /*data_
 void IBMethod::spreadForce(const int f_data_idx,
                            RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                            const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
-                           const double data_time)
+                           const double data_time,
+                           const bool f_data_is_zero)
 {
     std::vector<Pointer<LData> >* F_data, *X_LE_data;
     bool* F_needs_ghost_fill, *X_LE_needs_ghost_fill;
@@ -741,7 +817,10 @@ void IBMethod::spreadForce(const int f_data_idx,
                              f_prolongation_scheds,
                              data_time,
                              *F_needs_ghost_fill,
-                             *X_LE_needs_ghost_fill);
+                             *X_LE_needs_ghost_fill,
+                             /*coarsest_ln*/ -1,
+                             /*finest_ln*/ -1,
+                             f_data_is_zero);
     *F_needs_ghost_fill = false;
     *X_LE_needs_ghost_fill = false;
     return;
@@ -1263,12 +1342,104 @@ void IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
         X_data[ln]->restoreArrays();
     }
 
+    // Keep track of the positions of the IB points at the time of the
+    // redistribution.
+    d_X_regrid_data.resize(hierarchy->getFinestLevelNumber() + 1);
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        d_X_regrid_data[ln].setNull();
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        d_X_regrid_data[ln] = d_l_data_manager->createLData("X_regrid", ln, NDIM);
+        int ierr = VecCopy(X_data[ln]->getVec(), d_X_regrid_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+    }
+
     // Indicate that the force and source strategies need to be re-initialized.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
     return;
 } // endDataRedistribution
 
+void IBMethod::computeRegridDisplacementStatistics(double& max_displacement, double& edge_fraction, int edge_width)
+{
+    max_displacement = 0.0;
+    int num_nodes = 0, num_edge_nodes = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= std::min(finest_ln, static_cast<int>(d_X_regrid_data.size()) - 1); ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln) || !d_X_regrid_data[ln]) continue;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+
+        // Cells that lie outside of the physical domain in non-periodic
+        // directions are never covered by the level, and cells that lie outside
+        // of the domain in periodic directions are covered by the periodic
+        // images of the level boxes.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+        const IntVector<NDIM> periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        BoxList<NDIM> level_boxes(level->getBoxes());
+        BoxList<NDIM> domain_boxes(level->getPhysicalDomain());
+        for (int d = 0; d < NDIM; ++d)
+        {
+            if (periodic_shift(d) == 0) continue;
+            BoxList<NDIM> periodic_image_boxes;
+            for (BoxList<NDIM>::Iterator b(level_boxes); b; b++)
+            {
+                Box<NDIM> lower_image_box(b());
+                lower_image_box.shift(d, -periodic_shift(d));
+                periodic_image_boxes.appendItem(lower_image_box);
+                Box<NDIM> upper_image_box(b());
+                upper_image_box.shift(d, periodic_shift(d));
+                periodic_image_boxes.appendItem(upper_image_box);
+            }
+            level_boxes.unionBoxes(periodic_image_boxes);
+            IntVector<NDIM> domain_growth(0);
+            domain_growth(d) = periodic_shift(d);
+            domain_boxes.grow(domain_growth);
+        }
+        Pointer<LData> X_data = d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        const boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+        const boost::multi_array_ref<double, 2>& X_regrid_array = *d_X_regrid_data[ln]->getLocalFormVecArray();
+        const int lag_node_idx_idx = d_l_data_manager->getLNodePatchDescriptorIndex();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Box<NDIM> interior_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(-edge_width));
+            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patch_x_lower = patch_geom->getXLower();
+            const double* const patch_x_upper = patch_geom->getXUpper();
+            const double* const patch_dx = patch_geom->getDx();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(lag_node_idx_idx);
+            for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+            {
+                const int local_idx = (*it)->getLocalPETScIndex();
+                const double* const X = &X_array[local_idx][0];
+                const double* const X_regrid = &X_regrid_array[local_idx][0];
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    max_displacement = std::max(max_displacement, std::abs(X[d] - X_regrid[d]) / patch_dx[d]);
+                }
+                const CellIndex<NDIM> cell_idx = IndexUtilities::getCellIndex(
+                    X, patch_x_lower, patch_x_upper, patch_dx, patch_box.lower(), patch_box.upper());
+                ++num_nodes;
+                if (interior_box.contains(cell_idx)) continue;
+                const Box<NDIM> stencil_box(cell_idx, cell_idx);
+                BoxList<NDIM> uncovered_boxes(Box<NDIM>::grow(stencil_box, IntVector<NDIM>(edge_width)));
+                uncovered_boxes.removeIntersections(level_boxes);
+                uncovered_boxes.intersectBoxes(domain_boxes);
+                if (!uncovered_boxes.isEmpty()) ++num_edge_nodes;
+            }
+        }
+        d_X_regrid_data[ln]->restoreArrays();
+        X_data->restoreArrays();
+    }
+    max_displacement = SAMRAI_MPI::maxReduction(max_displacement);
+    num_nodes = SAMRAI_MPI::sumReduction(num_nodes);
+    num_edge_nodes = SAMRAI_MPI::sumReduction(num_edge_nodes);
+    edge_fraction = num_nodes > 0 ? static_cast<double>(num_edge_nodes) / static_cast<double>(num_nodes) : 0.0;
+    return;
+} // computeRegridDisplacementStatistics
+
 void IBMethod::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                                    int level_number,
                                    double init_data_time,
@@ -1793,6 +1964,20 @@ void IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->keyExists("use_async_lagrangian_checkpointing"))
+        d_use_async_lag_checkpointing = db->getBool("use_async_lagrangian_checkpointing");
+    if (db->keyExists("async_lagrangian_checkpoint_dirname"))
+        d_async_lag_checkpoint_dirname = db->getString("async_lagrangian_checkpoint_dirname");
+    if (db->keyExists("lag_node_ordering"))
+    {
+        d_lag_node_ordering = string_to_enum<LNodeOrderingType>(db->getString("lag_node_ordering"));
+        if (d_lag_node_ordering == UNKNOWN_LNODE_ORDERING_TYPE)
+        {
+            TBOX_ERROR(d_object_name << ":  "
+                                     << "unknown Lagrangian node ordering: " << db->getString("lag_node_ordering")
+                                     << std::endl);
+        }
+    }
     return;
 } // getFromInput
 
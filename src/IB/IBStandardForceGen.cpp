@@ -35,6 +35,7 @@
 #include <math.h>
 #include <stddef.h>
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -122,6 +123,40 @@ void resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+int computeLocalFirstPermutation(std::vector<int>& perm,
+                                 const std::vector<int>& inds0,
+                                 const std::vector<int>& inds1,
+                                 const int num_local_nodes)
+{
+    // Determine a stable permutation that places the entries whose (local
+    // form) indices both refer to local nodes first.
+    const int n = static_cast<int>(inds0.size());
+    perm.clear();
+    perm.reserve(n);
+    for (int k = 0; k < n; ++k)
+    {
+        if (inds0[k] < num_local_nodes && inds1[k] < num_local_nodes) perm.push_back(k);
+    }
+    const int num_local = static_cast<int>(perm.size());
+    for (int k = 0; k < n; ++k)
+    {
+        if (!(inds0[k] < num_local_nodes && inds1[k] < num_local_nodes)) perm.push_back(k);
+    }
+    return num_local;
+} // computeLocalFirstPermutation
+
+template <class T>
+void permuteEntries(std::vector<T>& vals, const std::vector<int>& perm)
+{
+    std::vector<T> permuted_vals(vals.size());
+    for (unsigned int k = 0; k < perm.size(); ++k)
+    {
+        permuted_vals[k] = vals[perm[k]];
+    }
+    vals.swap(permuted_vals);
+    return;
+} // permuteEntries
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -203,6 +238,29 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
     resetLocalOrNonlocalPETScIndices(
         d_beam_data[level_number].petsc_prev_node_idxs, global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
 
+    // Reorder the springs and beams so that those that involve only local
+    // nodes come first.  Forces generated by these elements can be computed
+    // while ghost node positions are being communicated.
+    std::vector<int> perm;
+    SpringData& spring_data = d_spring_data[level_number];
+    spring_data.num_local_springs = computeLocalFirstPermutation(
+        perm, spring_data.petsc_mastr_node_idxs, spring_data.petsc_slave_node_idxs, num_local_nodes);
+    permuteEntries(spring_data.lag_mastr_node_idxs, perm);
+    permuteEntries(spring_data.lag_slave_node_idxs, perm);
+    permuteEntries(spring_data.petsc_mastr_node_idxs, perm);
+    permuteEntries(spring_data.petsc_slave_node_idxs, perm);
+    permuteEntries(spring_data.force_fcns, perm);
+    permuteEntries(spring_data.force_deriv_fcns, perm);
+    permuteEntries(spring_data.parameters, perm);
+    BeamData& beam_data = d_beam_data[level_number];
+    beam_data.num_local_beams = computeLocalFirstPermutation(
+        perm, beam_data.petsc_next_node_idxs, beam_data.petsc_prev_node_idxs, num_local_nodes);
+    permuteEntries(beam_data.petsc_mastr_node_idxs, perm);
+    permuteEntries(beam_data.petsc_next_node_idxs, perm);
+    permuteEntries(beam_data.petsc_prev_node_idxs, perm);
+    permuteEntries(beam_data.rigidities, perm);
+    permuteEntries(beam_data.curvatures, perm);
+
     std::ostringstream X_name_stream;
     X_name_stream << "IBStandardForceGen::X_ghost_" << level_number;
     d_X_ghost_data[level_number] = new LData(X_name_stream.str(), num_local_nodes, NDIM, nonlocal_petsc_idxs);
@@ -274,38 +332,55 @@ void IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
 
     int ierr;
 
-    // Initialize ghost data.
-    Pointer<LData> F_ghost_data = d_F_ghost_data[level_number];
-    Vec F_ghost_local_form_vec;
-    ierr = VecGhostGetLocalForm(F_ghost_data->getVec(), &F_ghost_local_form_vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecSet(F_ghost_local_form_vec, 0.0);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecGhostRestoreLocalForm(F_ghost_data->getVec(), &F_ghost_local_form_vec);
-    IBTK_CHKERRQ(ierr);
-
+    // Begin communicating the ghost node positions.
     Pointer<LData> X_ghost_data = d_X_ghost_data[level_number];
     Pointer<LData> dX_data = d_dX_data[level_number];
     ierr = VecAXPBYPCZ(X_ghost_data->getVec(), 1.0, 1.0, 0.0, X_data->getVec(), dX_data->getVec());
     IBTK_CHKERRQ(ierr);
     ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
+
+    // Compute the forces generated by springs and beams that involve only
+    // local nodes while the ghost node positions are communicated.  These
+    // forces are accumulated directly into the Lagrangian force vector.
+    const int num_springs = static_cast<int>(d_spring_data[level_number].petsc_mastr_node_idxs.size());
+    const int num_local_springs = d_spring_data[level_number].num_local_springs;
+    const int num_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
+    const int num_local_beams = d_beam_data[level_number].num_local_beams;
+    computeLagrangianSpringForce(
+        F_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, 0, num_local_springs);
+    computeLagrangianBeamForce(
+        F_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, 0, num_local_beams);
+
+    // Finish communicating the ghost node positions.
     ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
 
-    // Compute the forces.
-    computeLagrangianSpringForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
-    computeLagrangianBeamForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
-    computeLagrangianTargetPointForce(
-        F_ghost_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
-
-    // Add the locally computed forces to the Lagrangian force vector.
+    // Compute the forces generated by springs and beams that involve nonlocal
+    // nodes.
+    Pointer<LData> F_ghost_data = d_F_ghost_data[level_number];
+    Vec F_ghost_local_form_vec;
+    ierr = VecGhostGetLocalForm(F_ghost_data->getVec(), &F_ghost_local_form_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSet(F_ghost_local_form_vec, 0.0);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(F_ghost_data->getVec(), &F_ghost_local_form_vec);
+    IBTK_CHKERRQ(ierr);
+    computeLagrangianSpringForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, num_local_springs, num_springs);
+    computeLagrangianBeamForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, num_local_beams, num_beams);
+
+    // Begin accumulating the nonlocal force contributions, and compute the
+    // target point forces (which involve only local nodes) while the ghost
+    // node forces are communicated.
     //
     // WARNING: The following operations may yield nondeterministic results in
     // parallel environments (i.e., the order of summation may not be
     // consistent).
     ierr = VecGhostUpdateBegin(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
+    computeLagrangianTargetPointForce(F_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
     ierr = VecGhostUpdateEnd(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
     ierr = VecAXPY(F_data->getVec(), 1.0, F_ghost_data->getVec());
@@ -780,16 +855,18 @@ void IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                       const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                                       const int level_number,
                                                       const double /*data_time*/,
-                                                      LDataManager* const /*l_data_manager*/)
+                                                      LDataManager* const /*l_data_manager*/,
+                                                      const int k_lower,
+                                                      const int k_upper)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
-    if (num_springs == 0) return;
-    const int* const lag_mastr_node_idxs = &d_spring_data[level_number].lag_mastr_node_idxs[0];
-    const int* const lag_slave_node_idxs = &d_spring_data[level_number].lag_slave_node_idxs[0];
-    const int* const petsc_mastr_node_idxs = &d_spring_data[level_number].petsc_mastr_node_idxs[0];
-    const int* const petsc_slave_node_idxs = &d_spring_data[level_number].petsc_slave_node_idxs[0];
-    const SpringForceFcnPtr* const force_fcns = &d_spring_data[level_number].force_fcns[0];
-    const double** const parameters = &d_spring_data[level_number].parameters[0];
+    const int num_springs = k_upper - k_lower;
+    if (num_springs <= 0) return;
+    const int* const lag_mastr_node_idxs = &d_spring_data[level_number].lag_mastr_node_idxs[k_lower];
+    const int* const lag_slave_node_idxs = &d_spring_data[level_number].lag_slave_node_idxs[k_lower];
+    const int* const petsc_mastr_node_idxs = &d_spring_data[level_number].petsc_mastr_node_idxs[k_lower];
+    const int* const petsc_slave_node_idxs = &d_spring_data[level_number].petsc_slave_node_idxs[k_lower];
+    const SpringForceFcnPtr* const force_fcns = &d_spring_data[level_number].force_fcns[k_lower];
+    const double** const parameters = &d_spring_data[level_number].parameters[k_lower];
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
@@ -992,15 +1069,17 @@ void IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
                                                     const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                                     const int level_number,
                                                     const double /*data_time*/,
-                                                    LDataManager* const /*l_data_manager*/)
+                                                    LDataManager* const /*l_data_manager*/,
+                                                    const int k_lower,
+                                                    const int k_upper)
 {
-    const int num_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
-    if (num_beams == 0) return;
-    const int* const petsc_mastr_node_idxs = &d_beam_data[level_number].petsc_mastr_node_idxs[0];
-    const int* const petsc_next_node_idxs = &d_beam_data[level_number].petsc_next_node_idxs[0];
-    const int* const petsc_prev_node_idxs = &d_beam_data[level_number].petsc_prev_node_idxs[0];
-    const double** const rigidities = &d_beam_data[level_number].rigidities[0];
-    const Vector** const curvatures = &d_beam_data[level_number].curvatures[0];
+    const int num_beams = k_upper - k_lower;
+    if (num_beams <= 0) return;
+    const int* const petsc_mastr_node_idxs = &d_beam_data[level_number].petsc_mastr_node_idxs[k_lower];
+    const int* const petsc_next_node_idxs = &d_beam_data[level_number].petsc_next_node_idxs[k_lower];
+    const int* const petsc_prev_node_idxs = &d_beam_data[level_number].petsc_prev_node_idxs[k_lower];
+    const double** const rigidities = &d_beam_data[level_number].rigidities[k_lower];
+    const Vector** const curvatures = &d_beam_data[level_number].curvatures[k_lower];
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
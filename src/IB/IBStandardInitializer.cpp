@@ -134,19 +134,20 @@ IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Poi
     : d_object_name(object_name), d_use_file_batons(true), d_max_levels(-1), d_level_is_initialized(),
       d_silo_writer(NULL), d_base_filename(), d_length_scale_factor(1.0), d_posn_shift(Vector::Zero()), d_num_vertex(),
       d_vertex_offset(), d_vertex_posn(), d_enable_springs(), d_spring_edge_map(), d_spring_spec_data(),
-      d_using_uniform_spring_stiffness(), d_uniform_spring_stiffness(), d_using_uniform_spring_rest_length(),
-      d_uniform_spring_rest_length(), d_using_uniform_spring_force_fcn_idx(), d_uniform_spring_force_fcn_idx(),
-      d_enable_xsprings(), d_xspring_edge_map(), d_xspring_spec_data(), d_using_uniform_xspring_stiffness(),
-      d_uniform_xspring_stiffness(), d_using_uniform_xspring_rest_length(), d_uniform_xspring_rest_length(),
-      d_using_uniform_xspring_force_fcn_idx(), d_uniform_xspring_force_fcn_idx(), d_enable_beams(), d_beam_spec_data(),
-      d_using_uniform_beam_bend_rigidity(), d_uniform_beam_bend_rigidity(), d_using_uniform_beam_curvature(),
-      d_uniform_beam_curvature(), d_enable_rods(), d_rod_edge_map(), d_rod_spec_data(),
-      d_using_uniform_rod_properties(), d_uniform_rod_properties(), d_enable_target_points(), d_target_spec_data(),
-      d_using_uniform_target_stiffness(), d_uniform_target_stiffness(), d_using_uniform_target_damping(),
-      d_uniform_target_damping(), d_enable_anchor_points(), d_anchor_spec_data(), d_enable_bdry_mass(),
-      d_bdry_mass_spec_data(), d_using_uniform_bdry_mass(), d_uniform_bdry_mass(),
-      d_using_uniform_bdry_mass_stiffness(), d_uniform_bdry_mass_stiffness(), d_directors(), d_enable_instrumentation(),
-      d_instrument_idx(), d_enable_sources(), d_source_idx(), d_global_index_offset()
+      d_spring_csr_data(), d_using_uniform_spring_stiffness(), d_uniform_spring_stiffness(),
+      d_using_uniform_spring_rest_length(), d_uniform_spring_rest_length(), d_using_uniform_spring_force_fcn_idx(),
+      d_uniform_spring_force_fcn_idx(), d_enable_xsprings(), d_xspring_edge_map(), d_xspring_spec_data(),
+      d_xspring_csr_data(), d_using_uniform_xspring_stiffness(), d_uniform_xspring_stiffness(),
+      d_using_uniform_xspring_rest_length(), d_uniform_xspring_rest_length(), d_using_uniform_xspring_force_fcn_idx(),
+      d_uniform_xspring_force_fcn_idx(), d_enable_beams(), d_beam_spec_data(), d_using_uniform_beam_bend_rigidity(),
+      d_uniform_beam_bend_rigidity(), d_using_uniform_beam_curvature(), d_uniform_beam_curvature(), d_enable_rods(),
+      d_rod_edge_map(), d_rod_spec_data(), d_rod_csr_data(), d_using_uniform_rod_properties(),
+      d_uniform_rod_properties(), d_enable_target_points(), d_target_spec_data(), d_using_uniform_target_stiffness(),
+      d_uniform_target_stiffness(), d_using_uniform_target_damping(), d_uniform_target_damping(),
+      d_enable_anchor_points(), d_anchor_spec_data(), d_enable_bdry_mass(), d_bdry_mass_spec_data(),
+      d_using_uniform_bdry_mass(), d_uniform_bdry_mass(), d_using_uniform_bdry_mass_stiffness(),
+      d_uniform_bdry_mass_stiffness(), d_directors(), d_enable_instrumentation(), d_instrument_idx(),
+      d_enable_sources(), d_source_idx(), d_global_index_offset()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -204,6 +205,10 @@ IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Poi
 
         // Process the source information.
         readSourceFiles(".source");
+
+        // Convert the connectivity information into compressed sparse row
+        // format.
+        buildConnectivityData();
     }
     return;
 } // IBStandardInitializer
@@ -656,34 +661,38 @@ void IBStandardInitializer::initializeLSiloDataWriter(const int level_number)
         }
 
         bool registered_spring_edge_map = false;
+        std::multimap<int, Edge> edge_map;
         for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
         {
-            if (d_spring_edge_map[level_number][j].size() > 0)
+            getEdgeMap(edge_map, d_spring_csr_data[level_number][j]);
+            if (edge_map.size() > 0)
             {
                 registered_spring_edge_map = true;
                 const std::string postfix = "_mesh";
                 d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_spring_edge_map[level_number][j], level_number);
+                    d_base_filename[level_number][j] + postfix, edge_map, level_number);
             }
         }
 
         for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
         {
-            if (d_xspring_edge_map[level_number][j].size() > 0)
+            getEdgeMap(edge_map, d_xspring_csr_data[level_number], j);
+            if (edge_map.size() > 0)
             {
                 const std::string postfix = "_xmesh";
                 d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_xspring_edge_map[level_number][j], level_number);
+                    d_base_filename[level_number][j] + postfix, edge_map, level_number);
             }
         }
 
         for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
         {
-            if (d_rod_edge_map[level_number][j].size() > 0)
+            getEdgeMap(edge_map, d_rod_csr_data[level_number][j]);
+            if (edge_map.size() > 0)
             {
                 const std::string postfix = registered_spring_edge_map ? "_rod_mesh" : "_mesh";
                 d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_rod_edge_map[level_number][j], level_number);
+                    d_base_filename[level_number][j] + postfix, edge_map, level_number);
             }
         }
     }
@@ -2690,6 +2699,169 @@ void IBStandardInitializer::readSourceFiles(const std::string& extension)
     return;
 } // readSourceFiles
 
+void IBStandardInitializer::buildConnectivityData()
+{
+    d_spring_csr_data.resize(d_max_levels);
+    d_xspring_csr_data.resize(d_max_levels);
+    d_rod_csr_data.resize(d_max_levels);
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        const size_t num_base_filename = d_base_filename[ln].size();
+
+        // Build the spring connectivity data.  The edge maps are sorted by
+        // master index, so that the edges may be appended in a single pass.
+        d_spring_csr_data[ln].resize(num_base_filename);
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            const std::multimap<int, Edge>& edge_map = d_spring_edge_map[ln][j];
+            const std::map<Edge, SpringSpec, EdgeComp>& spec_map = d_spring_spec_data[ln][j];
+            if (edge_map.empty()) continue;
+            const int num_edges = static_cast<int>(edge_map.size());
+            EdgeCSRData& csr_data = d_spring_csr_data[ln][j];
+            csr_data.idx_lower = d_vertex_offset[ln][j];
+            csr_data.offsets.resize(d_num_vertex[ln][j] + 1, 0);
+            csr_data.slave_idxs.reserve(num_edges);
+            csr_data.force_fcn_idxs.reserve(num_edges);
+            csr_data.param_offsets.reserve(num_edges + 1);
+            csr_data.param_offsets.push_back(0);
+            for (std::multimap<int, Edge>::const_iterator it = edge_map.begin(); it != edge_map.end(); ++it)
+            {
+                const int mastr_idx = it->first;
+                const Edge& e = it->second;
+#if !defined(NDEBUG)
+                TBOX_ASSERT(mastr_idx >= csr_data.idx_lower);
+                TBOX_ASSERT(mastr_idx < csr_data.idx_lower + d_num_vertex[ln][j]);
+#endif
+                const SpringSpec& spec_data = spec_map.find(e)->second;
+                ++csr_data.offsets[mastr_idx - csr_data.idx_lower + 1];
+                csr_data.slave_idxs.push_back(e.first == mastr_idx ? e.second : e.first);
+                csr_data.force_fcn_idxs.push_back(spec_data.force_fcn_idx);
+                csr_data.params.insert(csr_data.params.end(), spec_data.parameters.begin(), spec_data.parameters.end());
+                csr_data.param_offsets.push_back(static_cast<int>(csr_data.params.size()));
+            }
+            std::partial_sum(csr_data.offsets.begin(), csr_data.offsets.end(), csr_data.offsets.begin());
+            d_spring_edge_map[ln][j].clear();
+            d_spring_spec_data[ln][j].clear();
+        }
+
+        // Build the crosslink spring connectivity data.  Crosslink springs are
+        // specified in terms of the global Lagrangian indices of the level, so
+        // the edges of all of the structures are combined into a single set of
+        // connectivity data, ordered by master index and then by structure
+        // index.
+        int num_xspring_edges = 0;
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            num_xspring_edges += static_cast<int>(d_xspring_edge_map[ln][j].size());
+        }
+        if (num_xspring_edges > 0)
+        {
+            EdgeCSRData& csr_data = d_xspring_csr_data[ln];
+            const int num_vertex = std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0);
+            csr_data.idx_lower = 0;
+            csr_data.offsets.resize(num_vertex + 1, 0);
+            for (unsigned int j = 0; j < num_base_filename; ++j)
+            {
+                const std::multimap<int, Edge>& edge_map = d_xspring_edge_map[ln][j];
+                for (std::multimap<int, Edge>::const_iterator it = edge_map.begin(); it != edge_map.end(); ++it)
+                {
+#if !defined(NDEBUG)
+                    TBOX_ASSERT(it->first >= 0 && it->first < num_vertex);
+#endif
+                    ++csr_data.offsets[it->first + 1];
+                }
+            }
+            std::partial_sum(csr_data.offsets.begin(), csr_data.offsets.end(), csr_data.offsets.begin());
+            std::vector<int> next_edge_idx(csr_data.offsets.begin(), csr_data.offsets.end() - 1);
+            std::vector<const XSpringSpec*> edge_spec_data(num_xspring_edges, static_cast<const XSpringSpec*>(NULL));
+            csr_data.slave_idxs.resize(num_xspring_edges);
+            csr_data.force_fcn_idxs.resize(num_xspring_edges);
+            csr_data.structure_idxs.resize(num_xspring_edges);
+            for (unsigned int j = 0; j < num_base_filename; ++j)
+            {
+                const std::multimap<int, Edge>& edge_map = d_xspring_edge_map[ln][j];
+                const std::map<Edge, XSpringSpec, EdgeComp>& spec_map = d_xspring_spec_data[ln][j];
+                for (std::multimap<int, Edge>::const_iterator it = edge_map.begin(); it != edge_map.end(); ++it)
+                {
+                    const int mastr_idx = it->first;
+                    const Edge& e = it->second;
+                    const int e_idx = next_edge_idx[mastr_idx]++;
+                    edge_spec_data[e_idx] = &spec_map.find(e)->second;
+                    csr_data.slave_idxs[e_idx] = (e.first == mastr_idx ? e.second : e.first);
+                    csr_data.force_fcn_idxs[e_idx] = edge_spec_data[e_idx]->force_fcn_idx;
+                    csr_data.structure_idxs[e_idx] = j;
+                }
+            }
+            csr_data.param_offsets.reserve(num_xspring_edges + 1);
+            csr_data.param_offsets.push_back(0);
+            for (int e_idx = 0; e_idx < num_xspring_edges; ++e_idx)
+            {
+                const std::vector<double>& parameters = edge_spec_data[e_idx]->parameters;
+                csr_data.params.insert(csr_data.params.end(), parameters.begin(), parameters.end());
+                csr_data.param_offsets.push_back(static_cast<int>(csr_data.params.size()));
+            }
+        }
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            d_xspring_edge_map[ln][j].clear();
+            d_xspring_spec_data[ln][j].clear();
+        }
+
+        // Build the rod connectivity data.
+        d_rod_csr_data[ln].resize(num_base_filename);
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            const std::multimap<int, Edge>& edge_map = d_rod_edge_map[ln][j];
+            const std::map<Edge, RodSpec, EdgeComp>& spec_map = d_rod_spec_data[ln][j];
+            if (edge_map.empty()) continue;
+            const int num_edges = static_cast<int>(edge_map.size());
+            EdgeCSRData& csr_data = d_rod_csr_data[ln][j];
+            csr_data.idx_lower = d_vertex_offset[ln][j];
+            csr_data.offsets.resize(d_num_vertex[ln][j] + 1, 0);
+            csr_data.slave_idxs.reserve(num_edges);
+            csr_data.param_offsets.reserve(num_edges + 1);
+            csr_data.param_offsets.push_back(0);
+            csr_data.params.reserve(num_edges * IBRodForceSpec::NUM_MATERIAL_PARAMS);
+            for (std::multimap<int, Edge>::const_iterator it = edge_map.begin(); it != edge_map.end(); ++it)
+            {
+                const int mastr_idx = it->first;
+                const Edge& e = it->second;
+#if !defined(NDEBUG)
+                TBOX_ASSERT(mastr_idx >= csr_data.idx_lower);
+                TBOX_ASSERT(mastr_idx < csr_data.idx_lower + d_num_vertex[ln][j]);
+#endif
+                const RodSpec& spec_data = spec_map.find(e)->second;
+                ++csr_data.offsets[mastr_idx - csr_data.idx_lower + 1];
+                csr_data.slave_idxs.push_back(e.first == mastr_idx ? e.second : e.first);
+                csr_data.params.insert(csr_data.params.end(), spec_data.properties.begin(), spec_data.properties.end());
+                csr_data.param_offsets.push_back(static_cast<int>(csr_data.params.size()));
+            }
+            std::partial_sum(csr_data.offsets.begin(), csr_data.offsets.end(), csr_data.offsets.begin());
+            d_rod_edge_map[ln][j].clear();
+            d_rod_spec_data[ln][j].clear();
+        }
+    }
+    return;
+} // buildConnectivityData
+
+void IBStandardInitializer::getEdgeMap(std::multimap<int, Edge>& edge_map,
+                                       const EdgeCSRData& csr_data,
+                                       const int structure_idx) const
+{
+    edge_map.clear();
+    const int num_idxs = static_cast<int>(csr_data.offsets.size()) - 1;
+    for (int k = 0; k < num_idxs; ++k)
+    {
+        const int mastr_idx = csr_data.idx_lower + k;
+        for (int e_idx = csr_data.offsets[k]; e_idx < csr_data.offsets[k + 1]; ++e_idx)
+        {
+            if (structure_idx >= 0 && csr_data.structure_idxs[e_idx] != structure_idx) continue;
+            edge_map.insert(edge_map.end(), std::make_pair(mastr_idx, Edge(mastr_idx, csr_data.slave_idxs[e_idx])));
+        }
+    }
+    return;
+} // getEdgeMap
+
 void IBStandardInitializer::getPatchVertices(std::vector<std::pair<int, int> >& patch_vertices,
                                              const Pointer<Patch<NDIM> > patch,
                                              const int level_number,
@@ -2823,60 +2995,36 @@ std::vector<Pointer<Streamable> > IBStandardInitializer::initializeNodeData(cons
     {
         std::vector<int> slave_idxs, force_fcn_idxs;
         std::vector<std::vector<double> > parameters;
-        if (d_enable_springs[level_number][j])
+        if (d_enable_springs[level_number][j] && !d_spring_csr_data[level_number][j].offsets.empty())
         {
-            for (std::multimap<int, Edge>::const_iterator it =
-                     d_spring_edge_map[level_number][j].lower_bound(mastr_idx);
-                 it != d_spring_edge_map[level_number][j].upper_bound(mastr_idx);
-                 ++it)
+            const EdgeCSRData& csr_data = d_spring_csr_data[level_number][j];
+            const int k = mastr_idx - csr_data.idx_lower;
+            for (int e_idx = csr_data.offsets[k]; e_idx < csr_data.offsets[k + 1]; ++e_idx)
             {
-#if !defined(NDEBUG)
-                TBOX_ASSERT(mastr_idx == it->first);
-#endif
                 // The connectivity information.
-                const Edge& e = it->second;
-                if (e.first == mastr_idx)
-                {
-                    slave_idxs.push_back(e.second + global_index_offset);
-                }
-                else
-                {
-                    slave_idxs.push_back(e.first + global_index_offset);
-                }
+                slave_idxs.push_back(csr_data.slave_idxs[e_idx] + global_index_offset);
 
                 // The material properties.
-                const SpringSpec& spec_data = d_spring_spec_data[level_number][j].find(e)->second;
-                parameters.push_back(spec_data.parameters);
-                force_fcn_idxs.push_back(spec_data.force_fcn_idx);
+                parameters.push_back(std::vector<double>(csr_data.params.begin() + csr_data.param_offsets[e_idx],
+                                                         csr_data.params.begin() + csr_data.param_offsets[e_idx + 1]));
+                force_fcn_idxs.push_back(csr_data.force_fcn_idxs[e_idx]);
             }
         }
-        const size_t num_base_filename = d_base_filename[level_number].size();
-        for (unsigned int j = 0; j < num_base_filename; ++j)
+        if (!d_xspring_csr_data[level_number].offsets.empty())
         {
-            if (!d_enable_xsprings[level_number][j]) continue;
-            for (std::multimap<int, Edge>::const_iterator it =
-                     d_xspring_edge_map[level_number][j].lower_bound(mastr_idx);
-                 it != d_xspring_edge_map[level_number][j].upper_bound(mastr_idx);
-                 ++it)
+            const EdgeCSRData& csr_data = d_xspring_csr_data[level_number];
+            const int k = mastr_idx - csr_data.idx_lower;
+            for (int e_idx = csr_data.offsets[k]; e_idx < csr_data.offsets[k + 1]; ++e_idx)
             {
-#if !defined(NDEBUG)
-                TBOX_ASSERT(mastr_idx == it->first);
-#endif
+                if (!d_enable_xsprings[level_number][csr_data.structure_idxs[e_idx]]) continue;
+
                 // The connectivity information.
-                const Edge& e = it->second;
-                if (e.first == mastr_idx)
-                {
-                    slave_idxs.push_back(e.second + global_index_offset);
-                }
-                else
-                {
-                    slave_idxs.push_back(e.first + global_index_offset);
-                }
+                slave_idxs.push_back(csr_data.slave_idxs[e_idx] + global_index_offset);
 
                 // The material properties.
-                const XSpringSpec& spec_data = d_xspring_spec_data[level_number][j].find(e)->second;
-                parameters.push_back(spec_data.parameters);
-                force_fcn_idxs.push_back(spec_data.force_fcn_idx);
+                parameters.push_back(std::vector<double>(csr_data.params.begin() + csr_data.param_offsets[e_idx],
+                                                         csr_data.params.begin() + csr_data.param_offsets[e_idx + 1]));
+                force_fcn_idxs.push_back(csr_data.force_fcn_idxs[e_idx]);
             }
         }
         if (slave_idxs.size() > 0)
@@ -2908,31 +3056,23 @@ std::vector<Pointer<Streamable> > IBStandardInitializer::initializeNodeData(cons
     }
 
     // Initialize any rod specifications associated with the present vertex.
-    if (d_enable_rods[level_number][j])
+    if (d_enable_rods[level_number][j] && !d_rod_csr_data[level_number][j].offsets.empty())
     {
         std::vector<int> rod_next_idxs;
         std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> > rod_material_params;
-        for (std::multimap<int, Edge>::const_iterator it = d_rod_edge_map[level_number][j].lower_bound(mastr_idx);
-             it != d_rod_edge_map[level_number][j].upper_bound(mastr_idx);
-             ++it)
+        const EdgeCSRData& csr_data = d_rod_csr_data[level_number][j];
+        const int k = mastr_idx - csr_data.idx_lower;
+        for (int e_idx = csr_data.offsets[k]; e_idx < csr_data.offsets[k + 1]; ++e_idx)
         {
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx == it->first);
-#endif
             // The connectivity information.
-            const Edge& e = it->second;
-            if (e.first == mastr_idx)
-            {
-                rod_next_idxs.push_back(e.second + global_index_offset);
-            }
-            else
-            {
-                rod_next_idxs.push_back(e.first + global_index_offset);
-            }
+            rod_next_idxs.push_back(csr_data.slave_idxs[e_idx] + global_index_offset);
 
             // The material properties.
-            const RodSpec& spec_data = d_rod_spec_data[level_number][j].find(e)->second;
-            rod_material_params.push_back(spec_data.properties);
+            boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> properties;
+            std::copy(csr_data.params.begin() + csr_data.param_offsets[e_idx],
+                      csr_data.params.begin() + csr_data.param_offsets[e_idx + 1],
+                      properties.begin());
+            rod_material_params.push_back(properties);
         }
         if (!rod_next_idxs.empty())
         {
@@ -3028,6 +3168,7 @@ void IBStandardInitializer::getFromInput(Pointer<Database> db)
     d_enable_springs.resize(d_max_levels);
     d_spring_edge_map.resize(d_max_levels);
     d_spring_spec_data.resize(d_max_levels);
+    d_spring_csr_data.resize(d_max_levels);
     d_using_uniform_spring_stiffness.resize(d_max_levels);
     d_uniform_spring_stiffness.resize(d_max_levels);
     d_using_uniform_spring_rest_length.resize(d_max_levels);
@@ -3038,6 +3179,7 @@ void IBStandardInitializer::getFromInput(Pointer<Database> db)
     d_enable_xsprings.resize(d_max_levels);
     d_xspring_edge_map.resize(d_max_levels);
     d_xspring_spec_data.resize(d_max_levels);
+    d_xspring_csr_data.resize(d_max_levels);
     d_using_uniform_xspring_stiffness.resize(d_max_levels);
     d_uniform_xspring_stiffness.resize(d_max_levels);
     d_using_uniform_xspring_rest_length.resize(d_max_levels);
@@ -3055,6 +3197,7 @@ void IBStandardInitializer::getFromInput(Pointer<Database> db)
     d_enable_rods.resize(d_max_levels);
     d_rod_edge_map.resize(d_max_levels);
     d_rod_spec_data.resize(d_max_levels);
+    d_rod_csr_data.resize(d_max_levels);
     d_using_uniform_rod_properties.resize(d_max_levels);
     d_uniform_rod_properties.resize(d_max_levels);
 
@@ -159,6 +159,15 @@ void IBStrategy::updateFixedLEOperators()
     return;
 } // updateFixedLEOperators
 
+void IBStrategy::computeSubcycledLagrangianForce(double /*current_time*/,
+                                                 double /*new_time*/,
+                                                 int /*num_substeps*/,
+                                                 double /*data_time*/)
+{
+    TBOX_ERROR("IBStrategy::computeSubcycledLagrangianForce(): unimplemented\n");
+    return;
+} // computeSubcycledLagrangianForce
+
 bool IBStrategy::hasFluidSources() const
 {
     return false;
@@ -244,6 +253,15 @@ void IBStrategy::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
     return;
 } // endDataRedistribution
 
+void IBStrategy::computeRegridDisplacementStatistics(double& max_displacement,
+                                                     double& edge_fraction,
+                                                     int /*edge_width*/)
+{
+    max_displacement = -1.0;
+    edge_fraction = -1.0;
+    return;
+} // computeRegridDisplacementStatistics
+
 void IBStrategy::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
                                      int /*level_number*/,
                                      double /*init_data_time*/,
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -220,15 +221,31 @@ void IBStrategySet::computeLagrangianForce(double data_time)
     return;
 } // computeLagrangianForce
 
+void IBStrategySet::computeSubcycledLagrangianForce(const double current_time,
+                                                    const double new_time,
+                                                    const int num_substeps,
+                                                    const double data_time)
+{
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->computeSubcycledLagrangianForce(current_time, new_time, num_substeps, data_time);
+    }
+    return;
+} // computeSubcycledLagrangianForce
+
 void IBStrategySet::spreadForce(int f_data_idx,
                                 RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                                 const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
-                                double data_time)
+                                double data_time,
+                                bool f_data_is_zero)
 {
     for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
          ++cit)
     {
-        (*cit)->spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time);
+        // Only the first strategy spreads into data that are known to be zero.
+        (*cit)->spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time,
+                            f_data_is_zero && cit == d_strategy_set.begin());
     }
     return;
 } // spreadForce
@@ -375,6 +392,23 @@ void IBStrategySet::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarc
     return;
 } // endDataRedistribution
 
+void IBStrategySet::computeRegridDisplacementStatistics(double& max_displacement,
+                                                        double& edge_fraction,
+                                                        const int edge_width)
+{
+    max_displacement = -1.0;
+    edge_fraction = -1.0;
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        double strategy_max_displacement, strategy_edge_fraction;
+        (*cit)->computeRegridDisplacementStatistics(strategy_max_displacement, strategy_edge_fraction, edge_width);
+        max_displacement = std::max(max_displacement, strategy_max_displacement);
+        edge_fraction = std::max(edge_fraction, strategy_edge_fraction);
+    }
+    return;
+} // computeRegridDisplacementStatistics
+
 void IBStrategySet::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                                         int level_number,
                                         double init_data_time,
@@ -50,8 +50,6 @@
 #include "CellIterator.h"
 #include "CoarsenSchedule.h"
 #include "GriddingAlgorithm.h"
-#include "HierarchyDataOpsManager.h"
-#include "HierarchyDataOpsReal.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -782,7 +780,8 @@ void IMPMethod::computeLagrangianForce(const double data_time)
 void IMPMethod::spreadForce(const int f_data_idx,
                             RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                             const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
-                            const double data_time)
+                            const double data_time,
+                            const bool f_data_is_zero)
 {
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -795,17 +794,11 @@ void IMPMethod::spreadForce(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(sc_data);
 
-    // Make a copy of the Eulerian data.
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
-    }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
-        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
+    // Prepare the Eulerian data to accumulate spread values.  The physical
+    // boundary operator overwrites values on the physical boundary, and so in
+    // that case any nonzero existing values are stored in scratch data.
+    const bool preserve_data = !f_data_is_zero && f_phys_bdry_op != NULL;
+    d_spread_accumulator.beginAccumulation(f_data_idx, d_hierarchy, coarsest_ln, finest_ln, preserve_data);
 
     // Synchronize Lagrangian values.
     std::vector<Pointer<LData> >* X_data;
@@ -928,14 +921,7 @@ void IMPMethod::spreadForce(const int f_data_idx,
     }
 
     // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
-    }
-    var_db->removePatchDataIndex(f_copy_data_idx);
+    d_spread_accumulator.endAccumulation();
     return;
 } // spreadForce
 
@@ -513,6 +513,17 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(const std::stri
     }
     if (!d_stokes_solver_db) d_stokes_solver_db = new MemoryDatabase("stokes_solver_db");
 
+    // Setup the extrapolation of initial guesses for the Stokes solver.  When
+    // extrapolation is disabled, each solve starts from the current state.
+    d_stokes_initial_guess_extrapolation_order = -1;
+    if (input_db->keyExists("stokes_initial_guess_extrapolation_order"))
+        d_stokes_initial_guess_extrapolation_order = input_db->getInteger("stokes_initial_guess_extrapolation_order");
+    if (d_stokes_initial_guess_extrapolation_order >= 0)
+    {
+        d_stokes_solution_history = new SolutionHistoryExtrapolator(d_object_name + "::stokes_solution_history",
+                                                                    d_stokes_initial_guess_extrapolation_order);
+    }
+
     if (input_db->keyExists("stokes_precond_type"))
     {
         d_stokes_precond_type = input_db->getString("stokes_precond_type");
@@ -1250,6 +1261,13 @@ void INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_ti
 
     // Solve for u(n+1), p(n+1/2).
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+
+    // Store the solution for use in extrapolating initial guesses during
+    // subsequent time steps.
+    if (d_stokes_solution_history && cycle_num == d_current_num_cycles - 1)
+    {
+        d_stokes_solution_history->storeSolution(*d_sol_vec, new_time);
+    }
     if (d_enable_logging)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
@@ -1563,9 +1581,15 @@ void INSStaggeredHierarchyIntegrator::setupSolverVectors(const Pointer<SAMRAIVec
     }
 
     // Set solution components to equal most recent approximations to u(n+1) and
-    // p(n+1/2).
-    d_hier_sc_data_ops->copyData(sol_vec->getComponentDescriptorIndex(0), d_U_new_idx);
-    d_hier_cc_data_ops->copyData(sol_vec->getComponentDescriptorIndex(1), d_P_new_idx);
+    // p(n+1/2).  During the first cycle, these approximations are optionally
+    // extrapolated from the solutions computed during previous time steps.
+    const bool extrapolate_initial_guess = cycle_num == 0 && d_stokes_solution_history &&
+                                           d_stokes_solution_history->computeInitialGuess(*sol_vec, new_time);
+    if (!extrapolate_initial_guess)
+    {
+        d_hier_sc_data_ops->copyData(sol_vec->getComponentDescriptorIndex(0), d_U_new_idx);
+        d_hier_cc_data_ops->copyData(sol_vec->getComponentDescriptorIndex(1), d_P_new_idx);
+    }
 
     // Enforce Dirichlet boundary conditions.
     d_bc_helper->enforceNormalVelocityBoundaryConditions(sol_vec->getComponentDescriptorIndex(0),
@@ -1895,6 +1919,9 @@ void INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_velocity_solver_needs_init = true;
     d_pressure_solver_needs_init = true;
     d_stokes_solver_needs_init = true;
+
+    // Discard solutions computed on the previous hierarchy configuration.
+    if (d_stokes_solution_history) d_stokes_solution_history->clearHistory();
     return;
 } // resetHierarchyConfigurationSpecialized
 
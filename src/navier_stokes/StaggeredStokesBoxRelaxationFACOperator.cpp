@@ -445,7 +445,8 @@ StaggeredStokesBoxRelaxationFACOperator::StaggeredStokesBoxRelaxationFACOperator
     const Pointer<Database> input_db,
     const std::string& default_options_prefix)
     : StaggeredStokesFACPreconditionerStrategy(object_name, GHOSTS, input_db, default_options_prefix), d_box_op(),
-      d_box_e(), d_box_r(), d_box_ksp(), d_patch_side_bc_box_overlap(), d_patch_cell_bc_box_overlap()
+      d_box_e(), d_box_r(), d_box_ksp(), d_use_patch_schwarz_smoother(false), d_patch_op(), d_patch_e(), d_patch_r(),
+      d_patch_ksp(), d_patch_side_bc_box_overlap(), d_patch_cell_bc_box_overlap()
 {
     // intentionally blank
     return;
@@ -606,6 +607,18 @@ void StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM,
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
+            if (d_use_patch_schwarz_smoother)
+            {
+                Vec& patch_e = d_patch_e[level_num][patch_counter];
+                Vec& patch_r = d_patch_r[level_num][patch_counter];
+                copyToVec(patch_e, *U_error_data, *P_error_data, patch_box, patch_box);
+                copyToVec(patch_r, *U_residual_data, *P_residual_data, patch_box, patch_box);
+                modifyRhsForBcs(patch_r, *U_error_data, *P_error_data, d_U_problem_coefs, patch_box, patch_box, dx);
+                ierr = KSPSolve(d_patch_ksp[level_num][patch_counter], patch_r, patch_e);
+                IBTK_CHKERRQ(ierr);
+                copyFromVec(patch_e, *U_error_data, *P_error_data, patch_box, patch_box);
+                continue;
+            }
             for (Box<NDIM>::Iterator b(patch_box); b; b++)
             {
                 const Index<NDIM>& i = b();
@@ -634,6 +647,7 @@ void StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized
     const int finest_reset_ln)
 {
     // Initialize the box relaxation data on each level of the patch hierarchy.
+    d_use_patch_schwarz_smoother = d_smoother_type == "PATCH_SCHWARZ";
     d_box_op.resize(d_finest_ln + 1);
     d_box_e.resize(d_finest_ln + 1);
     d_box_r.resize(d_finest_ln + 1);
@@ -672,6 +686,56 @@ void StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized
         IBTK_CHKERRQ(ierr);
     }
 
+    // Initialize and factor the patch operators used by the patch Schwarz
+    // smoother.
+    d_patch_op.resize(d_finest_ln + 1);
+    d_patch_e.resize(d_finest_ln + 1);
+    d_patch_r.resize(d_finest_ln + 1);
+    d_patch_ksp.resize(d_finest_ln + 1);
+    for (int ln = coarsest_reset_ln; d_use_patch_schwarz_smoother && ln <= finest_reset_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& ratio = level->getRatio();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+        }
+        const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+        d_patch_op[ln].resize(num_local_patches);
+        d_patch_e[ln].resize(num_local_patches);
+        d_patch_r[ln].resize(num_local_patches);
+        d_patch_ksp[ln].resize(num_local_patches);
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Mat& patch_op = d_patch_op[ln][patch_counter];
+            KSP& patch_ksp = d_patch_ksp[ln][patch_counter];
+            buildBoxOperator(patch_op, d_U_problem_coefs, patch_box, patch_box, dx);
+            int ierr;
+            ierr = MatGetVecs(patch_op, &d_patch_e[ln][patch_counter], &d_patch_r[ln][patch_counter]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPCreate(PETSC_COMM_SELF, &patch_ksp);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetOperators(patch_ksp, patch_op, patch_op);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(patch_ksp, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetType(patch_ksp, KSPPREONLY);
+            IBTK_CHKERRQ(ierr);
+            PC patch_pc;
+            ierr = KSPGetPC(patch_ksp, &patch_pc);
+            IBTK_CHKERRQ(ierr);
+            ierr = PCSetType(patch_pc, PCLU);
+            IBTK_CHKERRQ(ierr);
+            ierr = PCFactorReorderForNonzeroDiagonal(patch_pc, std::numeric_limits<double>::epsilon());
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetUp(patch_ksp);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
     // Get overlap information for setting patch boundary conditions.
     d_patch_side_bc_box_overlap.resize(d_finest_ln + 1);
     for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
@@ -731,6 +795,21 @@ void StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized
         IBTK_CHKERRQ(ierr);
         ierr = KSPDestroy(&d_box_ksp[ln]);
         IBTK_CHKERRQ(ierr);
+        for (unsigned int k = 0; k < d_patch_ksp[ln].size(); ++k)
+        {
+            ierr = MatDestroy(&d_patch_op[ln][k]);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&d_patch_e[ln][k]);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&d_patch_r[ln][k]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPDestroy(&d_patch_ksp[ln][k]);
+            IBTK_CHKERRQ(ierr);
+        }
+        d_patch_op[ln].resize(0);
+        d_patch_e[ln].resize(0);
+        d_patch_r[ln].resize(0);
+        d_patch_ksp[ln].resize(0);
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
@@ -84,7 +84,10 @@
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/SideNoCornersFillPattern.h"
 #include "ibtk/SideSynchCopyFillPattern.h"
+#include "ibtk/SolverTelemetryManager.h"
 #include "tbox/Database.h"
+#include "tbox/MemoryDatabase.h"
+#include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
@@ -140,7 +143,8 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
       d_U_restriction_method("CONSERVATIVE_COARSEN"), d_P_restriction_method("CONSERVATIVE_COARSEN"),
       d_coarse_solver_type("BLOCK_JACOBI"), d_coarse_solver_default_options_prefix(default_options_prefix + "_coarse"),
       d_coarse_solver_rel_residual_tol(1.0e-5), d_coarse_solver_abs_residual_tol(1.0e-50),
-      d_coarse_solver_max_iterations(10), d_coarse_solver(), d_coarse_solver_db(), d_context(NULL),
+      d_coarse_solver_max_iterations(10), d_coarse_solver(), d_coarse_solver_db(),
+      d_coarse_solver_agglomeration_num_procs(0), d_coarse_solver_agglomeration_pc_type("lu"), d_context(NULL),
       d_side_scratch_idx(-1), d_cell_scratch_idx(-1), d_U_cf_bdry_op(), d_P_cf_bdry_op(), d_U_op_stencil_fill_pattern(),
       d_P_op_stencil_fill_pattern(), d_U_synch_fill_pattern(), d_U_prolongation_refine_operator(),
       d_P_prolongation_refine_operator(), d_prolongation_refine_patch_strategy(), d_prolongation_refine_algorithm(),
@@ -168,6 +172,10 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
         if (input_db->isDatabase("coarse_solver_db")) d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
+        if (input_db->keyExists("coarse_solver_agglomeration_num_procs"))
+            d_coarse_solver_agglomeration_num_procs = input_db->getInteger("coarse_solver_agglomeration_num_procs");
+        if (input_db->keyExists("coarse_solver_agglomeration_pc_type"))
+            d_coarse_solver_agglomeration_pc_type = input_db->getString("coarse_solver_agglomeration_pc_type");
     }
 
     // Setup scratch variables.
@@ -194,6 +202,9 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
     }
     d_cell_scratch_idx = var_db->registerVariableAndContext(cell_scratch_var, d_context, cell_ghosts);
 
+    // Allocate the coarse level solver.
+    setCoarseSolverType(d_coarse_solver_type);
+
     // Setup Timers.
     IBAMR_DO_ONCE(
         t_restrict_residual =
@@ -305,6 +316,7 @@ void StaggeredStokesFACPreconditionerStrategy::setCoarseSolverType(const std::st
     d_coarse_solver_type = coarse_solver_type;
     if (d_coarse_solver_type != "BLOCK_JACOBI" && !d_coarse_solver)
     {
+        setCoarseSolverAgglomerationOptions();
         d_coarse_solver =
             StaggeredStokesSolverManager::getManager()->allocateSolver(d_coarse_solver_type,
                                                                        d_object_name + "::coarse_solver",
@@ -535,7 +547,9 @@ void StaggeredStokesFACPreconditionerStrategy::computeResidual(SAMRAIVectorReal<
         d_level_bdry_fill_ops[finest_level_num]->resetTransactionComponents(U_P_components);
     }
     d_level_bdry_fill_ops[finest_level_num]->setHomogeneousBc(true);
+    SolverTelemetryManager::startPhase(GHOST_FILL_PHASE);
     d_level_bdry_fill_ops[finest_level_num]->fillData(d_new_time);
+    SolverTelemetryManager::stopPhase(GHOST_FILL_PHASE);
     InterpolationTransactionComponent default_U_scratch_component(d_solution->getComponentDescriptorIndex(0),
                                                                   DATA_REFINE_TYPE,
                                                                   USE_CF_INTERPOLATION,
@@ -886,6 +900,25 @@ void StaggeredStokesFACPreconditionerStrategy::deallocateScratchData()
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void StaggeredStokesFACPreconditionerStrategy::setCoarseSolverAgglomerationOptions()
+{
+    if (d_coarse_solver_agglomeration_num_procs <= 0) return;
+    if (d_coarse_solver_type != StaggeredStokesSolverManager::PETSC_LEVEL_SOLVER &&
+        d_coarse_solver_type != StaggeredStokesSolverManager::DEFAULT_LEVEL_SOLVER)
+    {
+        pout << d_object_name << "::setCoarseSolverAgglomerationOptions():\n"
+             << "  WARNING: coarsest level agglomeration requires coarse_solver_type = PETSC_LEVEL_SOLVER\n"
+             << "  ignoring coarse_solver_agglomeration_num_procs = " << d_coarse_solver_agglomeration_num_procs
+             << std::endl;
+        return;
+    }
+    if (!d_coarse_solver_db) d_coarse_solver_db = new MemoryDatabase(d_object_name + "::coarse_solver_db");
+    d_coarse_solver_db->putBool("use_agglomeration", true);
+    d_coarse_solver_db->putInteger("agglomeration_num_procs", d_coarse_solver_agglomeration_num_procs);
+    d_coarse_solver_db->putString("agglomeration_pc_type", d_coarse_solver_agglomeration_pc_type);
+    return;
+} // setCoarseSolverAgglomerationOptions
+
 void StaggeredStokesFACPreconditionerStrategy::xeqScheduleProlongation(const std::pair<int, int>& dst_idxs,
                                                                        const std::pair<int, int>& src_idxs,
                                                                        const int dst_ln)
@@ -949,7 +982,9 @@ void StaggeredStokesFACPreconditionerStrategy::xeqScheduleGhostFillNoCoarse(cons
     refine_alg.registerRefine(
         P_dst_idx, P_dst_idx, P_dst_idx, Pointer<RefineOperator<NDIM> >(), d_P_op_stencil_fill_pattern);
     refine_alg.resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
+    SolverTelemetryManager::startPhase(GHOST_FILL_PHASE);
     d_ghostfill_nocoarse_refine_schedules[dst_ln]->fillData(d_new_time);
+    SolverTelemetryManager::stopPhase(GHOST_FILL_PHASE);
     d_ghostfill_nocoarse_refine_algorithm->resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
     return;
 } // xeqScheduleGhostFillNoCoarse
@@ -960,7 +995,9 @@ void StaggeredStokesFACPreconditionerStrategy::xeqScheduleDataSynch(const int U_
     refine_alg.registerRefine(
         U_dst_idx, U_dst_idx, U_dst_idx, Pointer<RefineOperator<NDIM> >(), d_U_synch_fill_pattern);
     refine_alg.resetSchedule(d_synch_refine_schedules[dst_ln]);
+    SolverTelemetryManager::startPhase(GHOST_FILL_PHASE);
     d_synch_refine_schedules[dst_ln]->fillData(d_new_time);
+    SolverTelemetryManager::stopPhase(GHOST_FILL_PHASE);
     d_synch_refine_algorithm->resetSchedule(d_synch_refine_schedules[dst_ln]);
     return;
 } // xeqScheduleDataSynch
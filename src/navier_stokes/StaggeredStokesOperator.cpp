@@ -39,6 +39,7 @@
 #include <vector>
 
 #include "CellVariable.h"
+#include "HierarchyDataOpsManager.h"
 #include "IntVector.h"
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
@@ -106,7 +107,7 @@ StaggeredStokesOperator::StaggeredStokesOperator(const std::string& object_name,
       d_P_bc_coef(d_default_P_bc_coef), d_bc_helper(Pointer<StaggeredStokesPhysicalBoundaryHelper>(NULL)),
       d_U_fill_pattern(NULL), d_P_fill_pattern(NULL), d_transaction_comps(),
       d_hier_bdry_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)),
-      d_no_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)), d_x(NULL), d_b(NULL)
+      d_no_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)), d_hier_sc_data_ops(NULL), d_x(NULL), d_b(NULL)
 {
     // Setup a default boundary condition object that specifies homogeneous
     // Dirichlet boundary conditions for the velocity and homogeneous Neumann
@@ -210,11 +211,15 @@ void StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVec
     Pointer<SideVariable<NDIM, double> > A_U_sc_var = y.getComponentVariable(0);
     Pointer<CellVariable<NDIM, double> > A_P_cc_var = y.getComponentVariable(1);
 
-    // Simultaneously fill ghost cell values for all components.
+    // Copy the velocity into scratch data.  HierarchyMathOps::stokes()
+    // synchronizes the coarse-fine interface values of the velocity before
+    // filling ghost cell values, so the ghost cell values are filled in place.
+    d_hier_sc_data_ops->copyData(U_scratch_idx, U_idx);
+
+    // Setup to simultaneously fill ghost cell values for all components.
     typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
     std::vector<InterpolationTransactionComponent> transaction_comps(2);
     transaction_comps[0] = InterpolationTransactionComponent(U_scratch_idx,
-                                                             U_idx,
                                                              DATA_REFINE_TYPE,
                                                              USE_CF_INTERPOLATION,
                                                              DATA_COARSEN_TYPE,
@@ -234,40 +239,29 @@ void StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVec
     d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
     StaggeredStokesPhysicalBoundaryHelper::setupBcCoefObjects(
         d_U_bc_coefs, d_P_bc_coef, U_scratch_idx, P_idx, d_homogeneous_bc);
-    d_hier_bdry_fill->fillData(d_solution_time);
-    StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_U_bc_coefs, d_P_bc_coef);
-    //  d_bc_helper->enforceDivergenceFreeConditionAtBoundary(U_scratch_idx);
-    d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
 
     // Compute the action of the operator:
     //
     // A*[U;P] := [A_U;A_P] = [(C*I+D*L)*U + Grad P; -Div U]
-    d_hier_math_ops->grad(A_U_idx,
-                          A_U_sc_var,
-                          /*cf_bdry_synch*/ false,
-                          1.0,
-                          P_idx,
-                          P_cc_var,
-                          d_no_fill,
-                          d_new_time);
-    d_hier_math_ops->laplace(A_U_idx,
-                             A_U_sc_var,
-                             d_U_problem_coefs,
-                             U_scratch_idx,
-                             U_sc_var,
-                             d_no_fill,
-                             d_new_time,
-                             1.0,
-                             A_U_idx,
-                             A_U_sc_var);
-    d_hier_math_ops->div(A_P_idx,
-                         A_P_cc_var,
-                         -1.0,
-                         U_scratch_idx,
-                         U_sc_var,
-                         d_no_fill,
-                         d_new_time,
-                         /*cf_bdry_synch*/ true);
+    //
+    // NOTE: All components of the operator are evaluated in a single sweep
+    // over each patch.  Ghost cell values are filled by HierarchyMathOps.
+    d_hier_math_ops->stokes(A_U_idx,
+                            A_U_sc_var,
+                            A_P_idx,
+                            A_P_cc_var,
+                            d_U_problem_coefs,
+                            U_scratch_idx,
+                            U_sc_var,
+                            P_idx,
+                            P_cc_var,
+                            d_hier_bdry_fill,
+                            d_solution_time,
+                            1.0,
+                            -1.0);
+    StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_U_bc_coefs, d_P_bc_coef);
+    //  d_bc_helper->enforceDivergenceFreeConditionAtBoundary(U_scratch_idx);
+    d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
     d_bc_helper->copyDataAtDirichletBoundaries(A_U_idx, U_scratch_idx);
 
     IBAMR_TIMER_STOP(t_apply);
@@ -314,6 +308,11 @@ void StaggeredStokesOperator::initializeOperatorState(const SAMRAIVectorReal<NDI
     d_hier_bdry_fill = new HierarchyGhostCellInterpolation();
     d_hier_bdry_fill->initializeOperatorState(d_transaction_comps, d_x->getPatchHierarchy());
 
+    // Initialize the data operations used to copy the velocity.
+    d_hier_sc_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(
+        in.getComponentVariable(0), in.getPatchHierarchy(), true);
+    d_hier_sc_data_ops->resetLevels(in.getCoarsestLevelNumber(), in.getFinestLevelNumber());
+
     // Initialize hierarchy math ops object.
     if (!d_hier_math_ops_external)
     {
@@ -344,6 +343,7 @@ void StaggeredStokesOperator::deallocateOperatorState()
 
     // Deallocate hierarchy math operations object.
     if (!d_hier_math_ops_external) d_hier_math_ops.setNull();
+    d_hier_sc_data_ops.setNull();
 
     // Deallocate the interpolation operators.
     d_hier_bdry_fill->deallocateOperatorState();
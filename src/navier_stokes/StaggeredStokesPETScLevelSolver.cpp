@@ -57,6 +57,7 @@
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/PETScLevelSolver.h"
+#include "ibtk/PETScVecUtilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
 #include "petscvec.h"
@@ -208,6 +209,17 @@ void StaggeredStokesPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     return;
 } // setupKSPVecs
 
+void StaggeredStokesPETScLevelSolver::generateSchwarzSubdomains(std::vector<std::vector<int> >& subdomain_dofs)
+{
+    // Each subdomain couples the velocity and pressure DOFs of a single patch.
+    Pointer<PatchLevel<NDIM> > patch_level = d_hierarchy->getPatchLevel(d_level_num);
+    PETScVecUtilities::constructPatchLevelSchwarzSubdomains(
+        subdomain_dofs, d_num_dofs_per_proc, d_u_dof_index_idx, patch_level);
+    PETScVecUtilities::constructPatchLevelSchwarzSubdomains(
+        subdomain_dofs, d_num_dofs_per_proc, d_p_dof_index_idx, patch_level);
+    return;
+} // generateSchwarzSubdomains
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////